@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+
+#include "jmh_config.h"
+
+#include "disruptor/AvailableBuffer.h"
+#include "disruptor/ParityBitmapAvailableBuffer.h"
+
+#include <cstdint>
+
+// Multi-producer availability tracking on a 1M-slot ring: Java's int-per-slot
+// AvailableBuffer vs ParityBitmapAvailableBuffer. Arg = batch size.
+//
+// - PublishScan: publish(lo, hi) + getHighestPublishedSequence(lo, hi), moving
+//   forward through the ring (every lap flips the expected flag/parity).
+// - Scan: getHighestPublishedSequence over an already-published batch only.
+
+namespace {
+constexpr int kRingSize = 1 << 20;
+
+template <typename AvailableBufferT>
+void publishScan(benchmark::State& state) {
+  const int64_t batchSize = state.range(0);
+  AvailableBufferT buffer(kRingSize);
+  int64_t lo = 0;
+  for (auto _ : state) {
+    const int64_t hi = lo + batchSize - 1;
+    buffer.setAvailable(lo, hi);
+    benchmark::DoNotOptimize(buffer.getHighestPublishedSequence(lo, hi));
+    lo = hi + 1;
+  }
+  state.SetItemsProcessed(state.iterations() * batchSize);
+}
+
+template <typename AvailableBufferT>
+void scan(benchmark::State& state) {
+  const int64_t batchSize = state.range(0);
+  AvailableBufferT buffer(kRingSize);
+  buffer.setAvailable(0, kRingSize - 1);
+  int64_t lo = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(buffer.getHighestPublishedSequence(lo, lo + batchSize - 1));
+    lo = (lo + batchSize) & (kRingSize - 1);
+  }
+  state.SetItemsProcessed(state.iterations() * batchSize);
+}
+
+benchmark::internal::Benchmark* batchSizes(benchmark::internal::Benchmark* b) {
+  return disruptor::bench::jmh::applyJmhDefaults(b->RangeMultiplier(4)->Range(1, 4096));
+}
+}  // namespace
+
+static auto* bm_AvailableBuffer_PublishScan = [] {
+  auto* b = benchmark::RegisterBenchmark("AvailableBuffer_PublishScan",
+                                         &publishScan<disruptor::AvailableBuffer<>>);
+  return batchSizes(b);
+}();
+
+static auto* bm_ParityBitmapAvailableBuffer_PublishScan = [] {
+  auto* b = benchmark::RegisterBenchmark("ParityBitmapAvailableBuffer_PublishScan",
+                                         &publishScan<disruptor::ParityBitmapAvailableBuffer<>>);
+  return batchSizes(b);
+}();
+
+static auto* bm_AvailableBuffer_Scan = [] {
+  auto* b =
+    benchmark::RegisterBenchmark("AvailableBuffer_Scan", &scan<disruptor::AvailableBuffer<>>);
+  return batchSizes(b);
+}();
+
+static auto* bm_ParityBitmapAvailableBuffer_Scan = [] {
+  auto* b = benchmark::RegisterBenchmark("ParityBitmapAvailableBuffer_Scan",
+                                         &scan<disruptor::ParityBitmapAvailableBuffer<>>);
+  return batchSizes(b);
+}();
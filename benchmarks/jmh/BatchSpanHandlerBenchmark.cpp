@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+
+#include "jmh_config.h"
+#include "jmh_util.h"
+
+#include "disruptor/BatchSpanEventHandler.h"
+#include "disruptor/EventHandler.h"
+#include "disruptor/YieldingWaitStrategy.h"
+#include "disruptor/dsl/Disruptor.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <thread>
+
+// ValueAdditionEventHandler-style summing of event values, per event
+// (EventHandler::onEvent) and per batch (BatchSpanEventHandler::onBatch over
+// the ring's slots, which the compiler can vectorise). Each operation
+// publishes kBatchSize events with one span claim and waits until the
+// handler has consumed them, so the consumer side dominates; real time,
+// since that work is on the consumer thread.
+
+namespace {
+constexpr int kBufferSize = 1 << 16;
+constexpr int kBatchSize = 4096;
+
+using WS = disruptor::YieldingWaitStrategy;
+using DisruptorType = disruptor::dsl::Disruptor<disruptor::bench::jmh::SimpleEvent,
+                                                disruptor::dsl::ProducerType::SINGLE,
+                                                WS>;
+
+struct PerEventSum : public disruptor::EventHandler<disruptor::bench::jmh::SimpleEvent> {
+  int64_t sum{0};
+
+  void onEvent(disruptor::bench::jmh::SimpleEvent& event, int64_t, bool) override {
+    sum += event.value;
+  }
+};
+
+struct SpanSum final : public disruptor::BatchSpanEventHandler<disruptor::bench::jmh::SimpleEvent> {
+  int64_t sum{0};
+
+  void onBatch(std::span<disruptor::bench::jmh::SimpleEvent> first,
+               std::span<disruptor::bench::jmh::SimpleEvent> second,
+               int64_t,
+               int64_t) override {
+    int64_t batchSum = 0;
+    for (const auto& event : first) {
+      batchSum += event.value;
+    }
+    for (const auto& event : second) {
+      batchSum += event.value;
+    }
+    sum += batchSum;
+  }
+};
+
+DisruptorType* disruptorInstance = nullptr;
+disruptor::EventHandlerIdentity* handlerInstance = nullptr;
+PerEventSum perEventSum;
+SpanSum spanSum;
+
+template <typename Handler>
+void setup(const benchmark::State& state, Handler& handler) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  static WS ws;
+  auto factory = std::make_shared<disruptor::bench::jmh::SimpleEventFactory>();
+  disruptorInstance = new DisruptorType(factory, kBufferSize,
+                                        disruptor::util::DaemonThreadFactory::INSTANCE(), ws);
+  disruptorInstance->handleEventsWith(handler);
+  handlerInstance = &handler;
+  disruptorInstance->start();
+}
+
+void teardown(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  disruptorInstance->halt();
+  delete disruptorInstance;
+  disruptorInstance = nullptr;
+}
+
+void producing(benchmark::State& state) {
+  auto& ringBuffer = disruptorInstance->getRingBuffer();
+  for (auto _ : state) {
+    auto claim = ringBuffer.claimSpan(kBatchSize);
+    for (std::size_t i = 0; i < claim.size(); ++i) {
+      claim[i].value = static_cast<int64_t>(i);
+    }
+    ringBuffer.publish(claim);
+    while (disruptorInstance->getSequenceValueFor(*handlerInstance) < claim.hi) {
+      std::this_thread::yield();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchSize);
+}
+}  // namespace
+
+static auto* bm_ValueAddition_PerEvent = [] {
+  auto* b = benchmark::RegisterBenchmark("ValueAddition_PerEvent", &producing);
+  b->Setup([](const benchmark::State& state) { setup(state, perEventSum); })->Teardown(teardown);
+  b->UseRealTime();
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}();
+
+static auto* bm_ValueAddition_BatchSpan = [] {
+  auto* b = benchmark::RegisterBenchmark("ValueAddition_BatchSpan", &producing);
+  b->Setup([](const benchmark::State& state) { setup(state, spanSum); })->Teardown(teardown);
+  b->UseRealTime();
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}();
@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+
+#include "jmh_config.h"
+#include "jmh_util.h"
+
+#include "disruptor/AtomicWaitStrategy.h"
+#include "disruptor/BlockingWaitStrategy.h"
+#include "disruptor/FutexWaitStrategy.h"
+#include "disruptor/LiteBlockingWaitStrategy.h"
+#include "disruptor/dsl/Disruptor.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+
+#include <cstdint>
+#include <memory>
+
+// The MultiProducerSingleConsumer producing benchmark with each of the
+// blocking wait strategies. Every publish calls signalAllWhenBlocking(); with
+// the consumer mostly busy, that measures what the signal costs when nobody
+// is asleep.
+
+namespace {
+constexpr int kBigBuffer = 1 << 22;
+constexpr int kMpThreads = 4;
+
+using Event = disruptor::bench::jmh::SimpleEvent;
+
+template <typename WS>
+struct Mpsc {
+  using DisruptorType = disruptor::dsl::Disruptor<Event, disruptor::dsl::ProducerType::MULTI, WS>;
+
+  WS waitStrategy;
+  disruptor::bench::jmh::ConsumeHandler handler;
+  std::unique_ptr<DisruptorType> disruptor;
+};
+
+template <typename WS>
+Mpsc<WS>* mpsc = nullptr;
+
+template <typename WS>
+void setup(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  auto* instance = new Mpsc<WS>();
+  instance->disruptor = std::make_unique<typename Mpsc<WS>::DisruptorType>(
+    std::make_shared<disruptor::bench::jmh::SimpleEventFactory>(), kBigBuffer,
+    disruptor::util::DaemonThreadFactory::INSTANCE(), instance->waitStrategy);
+  instance->disruptor->handleEventsWith(instance->handler);
+  instance->disruptor->start();
+  mpsc<WS> = instance;
+}
+
+template <typename WS>
+void teardown(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  mpsc<WS>->disruptor->halt();
+  delete mpsc<WS>;
+  mpsc<WS> = nullptr;
+}
+
+template <typename WS>
+void producing(benchmark::State& state) {
+  auto& ringBuffer = mpsc<WS>->disruptor->getRingBuffer();
+  for (auto _ : state) {
+    const int64_t sequence = ringBuffer.next();
+    ringBuffer.get(sequence).value = 0;
+    ringBuffer.publish(sequence);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename WS>
+benchmark::internal::Benchmark* registerProducing(const char* name) {
+  auto* b = benchmark::RegisterBenchmark(name, &producing<WS>);
+  b->Threads(kMpThreads);
+  b->Setup(setup<WS>)->Teardown(teardown<WS>);
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}
+}  // namespace
+
+static auto* bm_MPSC_producing_Blocking =
+  registerProducing<disruptor::BlockingWaitStrategy>("MPSC_producing_Blocking");
+
+static auto* bm_MPSC_producing_LiteBlocking =
+  registerProducing<disruptor::LiteBlockingWaitStrategy>("MPSC_producing_LiteBlocking");
+
+static auto* bm_MPSC_producing_Futex =
+  registerProducing<disruptor::FutexWaitStrategy>("MPSC_producing_Futex");
+
+static auto* bm_MPSC_producing_AtomicWait =
+  registerProducing<disruptor::AtomicWaitStrategy>("MPSC_producing_AtomicWait");
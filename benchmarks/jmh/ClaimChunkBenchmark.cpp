@@ -0,0 +1,128 @@
+#include <benchmark/benchmark.h>
+
+#include "jmh_config.h"
+#include "jmh_util.h"
+
+#include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/dsl/Disruptor.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+
+#include <cstdint>
+#include <memory>
+
+// Single-event multi-producer publishing, as JMH_MultiProducerSingleConsumer_
+// producing, with and without per-producer claim chunks. Threads = producers.
+//
+// - Next: ringBuffer.next() per event (getAndAdd on the shared cursor).
+// - ClaimChunk: one ClaimChunk per producer thread, kChunkSize sequences per
+//   cursor update.
+//
+// Claim_*: the same two claim paths on a bare sequencer without consumers,
+// single thread, i.e. the uncontended cost of claim + publish.
+
+namespace {
+constexpr int kBufferSize = 1 << 22;
+constexpr int kChunkSize = 64;
+
+using DisruptorType = disruptor::dsl::Disruptor<disruptor::bench::jmh::SimpleEvent,
+                                                disruptor::dsl::ProducerType::MULTI,
+                                                disruptor::BusySpinWaitStrategy>;
+
+// One Disruptor and consumer per benchmark run, created by thread 0.
+DisruptorType* disruptorInstance = nullptr;
+disruptor::bench::jmh::ConsumeHandler* handler = nullptr;
+
+void setup(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  static disruptor::BusySpinWaitStrategy ws;
+  auto factory = std::make_shared<disruptor::bench::jmh::SimpleEventFactory>();
+  disruptorInstance = new DisruptorType(factory, kBufferSize,
+                                        disruptor::util::DaemonThreadFactory::INSTANCE(), ws);
+  handler = new disruptor::bench::jmh::ConsumeHandler();
+  disruptorInstance->handleEventsWith(*handler);
+  disruptorInstance->start();
+}
+
+void teardown(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  disruptorInstance->halt();
+  delete disruptorInstance;
+  disruptorInstance = nullptr;
+  delete handler;
+  handler = nullptr;
+}
+
+void next(benchmark::State& state) {
+  auto& ringBuffer = disruptorInstance->getRingBuffer();
+  for (auto _ : state) {
+    const int64_t sequence = ringBuffer.next();
+    ringBuffer.get(sequence).value = 0;
+    ringBuffer.publish(sequence);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void claimChunk(benchmark::State& state) {
+  auto& ringBuffer = disruptorInstance->getRingBuffer();
+  auto chunk = ringBuffer.newClaimChunk(kChunkSize);
+  for (auto _ : state) {
+    const int64_t sequence = chunk.next();
+    ringBuffer.get(sequence).value = 0;
+    chunk.publish(sequence);
+  }
+  chunk.flush();
+  state.SetItemsProcessed(state.iterations());
+}
+
+using SequencerT = disruptor::MultiProducerSequencer<disruptor::BusySpinWaitStrategy>;
+
+void claimNext(benchmark::State& state) {
+  disruptor::BusySpinWaitStrategy ws;
+  SequencerT sequencer(1 << 16, ws);
+  for (auto _ : state) {
+    sequencer.publish(sequencer.next());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void claimChunkNext(benchmark::State& state) {
+  disruptor::BusySpinWaitStrategy ws;
+  SequencerT sequencer(1 << 16, ws);
+  auto chunk = sequencer.newClaimChunk(kChunkSize);
+  for (auto _ : state) {
+    chunk.publish(chunk.next());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+benchmark::internal::Benchmark* producers(benchmark::internal::Benchmark* b) {
+  b->Threads(4)->Threads(8)->Threads(16);
+  b->Setup(setup);
+  b->Teardown(teardown);
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}
+}  // namespace
+
+static auto* bm_MPSC_SingleEvent_Next = [] {
+  auto* b = benchmark::RegisterBenchmark("MPSC_SingleEvent_Next", &next);
+  return producers(b);
+}();
+
+static auto* bm_MPSC_SingleEvent_ClaimChunk = [] {
+  auto* b = benchmark::RegisterBenchmark("MPSC_SingleEvent_ClaimChunk", &claimChunk);
+  return producers(b);
+}();
+
+static auto* bm_Claim_Next = [] {
+  auto* b = benchmark::RegisterBenchmark("Claim_Next", &claimNext);
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}();
+
+static auto* bm_Claim_ClaimChunk = [] {
+  auto* b = benchmark::RegisterBenchmark("Claim_ClaimChunk", &claimChunkNext);
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}();
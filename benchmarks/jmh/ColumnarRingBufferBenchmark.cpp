@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+
+#include "jmh_config.h"
+
+#include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/ColumnarRingBuffer.h"
+#include "disruptor/EventFactory.h"
+#include "disruptor/RingBuffer.h"
+
+#include <cstdint>
+#include <memory>
+
+// Single-field stage over a market-data style event: sum one field (price)
+// across a batch, reading it from the event array (RingBuffer, every event's
+// cache line) vs from its own column (ColumnarRingBuffer). Arg = batch size.
+
+namespace {
+constexpr int kRingSize = 1 << 16;
+
+struct MarketEvent {
+  int64_t instrumentId{0};
+  int64_t timestamp{0};
+  double price{0};
+  double bid{0};
+  double ask{0};
+  int32_t quantity{0};
+  int32_t flags{0};
+};
+
+struct MarketEventFactory final : public disruptor::EventFactory<MarketEvent> {
+  MarketEvent newInstance() override {
+    return MarketEvent();
+  }
+};
+
+using WS = disruptor::BusySpinWaitStrategy;
+using RowRingBuffer = disruptor::SingleProducerRingBuffer<MarketEvent, WS>;
+using ColumnRingBuffer = disruptor::
+  SingleProducerColumnarRingBuffer<WS, int64_t, int64_t, double, double, double, int32_t, int32_t>;
+
+void rowScan(benchmark::State& state) {
+  const int64_t batchSize = state.range(0);
+  WS ws;
+  auto ringBuffer =
+    RowRingBuffer::createSingleProducer(std::make_shared<MarketEventFactory>(), kRingSize, ws);
+  int64_t lo = 0;
+  for (auto _ : state) {
+    double sum = 0;
+    for (int64_t s = lo; s < lo + batchSize; ++s) {
+      sum += ringBuffer->get(s).price;
+    }
+    benchmark::DoNotOptimize(sum);
+    lo += batchSize;
+  }
+  state.SetItemsProcessed(state.iterations() * batchSize);
+}
+
+void columnScan(benchmark::State& state) {
+  const int64_t batchSize = state.range(0);
+  WS ws;
+  auto ringBuffer = ColumnRingBuffer::create(kRingSize, ws);
+  int64_t lo = 0;
+  for (auto _ : state) {
+    auto prices = ringBuffer->column<2>(lo, lo + batchSize - 1);
+    double sum = 0;
+    for (double price : prices.first) {
+      sum += price;
+    }
+    for (double price : prices.second) {
+      sum += price;
+    }
+    benchmark::DoNotOptimize(sum);
+    lo += batchSize;
+  }
+  state.SetItemsProcessed(state.iterations() * batchSize);
+}
+}  // namespace
+
+static auto* bm_RingBuffer_SingleFieldScan = [] {
+  auto* b = benchmark::RegisterBenchmark("RingBuffer_SingleFieldScan", &rowScan);
+  return disruptor::bench::jmh::applyJmhDefaults(b->RangeMultiplier(8)->Range(64, 4096));
+}();
+
+static auto* bm_ColumnarRingBuffer_SingleFieldScan = [] {
+  auto* b = benchmark::RegisterBenchmark("ColumnarRingBuffer_SingleFieldScan", &columnScan);
+  return disruptor::bench::jmh::applyJmhDefaults(b->RangeMultiplier(8)->Range(64, 4096));
+}();
@@ -0,0 +1,134 @@
+#include <benchmark/benchmark.h>
+
+#include "jmh_config.h"
+#include "jmh_util.h"
+
+#include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/CombiningMultiProducerSequencer.h"
+#include "disruptor/MultiProducerSequencer.h"
+#include "disruptor/dsl/Disruptor.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+
+#include <cstdint>
+#include <memory>
+
+// MultiProducerSequencer (getAndAdd per claim) vs
+// CombiningMultiProducerSequencer (flat combining) across producer counts.
+//
+// - *_Claim: next() + publish() on a bare sequencer without consumers, so
+//   only the claim path contends.
+// - MPSC_*: single-event publishing through a Disruptor with one consumer,
+//   as JMH_MultiProducerSingleConsumer_producing.
+
+namespace {
+constexpr int kBufferSize = 1 << 22;
+
+using WS = disruptor::BusySpinWaitStrategy;
+
+template <typename SequencerT>
+SequencerT* claimSequencer = nullptr;
+
+template <typename SequencerT>
+void setupClaim(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  static WS ws;
+  claimSequencer<SequencerT> = new SequencerT(1 << 16, ws);
+}
+
+template <typename SequencerT>
+void teardownClaim(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  delete claimSequencer<SequencerT>;
+  claimSequencer<SequencerT> = nullptr;
+}
+
+template <typename SequencerT>
+void claim(benchmark::State& state) {
+  auto& sequencer = *claimSequencer<SequencerT>;
+  for (auto _ : state) {
+    sequencer.publish(sequencer.next());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <disruptor::dsl::ProducerType Producer>
+using DisruptorT = disruptor::dsl::Disruptor<disruptor::bench::jmh::SimpleEvent, Producer, WS>;
+
+template <disruptor::dsl::ProducerType Producer>
+DisruptorT<Producer>* mpscDisruptor = nullptr;
+
+disruptor::bench::jmh::ConsumeHandler mpscHandler;
+
+template <disruptor::dsl::ProducerType Producer>
+void setupMpsc(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  static WS ws;
+  auto factory = std::make_shared<disruptor::bench::jmh::SimpleEventFactory>();
+  mpscDisruptor<Producer> = new DisruptorT<Producer>(
+    factory, kBufferSize, disruptor::util::DaemonThreadFactory::INSTANCE(), ws);
+  mpscDisruptor<Producer>->handleEventsWith(mpscHandler);
+  mpscDisruptor<Producer>->start();
+}
+
+template <disruptor::dsl::ProducerType Producer>
+void teardownMpsc(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  mpscDisruptor<Producer>->halt();
+  delete mpscDisruptor<Producer>;
+  mpscDisruptor<Producer> = nullptr;
+}
+
+template <disruptor::dsl::ProducerType Producer>
+void mpsc(benchmark::State& state) {
+  auto& ringBuffer = mpscDisruptor<Producer>->getRingBuffer();
+  for (auto _ : state) {
+    const int64_t sequence = ringBuffer.next();
+    ringBuffer.get(sequence).value = 0;
+    ringBuffer.publish(sequence);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+benchmark::internal::Benchmark* producerCounts(benchmark::internal::Benchmark* b) {
+  b->Threads(1)->Threads(2)->Threads(4)->Threads(8)->Threads(16);
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}
+
+using MultiT = disruptor::MultiProducerSequencer<WS>;
+using CombiningT = disruptor::CombiningMultiProducerSequencer<WS>;
+constexpr auto kMulti = disruptor::dsl::ProducerType::MULTI;
+constexpr auto kCombining = disruptor::dsl::ProducerType::MULTI_COMBINING;
+}  // namespace
+
+static auto* bm_MultiProducerSequencer_Claim = [] {
+  auto* b = benchmark::RegisterBenchmark("MultiProducerSequencer_Claim", &claim<MultiT>);
+  b->Setup(setupClaim<MultiT>)->Teardown(teardownClaim<MultiT>);
+  return producerCounts(b);
+}();
+
+static auto* bm_CombiningMultiProducerSequencer_Claim = [] {
+  auto* b =
+    benchmark::RegisterBenchmark("CombiningMultiProducerSequencer_Claim", &claim<CombiningT>);
+  b->Setup(setupClaim<CombiningT>)->Teardown(teardownClaim<CombiningT>);
+  return producerCounts(b);
+}();
+
+static auto* bm_MPSC_Multi = [] {
+  auto* b = benchmark::RegisterBenchmark("MPSC_Multi_producing", &mpsc<kMulti>);
+  b->Setup(setupMpsc<kMulti>)->Teardown(teardownMpsc<kMulti>);
+  return producerCounts(b);
+}();
+
+static auto* bm_MPSC_MultiCombining = [] {
+  auto* b = benchmark::RegisterBenchmark("MPSC_MultiCombining_producing", &mpsc<kCombining>);
+  b->Setup(setupMpsc<kCombining>)->Teardown(teardownMpsc<kCombining>);
+  return producerCounts(b);
+}();
@@ -0,0 +1,185 @@
+#include <benchmark/benchmark.h>
+
+#include "jmh_config.h"
+#include "jmh_util.h"
+
+#include "disruptor/AsyncEventProcessor.h"
+#include "disruptor/AsyncWaitStrategy.h"
+#include "disruptor/BatchEventProcessor.h"
+#include "disruptor/CoroutineScheduler.h"
+#include "disruptor/EventHandler.h"
+#include "disruptor/LiteBlockingWaitStrategy.h"
+#include "disruptor/RingBuffer.h"
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// kRings single-consumer rings, each summing its events. The consumers are
+// either BatchEventProcessors with a blocking wait strategy, one thread each,
+// or AsyncEventProcessors multiplexed on one CoroutineScheduler thread. Each
+// operation publishes kBatchSize events to every ring and waits until all
+// consumers have caught up; real time, since that work is on consumer threads.
+
+namespace {
+constexpr int kRings = 16;
+constexpr int kBufferSize = 1 << 12;
+constexpr int kBatchSize = 256;
+
+using Event = disruptor::bench::jmh::SimpleEvent;
+
+struct Sum final : public disruptor::EventHandler<Event> {
+  int64_t sum{0};
+
+  void onEvent(Event& event, int64_t, bool) override {
+    sum += event.value;
+  }
+};
+
+template <typename WS>
+using RingBufferFor = disruptor::SingleProducerRingBuffer<Event, WS>;
+
+template <typename WS>
+using BarrierFor =
+  std::remove_reference_t<decltype(*std::declval<RingBufferFor<WS>&>().newBarrier())>;
+
+template <typename WS>
+struct Ring {
+  std::shared_ptr<RingBufferFor<WS>> ringBuffer;
+  std::shared_ptr<BarrierFor<WS>> barrier;
+  Sum handler;
+};
+
+struct ThreadConsumers {
+  using WS = disruptor::LiteBlockingWaitStrategy;
+  using Processor = disruptor::BatchEventProcessor<Event, BarrierFor<WS>>;
+
+  WS ws;
+  std::vector<std::unique_ptr<Ring<WS>>> rings;
+  std::vector<std::unique_ptr<Processor>> processors;
+  std::vector<std::thread> threads;
+
+  void start() {
+    for (auto& ring : rings) {
+      processors.push_back(std::make_unique<Processor>(*ring->ringBuffer, *ring->barrier,
+                                                       ring->handler,
+                                                       std::numeric_limits<int>::max(), nullptr));
+      ring->ringBuffer->addGatingSequences(processors.back()->getSequence());
+    }
+    for (auto& processor : processors) {
+      threads.emplace_back([&processor] { processor->run(); });
+    }
+  }
+
+  void stop() {
+    for (auto& processor : processors) {
+      processor->halt();
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+};
+
+struct CoroutineConsumers {
+  using WS = disruptor::AsyncWaitStrategy;
+  using Processor = disruptor::AsyncEventProcessor<Event, BarrierFor<WS>, RingBufferFor<WS>>;
+
+  WS ws;
+  std::vector<std::unique_ptr<Ring<WS>>> rings;
+  std::vector<std::unique_ptr<Processor>> processors;
+  disruptor::CoroutineScheduler scheduler;
+  std::thread thread;
+
+  void start() {
+    for (auto& ring : rings) {
+      processors.push_back(
+        std::make_unique<Processor>(*ring->ringBuffer, *ring->barrier, ws, ring->handler));
+      ring->ringBuffer->addGatingSequences(processors.back()->getSequence());
+      scheduler.spawn(processors.back()->run());
+    }
+    thread = std::thread([this] { scheduler.run(); });
+  }
+
+  void stop() {
+    for (auto& processor : processors) {
+      processor->halt();
+    }
+    thread.join();
+  }
+};
+
+template <typename Consumers>
+Consumers* consumers = nullptr;
+
+template <typename Consumers>
+void setup(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  auto* instance = new Consumers();
+  auto factory = std::make_shared<disruptor::bench::jmh::SimpleEventFactory>();
+  for (int i = 0; i < kRings; ++i) {
+    auto ring = std::make_unique<Ring<typename Consumers::WS>>();
+    ring->ringBuffer =
+      RingBufferFor<typename Consumers::WS>::createSingleProducer(factory, kBufferSize,
+                                                                  instance->ws);
+    ring->barrier = ring->ringBuffer->newBarrier();
+    instance->rings.push_back(std::move(ring));
+  }
+  instance->start();
+  consumers<Consumers> = instance;
+}
+
+template <typename Consumers>
+void teardown(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  consumers<Consumers>->stop();
+  delete consumers<Consumers>;
+  consumers<Consumers> = nullptr;
+}
+
+template <typename Consumers>
+void producing(benchmark::State& state) {
+  Consumers& instance = *consumers<Consumers>;
+  for (auto _ : state) {
+    int64_t hi = 0;
+    for (auto& ring : instance.rings) {
+      auto claim = ring->ringBuffer->claimSpan(kBatchSize);
+      for (std::size_t i = 0; i < claim.size(); ++i) {
+        claim[i].value = static_cast<int64_t>(i);
+      }
+      ring->ringBuffer->publish(claim);
+      hi = claim.hi;
+    }
+    for (auto& processor : instance.processors) {
+      while (processor->getSequence().get() < hi) {
+        std::this_thread::yield();
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kRings * kBatchSize);
+}
+}  // namespace
+
+static auto* bm_ManyRings_ThreadPerConsumer = [] {
+  auto* b = benchmark::RegisterBenchmark("ManyRings_ThreadPerConsumer",
+                                         &producing<ThreadConsumers>);
+  b->Setup(setup<ThreadConsumers>)->Teardown(teardown<ThreadConsumers>);
+  b->UseRealTime();
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}();
+
+static auto* bm_ManyRings_CoroutineScheduler = [] {
+  auto* b = benchmark::RegisterBenchmark("ManyRings_CoroutineScheduler",
+                                         &producing<CoroutineConsumers>);
+  b->Setup(setup<CoroutineConsumers>)->Teardown(teardown<CoroutineConsumers>);
+  b->UseRealTime();
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}();
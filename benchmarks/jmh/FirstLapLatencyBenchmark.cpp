@@ -0,0 +1,110 @@
+#include <benchmark/benchmark.h>
+
+#include "jmh_config.h"
+
+#include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/EventFactory.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/util/MappedAllocator.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <system_error>
+#include <vector>
+
+// Per-publish latency over the first lap of a freshly built 64 MB
+// multi-producer ring (1M x 64-byte events), for different MemoryPolicy
+// settings. Reports p50/p99 as counters; the benchmark time is the whole lap.
+
+namespace {
+constexpr int kRingSize = 1 << 20;
+
+struct alignas(64) PaddedEvent {
+  int64_t value{0};
+  std::array<std::byte, 56> payload{};
+};
+
+struct PaddedEventFactory final : public disruptor::EventFactory<PaddedEvent> {
+  PaddedEvent newInstance() override {
+    return PaddedEvent();
+  }
+};
+
+using WS = disruptor::BusySpinWaitStrategy;
+using RingBufferType = disruptor::MultiProducerRingBuffer<PaddedEvent, WS>;
+
+void firstLap(benchmark::State& state, disruptor::util::MemoryPolicy policy) {
+  WS ws;
+  auto factory = std::make_shared<PaddedEventFactory>();
+  std::vector<int64_t> latencies(static_cast<size_t>(kRingSize));
+  std::vector<int64_t> p99s;
+  std::vector<int64_t> p50s;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::shared_ptr<RingBufferType> ringBuffer;
+    try {
+      ringBuffer = RingBufferType::createMultiProducer(factory, kRingSize, ws, policy);
+    } catch (const std::system_error& e) {
+      state.SkipWithError(e.what());
+      break;
+    }
+    state.ResumeTiming();
+
+    for (int i = 0; i < kRingSize; ++i) {
+      const auto start = std::chrono::steady_clock::now();
+      const int64_t sequence = ringBuffer->next();
+      ringBuffer->get(sequence).value = sequence;
+      ringBuffer->publish(sequence);
+      const auto end = std::chrono::steady_clock::now();
+      latencies[static_cast<size_t>(i)] =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    }
+
+    state.PauseTiming();
+    auto p50 = latencies.begin() + kRingSize / 2;
+    std::nth_element(latencies.begin(), p50, latencies.end());
+    p50s.push_back(*p50);
+    auto p99 = latencies.begin() + static_cast<std::ptrdiff_t>(kRingSize * 0.99);
+    std::nth_element(p50, p99, latencies.end());
+    p99s.push_back(*p99);
+    ringBuffer.reset();
+    state.ResumeTiming();
+  }
+
+  if (!p99s.empty()) {
+    state.counters["p50_ns"] = static_cast<double>(*std::max_element(p50s.begin(), p50s.end()));
+    state.counters["p99_ns"] = static_cast<double>(*std::max_element(p99s.begin(), p99s.end()));
+  }
+  state.SetItemsProcessed(state.iterations() * kRingSize);
+}
+
+disruptor::util::MemoryPolicy hugePages(bool prefault, bool lock) {
+  disruptor::util::MemoryPolicy policy;
+  policy.pageSize = disruptor::util::PageSize::HUGE_2MB;
+  policy.prefault = prefault;
+  policy.lock = lock;
+  return policy;
+}
+}  // namespace
+
+static auto* bm_FirstLap_Heap = [] {
+  auto* b =
+    benchmark::RegisterBenchmark("FirstLap_Heap", &firstLap, disruptor::util::MemoryPolicy{});
+  return disruptor::bench::jmh::applyJmhDefaults(b->Iterations(5)->Unit(benchmark::kMillisecond));
+}();
+
+static auto* bm_FirstLap_HugePages = [] {
+  auto* b = benchmark::RegisterBenchmark("FirstLap_HugePages", &firstLap, hugePages(false, false));
+  return disruptor::bench::jmh::applyJmhDefaults(b->Iterations(5)->Unit(benchmark::kMillisecond));
+}();
+
+static auto* bm_FirstLap_HugePagesPrefaultLocked = [] {
+  auto* b = benchmark::RegisterBenchmark(
+    "FirstLap_HugePagesPrefaultLocked", &firstLap, hugePages(true, true));
+  return disruptor::bench::jmh::applyJmhDefaults(b->Iterations(5)->Unit(benchmark::kMillisecond));
+}();
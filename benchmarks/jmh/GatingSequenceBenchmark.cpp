@@ -0,0 +1,111 @@
+#include <benchmark/benchmark.h>
+
+#include "jmh_config.h"
+
+#include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/GatingSequenceRegistry.h"
+#include "disruptor/MultiProducerSequencer.h"
+#include "disruptor/Sequence.h"
+#include "disruptor/util/Util.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Producers reading the gating sequences concurrently, as on every wrap check
+// of a multi-producer ring. Four gating sequences, threads = producers.
+//
+// - AtomicSharedPtr: the previous std::atomic<std::shared_ptr<vector>> load
+//   (lock bit + reference count on a shared line) + Util::getMinimumSequence.
+// - Registry: GatingSequenceRegistry::minimumSequence (plain loads).
+// - MultiProducerSequencer_HasAvailableCapacity: the sequencer's wrap check,
+//   forced past its cached minimum on every call.
+
+namespace {
+constexpr int kGatingSequences = 4;
+
+std::array<disruptor::Sequence, kGatingSequences> gatingSequences;
+
+std::vector<disruptor::Sequence*> gatingPointers() {
+  std::vector<disruptor::Sequence*> pointers;
+  for (auto& sequence : gatingSequences) {
+    pointers.push_back(&sequence);
+  }
+  return pointers;
+}
+
+std::atomic<std::shared_ptr<std::vector<disruptor::Sequence*>>> sharedSnapshot{
+  std::make_shared<std::vector<disruptor::Sequence*>>(gatingPointers())};
+
+disruptor::GatingSequenceRegistry& registry() {
+  static disruptor::GatingSequenceRegistry instance;
+  static const bool filled = [] {
+    const auto pointers = gatingPointers();
+    instance.add(pointers.data(), kGatingSequences);
+    return true;
+  }();
+  (void)filled;
+  return instance;
+}
+
+using WS = disruptor::BusySpinWaitStrategy;
+
+disruptor::MultiProducerSequencer<WS>& sequencer() {
+  static WS ws;
+  // One slot: the wrap point always passes the cached minimum.
+  static disruptor::MultiProducerSequencer<WS> instance(1, ws);
+  static const bool gated = [] {
+    const auto pointers = gatingPointers();
+    instance.addGatingSequences(pointers.data(), kGatingSequences);
+    return true;
+  }();
+  (void)gated;
+  return instance;
+}
+
+void atomicSharedPtr(benchmark::State& state) {
+  for (auto _ : state) {
+    auto snapshot = sharedSnapshot.load(std::memory_order_acquire);
+    benchmark::DoNotOptimize(disruptor::util::Util::getMinimumSequence(*snapshot, INT64_MAX));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void gatingRegistry(benchmark::State& state) {
+  auto& gating = registry();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(gating.minimumSequence(INT64_MAX));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void hasAvailableCapacity(benchmark::State& state) {
+  auto& ringSequencer = sequencer();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ringSequencer.hasAvailableCapacity(2));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+benchmark::internal::Benchmark* producers(benchmark::internal::Benchmark* b) {
+  return disruptor::bench::jmh::applyJmhDefaults(b->Threads(1)->Threads(2)->Threads(4));
+}
+}  // namespace
+
+static auto* bm_GatingSequences_AtomicSharedPtr = [] {
+  auto* b = benchmark::RegisterBenchmark("GatingSequences_AtomicSharedPtr", &atomicSharedPtr);
+  return producers(b);
+}();
+
+static auto* bm_GatingSequences_Registry = [] {
+  auto* b = benchmark::RegisterBenchmark("GatingSequences_Registry", &gatingRegistry);
+  return producers(b);
+}();
+
+static auto* bm_MultiProducerSequencer_HasAvailableCapacity = [] {
+  auto* b = benchmark::RegisterBenchmark("MultiProducerSequencer_HasAvailableCapacity",
+                                         &hasAvailableCapacity);
+  return producers(b);
+}();
@@ -0,0 +1,114 @@
+#include <benchmark/benchmark.h>
+
+#include "jmh_config.h"
+
+#include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/GatingTree.h"
+#include "disruptor/MultiProducerSequencer.h"
+#include "disruptor/Sequence.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Flat gating (one gating Sequence per consumer) vs a GatingTree with fan-in
+// 8. Arg = consumers.
+//
+// - *_WrapCheck: the producer's MultiProducerSequencer::hasAvailableCapacity,
+//   forced past its cached minimum on every call (one-slot ring).
+// - *_Publish: the consumer side, members advancing round-robin so the
+//   slowest one moves every time (worst case for the tree's upkeep).
+
+namespace {
+constexpr int kFanIn = 8;
+
+using WS = disruptor::BusySpinWaitStrategy;
+using SequencerT = disruptor::MultiProducerSequencer<WS>;
+
+void flatWrapCheck(benchmark::State& state) {
+  const int consumers = static_cast<int>(state.range(0));
+  std::vector<std::unique_ptr<disruptor::Sequence>> sequences;
+  std::vector<disruptor::Sequence*> pointers;
+  for (int i = 0; i < consumers; ++i) {
+    sequences.push_back(std::make_unique<disruptor::Sequence>());
+    pointers.push_back(sequences.back().get());
+  }
+  WS ws;
+  SequencerT sequencer(1, ws);
+  sequencer.addGatingSequences(pointers.data(), consumers);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(sequencer.hasAvailableCapacity(2));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void treeWrapCheck(benchmark::State& state) {
+  disruptor::GatingTree tree(static_cast<int>(state.range(0)), kFanIn);
+  WS ws;
+  SequencerT sequencer(1, ws);
+  sequencer.addGatingSequences(tree);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(sequencer.hasAvailableCapacity(2));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void flatPublish(benchmark::State& state) {
+  const int consumers = static_cast<int>(state.range(0));
+  std::vector<std::unique_ptr<disruptor::Sequence>> sequences;
+  for (int i = 0; i < consumers; ++i) {
+    sequences.push_back(std::make_unique<disruptor::Sequence>());
+  }
+  int64_t value = 0;
+  int member = 0;
+  for (auto _ : state) {
+    sequences[static_cast<std::size_t>(member)]->set(value);
+    if (++member == consumers) {
+      member = 0;
+      ++value;
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void treePublish(benchmark::State& state) {
+  const int consumers = static_cast<int>(state.range(0));
+  disruptor::GatingTree tree(consumers, kFanIn);
+  tree.reset(-1);
+  int64_t value = 0;
+  int member = 0;
+  for (auto _ : state) {
+    tree.publish(member, value);
+    if (++member == consumers) {
+      member = 0;
+      ++value;
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+benchmark::internal::Benchmark* fanOut(benchmark::internal::Benchmark* b) {
+  return disruptor::bench::jmh::applyJmhDefaults(b->Arg(8)->Arg(64));
+}
+}  // namespace
+
+static auto* bm_GatingFlat_WrapCheck = [] {
+  auto* b = benchmark::RegisterBenchmark("GatingFlat_WrapCheck", &flatWrapCheck);
+  return fanOut(b);
+}();
+
+static auto* bm_GatingTree_WrapCheck = [] {
+  auto* b = benchmark::RegisterBenchmark("GatingTree_WrapCheck", &treeWrapCheck);
+  return fanOut(b);
+}();
+
+static auto* bm_GatingFlat_Publish = [] {
+  auto* b = benchmark::RegisterBenchmark("GatingFlat_Publish", &flatPublish);
+  return fanOut(b);
+}();
+
+static auto* bm_GatingTree_Publish = [] {
+  auto* b = benchmark::RegisterBenchmark("GatingTree_Publish", &treePublish);
+  return fanOut(b);
+}();
@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+
+#include "jmh_config.h"
+#include "jmh_util.h"
+
+#include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/MultiLaneEventProcessor.h"
+#include "disruptor/MultiLaneRingBuffer.h"
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+// Single-event multi-producer publishing into a MultiLaneRingBuffer (one SPSC
+// lane per producer, one MultiLaneEventProcessor merging them), at the same
+// producer counts as MPSC_Multi_producing in CombiningSequencerBenchmark.cpp,
+// which is the shared-cursor baseline. Threads = producers = lanes.
+
+namespace {
+constexpr int kLaneSize = 1 << 20;
+
+using WS = disruptor::BusySpinWaitStrategy;
+using RingBufferT = disruptor::MultiLaneRingBuffer<disruptor::bench::jmh::SimpleEvent, WS>;
+using ProcessorT = disruptor::MultiLaneEventProcessor<disruptor::bench::jmh::SimpleEvent, WS>;
+
+// One ring and consumer per benchmark run, created by thread 0.
+std::shared_ptr<RingBufferT> ringBuffer;
+std::shared_ptr<RingBufferT::BarrierT> barrier;
+ProcessorT* processor = nullptr;
+std::thread* consumer = nullptr;
+disruptor::bench::jmh::ConsumeHandler handler;
+
+void setup(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  static WS ws;
+  auto factory = std::make_shared<disruptor::bench::jmh::SimpleEventFactory>();
+  ringBuffer = RingBufferT::create(factory, state.threads(), kLaneSize, ws);
+  barrier = ringBuffer->newBarrier();
+  processor = new ProcessorT(*ringBuffer, *barrier, handler);
+  ringBuffer->addGatingSequences(processor->getSequences());
+  consumer = new std::thread([] { processor->run(); });
+}
+
+void teardown(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  processor->halt();
+  consumer->join();
+  delete consumer;
+  consumer = nullptr;
+  delete processor;
+  processor = nullptr;
+  barrier.reset();
+  ringBuffer.reset();
+}
+
+void producing(benchmark::State& state) {
+  auto& lane = ringBuffer->registerProducer();
+  for (auto _ : state) {
+    const int64_t sequence = lane.next();
+    lane.get(sequence).value = 0;
+    lane.publish(sequence);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+}  // namespace
+
+static auto* bm_MPSC_MultiLane = [] {
+  auto* b = benchmark::RegisterBenchmark("MPSC_MultiLane_producing", &producing);
+  b->Threads(1)->Threads(2)->Threads(4)->Threads(8)->Threads(16);
+  b->Setup(setup)->Teardown(teardown);
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}();
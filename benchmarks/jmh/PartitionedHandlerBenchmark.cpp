@@ -0,0 +1,133 @@
+#include <benchmark/benchmark.h>
+
+#include "jmh_config.h"
+#include "jmh_util.h"
+
+#include "disruptor/EventHandler.h"
+#include "disruptor/PartitionedEventHandler.h"
+#include "disruptor/YieldingWaitStrategy.h"
+#include "disruptor/dsl/Disruptor.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+// Single-producer publishing keyed events to 4 handlers that each own a
+// quarter of the keys. Tagged: handleEventsWithPartitioned, the producer tags
+// each sequence in a PartitionTags side array and a handler only loads its
+// own events. KeyFilter: a plain handleEventsWith group in which every handler
+// loads every event to compare its key. Yielding wait strategy so idle
+// handlers give up the CPU on small machines.
+
+namespace {
+constexpr int kBufferSize = 1 << 16;
+constexpr int kPartitions = 4;
+
+using WS = disruptor::YieldingWaitStrategy;
+using DisruptorType = disruptor::dsl::Disruptor<disruptor::bench::jmh::SimpleEvent,
+                                                disruptor::dsl::ProducerType::SINGLE,
+                                                WS>;
+
+struct PartitionHandler final : public disruptor::EventHandler<disruptor::bench::jmh::SimpleEvent> {
+  void onEvent(disruptor::bench::jmh::SimpleEvent& event, int64_t, bool) override {
+    benchmark::DoNotOptimize(event.value);
+  }
+};
+
+struct KeyFilterHandler final : public disruptor::EventHandler<disruptor::bench::jmh::SimpleEvent> {
+  int64_t key{0};
+
+  void onEvent(disruptor::bench::jmh::SimpleEvent& event, int64_t, bool) override {
+    if (event.value % kPartitions == key) {
+      benchmark::DoNotOptimize(event.value);
+    }
+  }
+};
+
+DisruptorType* disruptorInstance = nullptr;
+disruptor::PartitionTags* tagsInstance = nullptr;
+std::array<PartitionHandler, kPartitions> partitionHandlers;
+std::array<KeyFilterHandler, kPartitions> keyFilterHandlers;
+
+DisruptorType* newDisruptor() {
+  static WS ws;
+  auto factory = std::make_shared<disruptor::bench::jmh::SimpleEventFactory>();
+  return new DisruptorType(factory, kBufferSize, disruptor::util::DaemonThreadFactory::INSTANCE(),
+                           ws);
+}
+
+void setupTagged(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  disruptorInstance = newDisruptor();
+  tagsInstance = new disruptor::PartitionTags(kBufferSize, kPartitions);
+  [&]<std::size_t... I>(std::index_sequence<I...>) {
+    disruptorInstance->handleEventsWithPartitioned(*tagsInstance, partitionHandlers[I]...);
+  }(std::make_index_sequence<kPartitions>{});
+  disruptorInstance->start();
+}
+
+void setupKeyFilter(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  disruptorInstance = newDisruptor();
+  [&]<std::size_t... I>(std::index_sequence<I...>) {
+    ((keyFilterHandlers[I].key = static_cast<int64_t>(I)), ...);
+    disruptorInstance->handleEventsWith(keyFilterHandlers[I]...);
+  }(std::make_index_sequence<kPartitions>{});
+  disruptorInstance->start();
+}
+
+void teardown(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  disruptorInstance->halt();
+  delete disruptorInstance;
+  disruptorInstance = nullptr;
+  delete tagsInstance;
+  tagsInstance = nullptr;
+}
+
+void producingTagged(benchmark::State& state) {
+  auto& ringBuffer = disruptorInstance->getRingBuffer();
+  int64_t key = 0;
+  for (auto _ : state) {
+    const int64_t sequence = ringBuffer.next();
+    ringBuffer.get(sequence).value = key;
+    tagsInstance->tag(sequence, static_cast<std::uint64_t>(key));
+    ringBuffer.publish(sequence);
+    ++key;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void producingKeyFilter(benchmark::State& state) {
+  auto& ringBuffer = disruptorInstance->getRingBuffer();
+  int64_t key = 0;
+  for (auto _ : state) {
+    const int64_t sequence = ringBuffer.next();
+    ringBuffer.get(sequence).value = key;
+    ringBuffer.publish(sequence);
+    ++key;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+}  // namespace
+
+static auto* bm_Partitioned_Tagged = [] {
+  auto* b = benchmark::RegisterBenchmark("Partitioned4_Tagged", &producingTagged);
+  b->Setup(setupTagged)->Teardown(teardown);
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}();
+
+static auto* bm_Partitioned_KeyFilter = [] {
+  auto* b = benchmark::RegisterBenchmark("Partitioned4_KeyFilter", &producingKeyFilter);
+  b->Setup(setupKeyFilter)->Teardown(teardown);
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}();
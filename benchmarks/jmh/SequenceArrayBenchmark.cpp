@@ -0,0 +1,102 @@
+#include <benchmark/benchmark.h>
+
+#include "jmh_config.h"
+
+#include "disruptor/FixedSequenceGroup.h"
+#include "disruptor/GatingSequenceRegistry.h"
+#include "disruptor/Sequence.h"
+#include "disruptor/SequenceArray.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+// Producer wrap check (GatingSequenceRegistry::minimumSequence) and consumer
+// barrier (FixedSequenceGroup::get) over a wide fan-out. Arg = consumers.
+//
+// - Separate: one heap-allocated Sequence per consumer (the processors' own).
+// - SequenceArray: the consumers' Sequences in one SequenceArray, as the DSL
+//   allocates them for a handler group.
+
+namespace {
+constexpr int64_t kMax = (std::numeric_limits<int64_t>::max)();
+
+struct SeparateSequences {
+  explicit SeparateSequences(int count) {
+    for (int i = 0; i < count; ++i) {
+      // Interleave with unrelated allocations, as processor objects would be.
+      owned.push_back(std::make_unique<disruptor::Sequence>(i));
+      padding.push_back(std::make_unique<std::byte[]>(1024));
+      pointers.push_back(owned.back().get());
+    }
+  }
+
+  std::vector<std::unique_ptr<disruptor::Sequence>> owned;
+  std::vector<std::unique_ptr<std::byte[]>> padding;
+  std::vector<disruptor::Sequence*> pointers;
+};
+
+struct ArraySequences {
+  explicit ArraySequences(int count) : array(count) {
+    for (int i = 0; i < count; ++i) {
+      array[i].set(i);
+      pointers.push_back(&array[i]);
+    }
+  }
+
+  disruptor::SequenceArray array;
+  std::vector<disruptor::Sequence*> pointers;
+};
+
+template <typename SequencesT>
+void gatingMinimum(benchmark::State& state) {
+  const int count = static_cast<int>(state.range(0));
+  SequencesT sequences(count);
+  disruptor::GatingSequenceRegistry registry;
+  registry.add(sequences.pointers.data(), count);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(registry.minimumSequence(kMax));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename SequencesT>
+void barrierGroup(benchmark::State& state) {
+  const int count = static_cast<int>(state.range(0));
+  SequencesT sequences(count);
+  disruptor::FixedSequenceGroup group(sequences.pointers.data(), count);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(group.get());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+benchmark::internal::Benchmark* fanOut(benchmark::internal::Benchmark* b) {
+  return disruptor::bench::jmh::applyJmhDefaults(b->Arg(8)->Arg(32)->Arg(64));
+}
+}  // namespace
+
+static auto* bm_GatingMinimum_Separate = [] {
+  auto* b = benchmark::RegisterBenchmark("GatingMinimum_Separate",
+                                         &gatingMinimum<SeparateSequences>);
+  return fanOut(b);
+}();
+
+static auto* bm_GatingMinimum_SequenceArray = [] {
+  auto* b = benchmark::RegisterBenchmark("GatingMinimum_SequenceArray",
+                                         &gatingMinimum<ArraySequences>);
+  return fanOut(b);
+}();
+
+static auto* bm_BarrierGroup_Separate = [] {
+  auto* b = benchmark::RegisterBenchmark("BarrierGroup_Separate", &barrierGroup<SeparateSequences>);
+  return fanOut(b);
+}();
+
+static auto* bm_BarrierGroup_SequenceArray = [] {
+  auto* b =
+    benchmark::RegisterBenchmark("BarrierGroup_SequenceArray", &barrierGroup<ArraySequences>);
+  return fanOut(b);
+}();
@@ -0,0 +1,148 @@
+#include <benchmark/benchmark.h>
+
+#include "jmh_config.h"
+
+#include "disruptor/Sequence.h"
+#include "disruptor/SequenceGroupView.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+// What a non-virtual Sequence saves on the paths that read one per step:
+// a consumer's waitFor on an upstream Sequence, a producer's wrap check on a
+// gating Sequence, and a barrier over three upstream stages.
+//
+// - Virtual: the Sequence this port had before, with virtual get()/set() and
+//   the dependency group as a subclass overriding get(), called through a
+//   base pointer the compiler cannot see through.
+// - Final: disruptor::Sequence and SequenceGroupView<3>.
+
+namespace {
+
+class alignas(128) VirtualSequence {
+public:
+  explicit VirtualSequence(int64_t initial) noexcept : value_(initial) {}
+
+  virtual ~VirtualSequence() = default;
+
+  virtual int64_t get() const {
+    int64_t value = value_.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return value;
+  }
+
+  virtual void set(int64_t v) {
+    std::atomic_thread_fence(std::memory_order_release);
+    value_.store(v, std::memory_order_relaxed);
+  }
+
+private:
+  std::atomic<int64_t> value_;
+};
+
+class VirtualGroup final : public VirtualSequence {
+public:
+  explicit VirtualGroup(std::vector<VirtualSequence*> sequences)
+    : VirtualSequence(-1), sequences_(std::move(sequences)) {}
+
+  int64_t get() const override {
+    int64_t minimum = (std::numeric_limits<int64_t>::max)();
+    for (const VirtualSequence* sequence : sequences_) {
+      minimum = (std::min)(minimum, sequence->get());
+    }
+    return minimum;
+  }
+
+private:
+  std::vector<VirtualSequence*> sequences_;
+};
+
+template <typename SequenceT>
+void readSequence(benchmark::State& state) {
+  SequenceT sequence(42);
+  SequenceT* pointer = &sequence;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(pointer);
+    benchmark::DoNotOptimize(pointer->get());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename SequenceT>
+void wrapCheck(benchmark::State& state) {
+  SequenceT cursor(-1);
+  SequenceT gating(-1);
+  SequenceT* cursorPointer = &cursor;
+  SequenceT* gatingPointer = &gating;
+  int64_t next = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cursorPointer);
+    benchmark::DoNotOptimize(gatingPointer);
+    benchmark::DoNotOptimize(gatingPointer->get() >= next - 1024);
+    cursorPointer->set(next++);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void barrierGroupVirtual(benchmark::State& state) {
+  VirtualSequence first(3);
+  VirtualSequence second(1);
+  VirtualSequence third(2);
+  VirtualGroup group({&first, &second, &third});
+  const VirtualSequence* pointer = &group;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(pointer);
+    benchmark::DoNotOptimize(pointer->get());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void barrierGroupFinal(benchmark::State& state) {
+  disruptor::Sequence first(3);
+  disruptor::Sequence second(1);
+  disruptor::Sequence third(2);
+  disruptor::SequenceGroupView<3> group(
+    std::array<disruptor::Sequence*, 3>{&first, &second, &third});
+  const disruptor::SequenceGroupView<3>* pointer = &group;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(pointer);
+    benchmark::DoNotOptimize(pointer->get());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+}  // namespace
+
+static auto* bm_ReadSequence_Virtual = [] {
+  auto* b = benchmark::RegisterBenchmark("ReadSequence_Virtual", &readSequence<VirtualSequence>);
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}();
+
+static auto* bm_ReadSequence_Final = [] {
+  auto* b = benchmark::RegisterBenchmark("ReadSequence_Final", &readSequence<disruptor::Sequence>);
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}();
+
+static auto* bm_WrapCheck_Virtual = [] {
+  auto* b = benchmark::RegisterBenchmark("WrapCheck_Virtual", &wrapCheck<VirtualSequence>);
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}();
+
+static auto* bm_WrapCheck_Final = [] {
+  auto* b = benchmark::RegisterBenchmark("WrapCheck_Final", &wrapCheck<disruptor::Sequence>);
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}();
+
+static auto* bm_BarrierGroup_Virtual = [] {
+  auto* b = benchmark::RegisterBenchmark("BarrierGroup_Virtual", &barrierGroupVirtual);
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}();
+
+static auto* bm_BarrierGroup_Final = [] {
+  auto* b = benchmark::RegisterBenchmark("BarrierGroup_Final", &barrierGroupFinal);
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}();
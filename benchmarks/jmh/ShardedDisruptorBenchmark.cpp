@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+
+#include "jmh_config.h"
+#include "jmh_util.h"
+
+#include "disruptor/EventTranslatorOneArg.h"
+#include "disruptor/YieldingWaitStrategy.h"
+#include "disruptor/dsl/ShardedDisruptor.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+// Multi-producer publishing through a ShardedDisruptor, keyed by producer
+// thread so each producer stays on one shard. Shards1 is a single ring (the
+// shared-cursor baseline), Shards4 spreads producers over 4 rings. Batch64
+// publishes 64 keys per publishEvents call, split across all 4 shards.
+// Threads = producers; one ConsumeHandler per shard, yielding wait strategy.
+
+namespace {
+constexpr int kBufferSize = 1 << 16;
+constexpr int kBatch = 64;
+
+struct IdentityKey {
+  std::uint64_t operator()(int64_t key) const {
+    return static_cast<std::uint64_t>(key);
+  }
+};
+
+struct KeyTranslator final
+  : public disruptor::EventTranslatorOneArg<disruptor::bench::jmh::SimpleEvent, int64_t> {
+  void translateTo(disruptor::bench::jmh::SimpleEvent& event, int64_t, int64_t key) override {
+    event.value = key;
+  }
+};
+
+using WS = disruptor::YieldingWaitStrategy;
+using ShardedType = disruptor::dsl::ShardedDisruptor<disruptor::bench::jmh::SimpleEvent,
+                                                     disruptor::dsl::ProducerType::MULTI,
+                                                     WS,
+                                                     IdentityKey>;
+
+ShardedType* shardedInstance = nullptr;
+std::array<disruptor::bench::jmh::ConsumeHandler, 4> handlers;
+
+template <int Shards>
+void setup(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  auto factory = std::make_shared<disruptor::bench::jmh::SimpleEventFactory>();
+  shardedInstance = new ShardedType(factory, Shards, kBufferSize,
+                                    disruptor::util::DaemonThreadFactory::INSTANCE());
+  for (int s = 0; s < Shards; ++s) {
+    shardedInstance->shard(s).handleEventsWith(handlers[static_cast<std::size_t>(s)]);
+  }
+  shardedInstance->start();
+}
+
+void teardown(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  shardedInstance->halt();
+  delete shardedInstance;
+  shardedInstance = nullptr;
+}
+
+void producing(benchmark::State& state) {
+  KeyTranslator translator;
+  const auto key = static_cast<int64_t>(state.thread_index());
+  for (auto _ : state) {
+    shardedInstance->publishEvent(translator, key);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void producingBatch(benchmark::State& state) {
+  KeyTranslator translator;
+  std::vector<int64_t> keys(kBatch);
+  for (int i = 0; i < kBatch; ++i) {
+    keys[static_cast<std::size_t>(i)] = i;
+  }
+  for (auto _ : state) {
+    shardedInstance->publishEvents(translator, std::span<const int64_t>(keys));
+  }
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+
+benchmark::internal::Benchmark* registerSharded(const char* name,
+                                                void (*fn)(benchmark::State&),
+                                                void (*setupFn)(const benchmark::State&)) {
+  auto* b = benchmark::RegisterBenchmark(name, fn);
+  b->Setup(setupFn)->Teardown(teardown);
+  b->Threads(1)->Threads(2)->Threads(4);
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}
+}  // namespace
+
+static auto* bm_Sharded_Shards1 =
+  registerSharded("Sharded_Shards1_producing", &producing, &setup<1>);
+static auto* bm_Sharded_Shards4 =
+  registerSharded("Sharded_Shards4_producing", &producing, &setup<4>);
+static auto* bm_Sharded_Shards4_Batch =
+  registerSharded("Sharded_Shards4_Batch64_producing", &producingBatch, &setup<4>);
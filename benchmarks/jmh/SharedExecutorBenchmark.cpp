@@ -0,0 +1,128 @@
+#include <benchmark/benchmark.h>
+
+#include "jmh_config.h"
+#include "jmh_util.h"
+
+#include "disruptor/AsyncWaitStrategy.h"
+#include "disruptor/EventHandler.h"
+#include "disruptor/LiteBlockingWaitStrategy.h"
+#include "disruptor/WorkStealingExecutor.h"
+#include "disruptor/dsl/Disruptor.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// kDisruptors low-traffic dsl::Disruptors with one summing handler each. The
+// handlers run either on a thread each (LiteBlockingWaitStrategy) or as
+// slices on one WorkStealingExecutor with kWorkers workers
+// (AsyncWaitStrategy, runConsumersOn). Each operation publishes one event to
+// every ring and waits until every handler has seen it; real time, since that
+// work is on the consumer threads.
+
+namespace {
+constexpr int kDisruptors = 32;
+constexpr int kWorkers = 2;
+constexpr int kBufferSize = 1 << 10;
+
+using Event = disruptor::bench::jmh::SimpleEvent;
+
+struct Sum final : public disruptor::EventHandler<Event> {
+  int64_t sum{0};
+
+  void onEvent(Event& event, int64_t, bool) override {
+    sum += event.value;
+  }
+};
+
+template <typename WS>
+struct Rings {
+  using DisruptorType = disruptor::dsl::Disruptor<Event, disruptor::dsl::ProducerType::SINGLE, WS>;
+
+  std::unique_ptr<disruptor::WorkStealingExecutor> executor;
+  std::vector<std::unique_ptr<WS>> waitStrategies;
+  std::vector<std::unique_ptr<Sum>> handlers;
+  std::vector<std::unique_ptr<DisruptorType>> disruptors;
+};
+
+template <typename WS>
+Rings<WS>* rings = nullptr;
+
+template <typename WS, bool kShared>
+void setup(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  auto* instance = new Rings<WS>();
+  if constexpr (kShared) {
+    instance->executor = std::make_unique<disruptor::WorkStealingExecutor>(kWorkers);
+  }
+  auto factory = std::make_shared<disruptor::bench::jmh::SimpleEventFactory>();
+  for (int i = 0; i < kDisruptors; ++i) {
+    instance->waitStrategies.push_back(std::make_unique<WS>());
+    instance->handlers.push_back(std::make_unique<Sum>());
+    instance->disruptors.push_back(std::make_unique<typename Rings<WS>::DisruptorType>(
+      factory, kBufferSize, disruptor::util::DaemonThreadFactory::INSTANCE(),
+      *instance->waitStrategies.back()));
+    auto& d = *instance->disruptors.back();
+    if constexpr (kShared) {
+      d.runConsumersOn(*instance->executor);
+    }
+    d.handleEventsWith(*instance->handlers.back());
+    d.start();
+  }
+  rings<WS> = instance;
+}
+
+template <typename WS>
+void teardown(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  for (auto& d : rings<WS>->disruptors) {
+    d->halt();
+    d->join();
+  }
+  rings<WS>->disruptors.clear();
+  delete rings<WS>;
+  rings<WS> = nullptr;
+}
+
+template <typename WS>
+void producing(benchmark::State& state) {
+  Rings<WS>& instance = *rings<WS>;
+  for (auto _ : state) {
+    int64_t sequence = 0;
+    for (auto& d : instance.disruptors) {
+      auto& ringBuffer = d->getRingBuffer();
+      sequence = ringBuffer.next();
+      ringBuffer.get(sequence).value = sequence;
+      ringBuffer.publish(sequence);
+    }
+    for (int i = 0; i < kDisruptors; ++i) {
+      while (instance.disruptors[i]->getSequenceValueFor(*instance.handlers[i]) < sequence) {
+        std::this_thread::yield();
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kDisruptors);
+}
+}  // namespace
+
+static auto* bm_LowTraffic_ThreadPerConsumer = [] {
+  using WS = disruptor::LiteBlockingWaitStrategy;
+  auto* b = benchmark::RegisterBenchmark("LowTraffic_ThreadPerConsumer", &producing<WS>);
+  b->Setup(setup<WS, false>)->Teardown(teardown<WS>);
+  b->UseRealTime();
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}();
+
+static auto* bm_LowTraffic_SharedExecutor = [] {
+  using WS = disruptor::AsyncWaitStrategy;
+  auto* b = benchmark::RegisterBenchmark("LowTraffic_SharedExecutor", &producing<WS>);
+  b->Setup(setup<WS, true>)->Teardown(teardown<WS>);
+  b->UseRealTime();
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}();
@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+
+#include "jmh_config.h"
+
+#include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/EventFactory.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/Sequence.h"
+#include "disruptor/SharedMemoryRingBuffer.h"
+#include "disruptor/util/SharedMemorySegment.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+
+// Per-event cost of the shared memory ring's claim/publish/waitFor path
+// against the heap MultiProducerSequencer ring, on one thread (publish one
+// event, then consume it through a barrier). Cross-process handoff latency is
+// this plus the cache-line transfer, as for two threads.
+
+namespace {
+constexpr int kRingSize = 1 << 16;
+
+struct Event {
+  int64_t value{0};
+};
+
+struct EventFactoryImpl final : public disruptor::EventFactory<Event> {
+  Event newInstance() override {
+    return Event();
+  }
+};
+
+using WS = disruptor::BusySpinWaitStrategy;
+
+void heapRing(benchmark::State& state) {
+  WS ws;
+  auto ringBuffer = disruptor::MultiProducerRingBuffer<Event, WS>::createMultiProducer(
+    std::make_shared<EventFactoryImpl>(), kRingSize, ws);
+  disruptor::Sequence consumer;
+  const std::array<disruptor::Sequence*, 1> gating{&consumer};
+  ringBuffer->addGatingSequences(gating.data(), 1);
+  auto barrier = ringBuffer->newBarrier(nullptr, 0);
+  for (auto _ : state) {
+    const int64_t sequence = ringBuffer->next();
+    ringBuffer->get(sequence).value = sequence;
+    ringBuffer->publish(sequence);
+    const int64_t available = barrier->waitFor(sequence);
+    benchmark::DoNotOptimize(ringBuffer->get(available).value);
+    consumer.set(available);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void sharedMemoryRing(benchmark::State& state) {
+  using Ring = disruptor::SharedMemoryRingBuffer<Event, WS>;
+  WS ws;
+  auto ringBuffer = Ring::create(
+    disruptor::util::SharedMemorySegment::createAnonymous(Ring::requiredBytes(kRingSize, 1)),
+    kRingSize, 1, ws);
+  disruptor::Sequence& consumer = ringBuffer->consumerSequence(ringBuffer->addConsumer());
+  auto barrier = ringBuffer->newBarrier(nullptr, 0);
+  for (auto _ : state) {
+    const int64_t sequence = ringBuffer->next();
+    ringBuffer->get(sequence).value = sequence;
+    ringBuffer->publish(sequence);
+    const int64_t available = barrier->waitFor(sequence);
+    benchmark::DoNotOptimize(ringBuffer->get(available).value);
+    consumer.set(available);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+}  // namespace
+
+static auto* bm_RingBuffer_PublishConsume = [] {
+  auto* b = benchmark::RegisterBenchmark("RingBuffer_PublishConsume", &heapRing);
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}();
+
+static auto* bm_SharedMemoryRingBuffer_PublishConsume = [] {
+  auto* b =
+    benchmark::RegisterBenchmark("SharedMemoryRingBuffer_PublishConsume", &sharedMemoryRing);
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}();
@@ -0,0 +1,125 @@
+#include <benchmark/benchmark.h>
+
+#include "jmh_config.h"
+#include "jmh_util.h"
+
+#include "disruptor/EventTranslator.h"
+#include "disruptor/YieldingWaitStrategy.h"
+#include "disruptor/dsl/Disruptor.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+// Single-producer bulk publishing of kBatchSize events per operation.
+// Translators: RingBuffer::publishEvents with a vector of EventTranslator
+// pointers, one virtual translateTo per slot. SpanClaim: RingBuffer::claimSpan
+// and two memcpys from a prepared batch into the claimed slots. Yielding wait
+// strategy so the consumer gives up the CPU on small machines.
+//
+// *_NoConsumer: the same two paths on a bare ring without gating sequences,
+// i.e. the producer's own cost of filling and publishing a batch.
+
+namespace {
+constexpr int kBufferSize = 1 << 16;
+constexpr int kBatchSize = 100;
+
+using WS = disruptor::YieldingWaitStrategy;
+using DisruptorType = disruptor::dsl::Disruptor<disruptor::bench::jmh::SimpleEvent,
+                                                disruptor::dsl::ProducerType::SINGLE,
+                                                WS>;
+
+DisruptorType* disruptorInstance = nullptr;
+std::shared_ptr<DisruptorType::RingBufferT> ringBufferInstance;
+disruptor::bench::jmh::ConsumeHandler handler;
+
+void setup(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  static WS ws;
+  auto factory = std::make_shared<disruptor::bench::jmh::SimpleEventFactory>();
+  disruptorInstance = new DisruptorType(factory, kBufferSize,
+                                        disruptor::util::DaemonThreadFactory::INSTANCE(), ws);
+  disruptorInstance->handleEventsWith(handler);
+  ringBufferInstance = disruptorInstance->start();
+}
+
+void setupNoConsumer(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  static WS ws;
+  ringBufferInstance = DisruptorType::RingBufferT::createSingleProducer(
+    std::make_shared<disruptor::bench::jmh::SimpleEventFactory>(), kBufferSize, ws);
+}
+
+void teardown(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  ringBufferInstance.reset();
+  if (disruptorInstance != nullptr) {
+    disruptorInstance->halt();
+    delete disruptorInstance;
+    disruptorInstance = nullptr;
+  }
+}
+
+struct ValueTranslator final
+  : public disruptor::EventTranslator<disruptor::bench::jmh::SimpleEvent> {
+  int64_t value{0};
+
+  void translateTo(disruptor::bench::jmh::SimpleEvent& event, int64_t) override {
+    event.value = value;
+  }
+};
+
+void producingTranslators(benchmark::State& state) {
+  auto& ringBuffer = *ringBufferInstance;
+  std::vector<ValueTranslator> translators(kBatchSize);
+  std::vector<disruptor::EventTranslator<disruptor::bench::jmh::SimpleEvent>*> batch;
+  for (int i = 0; i < kBatchSize; ++i) {
+    translators[static_cast<std::size_t>(i)].value = i;
+    batch.push_back(&translators[static_cast<std::size_t>(i)]);
+  }
+  for (auto _ : state) {
+    ringBuffer.publishEvents(batch);
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchSize);
+}
+
+void producingSpanClaim(benchmark::State& state) {
+  auto& ringBuffer = *ringBufferInstance;
+  std::vector<disruptor::bench::jmh::SimpleEvent> batch(kBatchSize);
+  for (int i = 0; i < kBatchSize; ++i) {
+    batch[static_cast<std::size_t>(i)].value = i;
+  }
+  for (auto _ : state) {
+    auto claim = ringBuffer.claimSpan(kBatchSize);
+    std::memcpy(claim.first.data(), batch.data(), claim.first.size_bytes());
+    std::memcpy(claim.second.data(), batch.data() + claim.first.size(), claim.second.size_bytes());
+    ringBuffer.publish(claim);
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchSize);
+}
+
+benchmark::internal::Benchmark* registerBulk(const char* name,
+                                             void (*fn)(benchmark::State&),
+                                             void (*setupFn)(const benchmark::State&)) {
+  auto* b = benchmark::RegisterBenchmark(name, fn);
+  b->Setup(setupFn)->Teardown(teardown);
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}
+}  // namespace
+
+static auto* bm_BulkPublish_Translators =
+  registerBulk("BulkPublish_Translators", &producingTranslators, &setup);
+static auto* bm_BulkPublish_SpanClaim =
+  registerBulk("BulkPublish_SpanClaim", &producingSpanClaim, &setup);
+static auto* bm_BulkPublish_Translators_NoConsumer =
+  registerBulk("BulkPublish_Translators_NoConsumer", &producingTranslators, &setupNoConsumer);
+static auto* bm_BulkPublish_SpanClaim_NoConsumer =
+  registerBulk("BulkPublish_SpanClaim_NoConsumer", &producingSpanClaim, &setupNoConsumer);
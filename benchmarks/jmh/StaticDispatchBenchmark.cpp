@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+
+#include "jmh_config.h"
+#include "jmh_util.h"
+
+#include "disruptor/EventHandler.h"
+#include "disruptor/YieldingWaitStrategy.h"
+#include "disruptor/dsl/Disruptor.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+// ValueAdditionEventHandler-style summing of event values by a DSL stage
+// whose handler class is not final (BatchEventProcessor: virtual get and
+// onEvent per event) and one whose class is final (StaticBatchEventProcessor:
+// both inlined into the batch loop). Each operation publishes kBatchSize
+// events with one span claim and waits until the handler has consumed them;
+// real time, since that work is on the consumer thread.
+
+namespace {
+constexpr int kBufferSize = 1 << 16;
+constexpr int kBatchSize = 4096;
+
+using WS = disruptor::YieldingWaitStrategy;
+using DisruptorType = disruptor::dsl::Disruptor<disruptor::bench::jmh::SimpleEvent,
+                                                disruptor::dsl::ProducerType::SINGLE,
+                                                WS>;
+
+struct VirtualSum : public disruptor::EventHandler<disruptor::bench::jmh::SimpleEvent> {
+  int64_t sum{0};
+
+  void onEvent(disruptor::bench::jmh::SimpleEvent& event, int64_t, bool) override {
+    sum += event.value;
+  }
+};
+
+struct StaticSum final : public disruptor::EventHandler<disruptor::bench::jmh::SimpleEvent> {
+  int64_t sum{0};
+
+  void onEvent(disruptor::bench::jmh::SimpleEvent& event, int64_t, bool) override {
+    sum += event.value;
+  }
+};
+
+DisruptorType* disruptorInstance = nullptr;
+disruptor::EventHandlerIdentity* handlerInstance = nullptr;
+VirtualSum virtualSum;
+StaticSum staticSum;
+
+template <typename Handler>
+void setup(const benchmark::State& state, Handler& handler) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  static WS ws;
+  auto factory = std::make_shared<disruptor::bench::jmh::SimpleEventFactory>();
+  disruptorInstance = new DisruptorType(factory, kBufferSize,
+                                        disruptor::util::DaemonThreadFactory::INSTANCE(), ws);
+  disruptorInstance->handleEventsWith(handler);
+  handlerInstance = &handler;
+  disruptorInstance->start();
+}
+
+void teardown(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  disruptorInstance->halt();
+  delete disruptorInstance;
+  disruptorInstance = nullptr;
+}
+
+void producing(benchmark::State& state) {
+  auto& ringBuffer = disruptorInstance->getRingBuffer();
+  for (auto _ : state) {
+    auto claim = ringBuffer.claimSpan(kBatchSize);
+    for (std::size_t i = 0; i < claim.size(); ++i) {
+      claim[i].value = static_cast<int64_t>(i);
+    }
+    ringBuffer.publish(claim);
+    while (disruptorInstance->getSequenceValueFor(*handlerInstance) < claim.hi) {
+      std::this_thread::yield();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchSize);
+}
+}  // namespace
+
+static auto* bm_ValueAddition_VirtualDispatch = [] {
+  auto* b = benchmark::RegisterBenchmark("ValueAddition_VirtualDispatch", &producing);
+  b->Setup([](const benchmark::State& state) { setup(state, virtualSum); })->Teardown(teardown);
+  b->UseRealTime();
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}();
+
+static auto* bm_ValueAddition_StaticDispatch = [] {
+  auto* b = benchmark::RegisterBenchmark("ValueAddition_StaticDispatch", &producing);
+  b->Setup([](const benchmark::State& state) { setup(state, staticSum); })->Teardown(teardown);
+  b->UseRealTime();
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}();
@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+
+#include "jmh_config.h"
+
+#include "disruptor/AlertException.h"
+#include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/WaitStrategy.h"
+
+#include <cstdint>
+#include <memory>
+
+// One waitFor on an alerted barrier: what every halt, and every timeout of a
+// timeout wait strategy, costs the consumer thread.
+//
+// - Exception: ProcessingSequenceBarrier::waitFor, throwing AlertException,
+//   caught as BatchEventProcessor did before tryWaitFor.
+// - WaitResult: ProcessingSequenceBarrier::tryWaitFor returning
+//   ErrorCode::Alerted.
+
+namespace {
+struct Event {
+  int64_t value{0};
+};
+
+struct EventFactory final : public disruptor::EventFactory<Event> {
+  Event newInstance() override {
+    return Event{};
+  }
+};
+
+using WS = disruptor::BusySpinWaitStrategy;
+using RB = disruptor::SingleProducerRingBuffer<Event, WS>;
+
+auto& alertedBarrier() {
+  static WS ws;
+  static auto ringBuffer = RB::createSingleProducer(std::make_shared<EventFactory>(), 64, ws);
+  static auto barrier = [] {
+    auto created = ringBuffer->newBarrier();
+    created->alert();
+    return created;
+  }();
+  return *barrier;
+}
+
+void exceptionAlert(benchmark::State& state) {
+  auto& barrier = alertedBarrier();
+  for (auto _ : state) {
+    try {
+      benchmark::DoNotOptimize(barrier.waitFor(0));
+    } catch (const disruptor::AlertException&) {
+      benchmark::ClobberMemory();
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void waitResultAlert(benchmark::State& state) {
+  auto& barrier = alertedBarrier();
+  for (auto _ : state) {
+    const disruptor::WaitResult result = barrier.tryWaitFor(0);
+    if (!result) {
+      benchmark::ClobberMemory();
+    }
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+}  // namespace
+
+static auto* bm_AlertedWaitFor_Exception = [] {
+  auto* b = benchmark::RegisterBenchmark("AlertedWaitFor_Exception", &exceptionAlert);
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}();
+
+static auto* bm_AlertedWaitFor_WaitResult = [] {
+  auto* b = benchmark::RegisterBenchmark("AlertedWaitFor_WaitResult", &waitResultAlert);
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}();
@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+
+#include "jmh_config.h"
+#include "jmh_util.h"
+
+#include "disruptor/WorkHandler.h"
+#include "disruptor/YieldingWaitStrategy.h"
+#include "disruptor/dsl/Disruptor.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+// Single-producer publishing into a worker pool
+// (Disruptor::handleEventsWithWorkerPool), each event handled by one of
+// Workers WorkHandlers. ClaimBatch is the pool's work claim batch size: 1 is
+// one compareAndSet on the shared work sequence per event (Java), larger
+// values let a worker take up to that many available events per claim.
+// Yielding wait strategy so idle workers give up the CPU on small machines.
+
+namespace {
+constexpr int kBufferSize = 1 << 16;
+
+using WS = disruptor::YieldingWaitStrategy;
+using DisruptorType = disruptor::dsl::Disruptor<disruptor::bench::jmh::SimpleEvent,
+                                                disruptor::dsl::ProducerType::SINGLE,
+                                                WS>;
+
+struct ConsumeWorkHandler final
+  : public disruptor::WorkHandler<disruptor::bench::jmh::SimpleEvent> {
+  void onEvent(disruptor::bench::jmh::SimpleEvent& event) override {
+    benchmark::DoNotOptimize(event.value);
+  }
+};
+
+DisruptorType* disruptorInstance = nullptr;
+std::array<ConsumeWorkHandler, 4> workHandlers;
+
+template <int Workers, int ClaimBatch>
+void setup(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  static WS ws;
+  auto factory = std::make_shared<disruptor::bench::jmh::SimpleEventFactory>();
+  disruptorInstance = new DisruptorType(factory, kBufferSize,
+                                        disruptor::util::DaemonThreadFactory::INSTANCE(), ws);
+  disruptorInstance->setWorkClaimBatchSize(ClaimBatch);
+  [&]<std::size_t... I>(std::index_sequence<I...>) {
+    disruptorInstance->handleEventsWithWorkerPool(workHandlers[I]...);
+  }(std::make_index_sequence<Workers>{});
+  disruptorInstance->start();
+}
+
+void teardown(const benchmark::State& state) {
+  if (state.thread_index() != 0) {
+    return;
+  }
+  disruptorInstance->halt();
+  delete disruptorInstance;
+  disruptorInstance = nullptr;
+}
+
+void producing(benchmark::State& state) {
+  auto& ringBuffer = disruptorInstance->getRingBuffer();
+  for (auto _ : state) {
+    const int64_t sequence = ringBuffer.next();
+    ringBuffer.get(sequence).value = 0;
+    ringBuffer.publish(sequence);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <int Workers, int ClaimBatch>
+benchmark::internal::Benchmark* registerPool(const char* name) {
+  auto* b = benchmark::RegisterBenchmark(name, &producing);
+  b->Setup(setup<Workers, ClaimBatch>)->Teardown(teardown);
+  return disruptor::bench::jmh::applyJmhDefaults(b);
+}
+}  // namespace
+
+static auto* bm_WorkerPool_1Worker = registerPool<1, 1>("WorkerPool_Workers1_ClaimBatch1");
+static auto* bm_WorkerPool_4Workers = registerPool<4, 1>("WorkerPool_Workers4_ClaimBatch1");
+static auto* bm_WorkerPool_4WorkersBatched =
+  registerPool<4, 16>("WorkerPool_Workers4_ClaimBatch16");
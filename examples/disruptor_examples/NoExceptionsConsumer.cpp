@@ -0,0 +1,82 @@
+// C++-only example (no Java equivalent): a BatchEventProcessor and an
+// EventPoller in a build compiled with -fno-exceptions (see CMakeLists.txt).
+// Halting and wait strategy timeouts reach the processor as WaitResult errors
+// rather than exceptions; onTimeout runs while the producer is quiet.
+
+#include "disruptor/BatchEventProcessor.h"
+#include "disruptor/EventHandler.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/TimeoutBlockingWaitStrategy.h"
+
+#include "support/LongEvent.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <type_traits>
+
+namespace {
+using Event = disruptor_examples::support::LongEvent;
+using WS = disruptor::TimeoutBlockingWaitStrategy;
+using RB = disruptor::SingleProducerRingBuffer<Event, WS>;
+
+class SummingHandler final : public disruptor::EventHandler<Event> {
+public:
+  void onEvent(Event& event, int64_t /*sequence*/, bool /*endOfBatch*/) override {
+    sum += event.get();
+  }
+
+  void onTimeout(int64_t /*sequence*/) override {
+    timeouts.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  int64_t sum{0};
+  std::atomic<int> timeouts{0};
+};
+
+class CountingPollHandler final : public disruptor::EventPoller<Event, RB::SequencerType>::Handler {
+public:
+  bool onEvent(Event& /*event*/, int64_t /*sequence*/, bool /*endOfBatch*/) override {
+    ++count;
+    return true;
+  }
+
+  int64_t count{0};
+};
+}  // namespace
+
+int main() {
+  constexpr int kEvents = 1000;
+  WS ws(1'000'000);
+  auto ringBuffer = RB::createSingleProducer(Event::FACTORY, 1024, ws);
+  auto barrier = ringBuffer->newBarrier();
+  SummingHandler handler;
+  disruptor::StaticBatchEventProcessor<Event, SummingHandler,
+                                       std::remove_reference_t<decltype(*barrier)>, RB>
+    processor(*ringBuffer, *barrier, handler, 64, nullptr);
+  auto poller = ringBuffer->newPoller();
+  ringBuffer->addGatingSequences(processor.getSequence());
+  ringBuffer->addGatingSequences(poller->getSequence());
+
+  std::thread consumer([&] { processor.run(); });
+  for (int i = 0; i < kEvents; ++i) {
+    const int64_t sequence = ringBuffer->next();
+    ringBuffer->get(sequence).set(i);
+    ringBuffer->publish(sequence);
+  }
+  while (processor.getSequence().get() < kEvents - 1
+         || handler.timeouts.load(std::memory_order_relaxed) == 0) {
+    std::this_thread::yield();
+  }
+  processor.halt();
+  consumer.join();
+
+  CountingPollHandler pollHandler;
+  poller->poll(pollHandler);
+
+  std::printf("sum=%lld polled=%lld\n", static_cast<long long>(handler.sum),
+              static_cast<long long>(pollHandler.count));
+  const bool ok = handler.sum == int64_t{kEvents} * (kEvents - 1) / 2 && pollHandler.count == kEvents;
+  return ok ? 0 : 1;
+}
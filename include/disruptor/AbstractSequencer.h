@@ -4,6 +4,9 @@
 // reference/disruptor/src/main/java/com/lmax/disruptor/AbstractSequencer.java
 
 #include "Cursored.h"
+#include "GatingSequenceRegistry.h"
+#include "GatingTree.h"
+#include "RingBufferSize.h"
 #include "Sequence.h"
 #include "Sequencer.h"
 #include "WaitStrategy.h"
@@ -11,46 +14,48 @@
 #include "SequenceGroups.h"
 #include "util/Util.h"
 
+#include <array>
 #include <cstdint>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace disruptor {
 
-template <typename T>
-class DataProvider;
-template <typename T, typename SequencerT>
-class EventPoller;
-
 // Java uses AtomicReferenceFieldUpdater over a volatile Sequence[] for
-// gatingSequences. C++ port uses an atomic shared_ptr snapshot updated via CAS
-// (see SequenceGroups).
+// gatingSequences. C++ port keeps them in a GatingSequenceRegistry: lock- and
+// refcount-free reads on the producer path, mutex-serialised add/remove (see
+// SequenceGroups).
 //
 // Template version: WaitStrategy is stored by value and statically dispatched.
-template <typename WaitStrategyT>
+// BufferSize != kDynamicBufferSize fixes the ring size at compile time (see
+// RingBufferSize); validation then happens in static_asserts.
+//
+// ExternalCursor makes the cursor a reference to a Sequence held elsewhere
+// (e.g. in a shared memory segment, see SharedMemoryRingBuffer), so the
+// in-process sequencers keep it as a member and pay no indirection.
+template <typename WaitStrategyT, int BufferSize = kDynamicBufferSize, bool ExternalCursor = false>
 class AbstractSequencer : public Cursored {
 public:
   explicit AbstractSequencer(int bufferSize, WaitStrategyT& waitStrategy)
+    requires(!ExternalCursor)
     : bufferSize_(bufferSize)
     , waitStrategy_(&waitStrategy)
-    , cursor_(Sequencer::INITIAL_CURSOR_VALUE)
-    , gatingSequences_(std::make_shared<std::vector<Sequence*>>()) {
-    if (bufferSize < 1) {
-      throw std::invalid_argument("bufferSize must not be less than 1");
-    }
-    if ((bufferSize & (bufferSize - 1)) != 0) {
-      throw std::invalid_argument("bufferSize must be a power of 2");
-    }
-  }
+    , cursor_(Sequencer::INITIAL_CURSOR_VALUE) {}
+
+  // C++-only: claims on cursor, whose value is left alone.
+  AbstractSequencer(int bufferSize, WaitStrategyT& waitStrategy, Sequence& cursor)
+    requires ExternalCursor
+    : bufferSize_(bufferSize), waitStrategy_(&waitStrategy), cursor_(cursor) {}
 
   int64_t getCursor() const override {
     return cursor_.get();
   }
 
   int getBufferSize() const {
-    return bufferSize_;
+    return bufferSize_.size();
   }
 
   Sequence& cursorSequence() {
@@ -65,16 +70,29 @@ public:
     SequenceGroups::addSequences(*this, gatingSequences_, *this, gatingSequences, count);
   }
 
+  // C++-only: gates on tree.root() alone. Same cursor handshake as above,
+  // applied to every node of the tree; remove with
+  // removeGatingSequence(tree.root()).
+  void addGatingSequences(GatingTree& tree) {
+    tree.reset(cursor_.get());
+    std::array<Sequence*, 1> root = {&tree.root()};
+    gatingSequences_.add(root.data(), 1);
+    tree.reset(cursor_.get());
+  }
+
+  // C++-only: gates on sequences that already hold their consumers'
+  // positions, e.g. consumer slots that other processes own; unlike
+  // addGatingSequences, their values are left alone.
+  void addGatingSequencesInPlace(Sequence* const* gatingSequences, int count) {
+    gatingSequences_.add(gatingSequences, count);
+  }
+
   bool removeGatingSequence(Sequence& sequence) {
     return SequenceGroups::removeSequence(*this, gatingSequences_, sequence);
   }
 
   int64_t getMinimumSequence() {
-    auto snap = gatingSequences_.load(std::memory_order_acquire);
-    if (!snap) {
-      return cursor_.get();
-    }
-    return disruptor::util::Util::getMinimumSequence(*snap, cursor_.get());
+    return gatingSequences_.minimumSequence(cursor_.get());
   }
 
   // NOTE: newBarrier is implemented on concrete sequencers so the barrier is
@@ -96,10 +114,10 @@ public:
   }
 
 protected:
-  int bufferSize_;
+  [[no_unique_address]] RingBufferSize<BufferSize> bufferSize_;
   WaitStrategyT* waitStrategy_;
-  Sequence cursor_;
-  std::atomic<std::shared_ptr<std::vector<Sequence*>>> gatingSequences_;
+  std::conditional_t<ExternalCursor, Sequence&, Sequence> cursor_;
+  GatingSequenceRegistry gatingSequences_;
 };
 
 }  // namespace disruptor
@@ -0,0 +1,109 @@
+#pragma once
+// C++-only: a BatchEventProcessor that runs as a coroutine on a
+// CoroutineScheduler (no Java equivalent).
+//
+// run() returns a ScheduledTask to spawn(). The task waits with co_await
+// barrier.waitForAsync(), so an idle consumer takes no CPU until a publish
+// resumes it, and many consumers can share one scheduler thread. Each wake-up
+// hands the published events to the wrapped BatchEventProcessor's runSlice(),
+// so lifecycle, exception handling and skipped sequences (see ClaimChunk) are
+// BatchEventProcessor's; rewinding is not supported. After each slice it
+// signals the wait strategy, so that downstream consumers and producers
+// suspended in nextAsync() see the progress. It also yields when other
+// coroutines are ready.
+
+#include "AsyncWaitStrategy.h"
+#include "BatchEventProcessor.h"
+#include "CoroutineScheduler.h"
+#include "DataProvider.h"
+#include "EventHandlerBase.h"
+#include "ExceptionHandler.h"
+#include "Sequence.h"
+
+#include <limits>
+
+namespace disruptor {
+
+template <typename T, typename BarrierT, typename DataProviderT = DataProvider<T>>
+class AsyncEventProcessor final {
+public:
+  AsyncEventProcessor(DataProviderT& dataProvider,
+                      BarrierT& sequenceBarrier,
+                      AsyncWaitStrategy& waitStrategy,
+                      EventHandlerBase<T>& eventHandler,
+                      int maxBatchSize = std::numeric_limits<int>::max())
+    : processor_(dataProvider, sequenceBarrier, eventHandler, maxBatchSize, nullptr)
+    , sequenceBarrier_(&sequenceBarrier)
+    , waitStrategy_(&waitStrategy)
+    , maxBatchSize_(maxBatchSize) {}
+
+  Sequence& getSequence() {
+    return processor_.getSequence();
+  }
+
+  // Stops the task at its next wait; the scheduler's run() returns once every
+  // task has stopped.
+  void halt() {
+    processor_.halt();
+  }
+
+  bool isRunning() {
+    return processor_.isRunning();
+  }
+
+  void setExceptionHandler(ExceptionHandler<T>& exceptionHandler) {
+    processor_.setExceptionHandler(exceptionHandler);
+  }
+
+  ScheduledTask run() {
+    return processEvents();
+  }
+
+private:
+  BatchEventProcessor<T, BarrierT, EventHandlerBase<T>, DataProviderT> processor_;
+  BarrierT* sequenceBarrier_;
+  AsyncWaitStrategy* waitStrategy_;
+  int maxBatchSize_;
+
+  ScheduledTask processEvents() {
+    CoroutineScheduler& scheduler = co_await currentScheduler();
+
+    if (!processor_.startSlices()) {
+      co_return;
+    }
+    while (true) {
+      // An alert or timeout comes back here too: runSlice() reports Halted
+      // or Idle for it.
+      co_await sequenceBarrier_->waitForAsync(processor_.getSequence().get() + 1);
+      if (processor_.runSlice(maxBatchSize_) == SliceResult::Halted) {
+        break;
+      }
+      waitStrategy_->signalAllWhenBlocking();
+      co_await scheduler.yieldIfBusy();
+    }
+    processor_.endSlices();
+  }
+
+  // The scheduler a ScheduledTask was spawned on, without suspending.
+  static auto currentScheduler() {
+    struct Awaiter {
+      CoroutineScheduler* scheduler{nullptr};
+
+      bool await_ready() const noexcept {
+        return false;
+      }
+
+      bool await_suspend(ScheduledTask::Handle task) noexcept {
+        scheduler = task.promise().scheduler;
+        return false;
+      }
+
+      CoroutineScheduler& await_resume() const noexcept {
+        return *scheduler;
+      }
+    };
+    return Awaiter{};
+  }
+};
+
+}  // namespace disruptor
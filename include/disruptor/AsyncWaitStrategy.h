@@ -0,0 +1,213 @@
+#pragma once
+// C++-only: a wait strategy that also resumes suspended coroutines (no Java
+// equivalent).
+//
+// Threads that wait through a ProcessingSequenceBarrier block exactly as with
+// LiteBlockingWaitStrategy. Coroutines instead co_await
+// barrier.waitForAsync(sequence) or ringBuffer.nextAsync(n) from a
+// ScheduledTask. If the sequence or the capacity is not there yet, the
+// coroutine is parked here. signalAllWhenBlocking(), which every publish
+// calls for a blocking strategy, hands each parked coroutine back to its
+// CoroutineScheduler. The scheduler re-checks the condition on its own thread
+// and either resumes the coroutine or parks it again. Any other AsyncWaiter,
+// such as a BatchEventProcessorTask, parks the same way.
+//
+// Consumer progress does not signal the wait strategy in Java. Coroutines
+// waiting on another consumer's sequence (a dependent barrier) or on
+// capacity (nextAsync) are woken by consumers that call
+// signalAllWhenBlocking() after advancing, as AsyncEventProcessor does.
+
+#include "AsyncWaiter.h"
+#include "CoroutineScheduler.h"
+#include "LiteBlockingWaitStrategy.h"
+#include "Sequence.h"
+#include "WaitStrategy.h"
+
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+namespace disruptor {
+
+class AsyncWaitStrategy final {
+public:
+  static constexpr bool kIsBlockingStrategy = true;
+
+  template <typename BarrierT>
+  class BarrierAwaiter;
+  template <typename RingBufferT>
+  class CapacityAwaiter;
+
+  template <typename DependentSequenceT, typename Barrier>
+  int64_t waitFor(int64_t sequence,
+                  const Sequence& cursorSequence,
+                  const DependentSequenceT& dependentSequence,
+                  Barrier& barrier) {
+    return threads_.waitFor(sequence, cursorSequence, dependentSequence, barrier);
+  }
+
+  template <typename DependentSequenceT, typename Barrier>
+  WaitResult tryWaitFor(int64_t sequence,
+                        const Sequence& cursorSequence,
+                        const DependentSequenceT& dependentSequence,
+                        Barrier& barrier) {
+    return threads_.tryWaitFor(sequence, cursorSequence, dependentSequence, barrier);
+  }
+
+  void signalAllWhenBlocking() {
+    threads_.signalAllWhenBlocking();
+
+    // Pairs with the fence in park(): either the waiter sees the new cursor or
+    // this sees the waiter.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!hasParked_.load(std::memory_order_relaxed)) [[likely]] {
+      return;
+    }
+
+    AsyncWaiter* waiter;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      waiter = std::exchange(parked_, nullptr);
+      hasParked_.store(false, std::memory_order_relaxed);
+    }
+    while (waiter != nullptr) {
+      // The waiter may be resumed and gone once woken.
+      AsyncWaiter* next = waiter->next;
+      waiter->wake();
+      waiter = next;
+    }
+  }
+
+  // Parks waiter until the next signal, unless poll shows it is ready by
+  // then. Returns false only if the waiter is ready and was not left parked.
+  template <typename Poll>
+  bool park(AsyncWaiter& waiter, Poll&& poll) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      waiter.next = parked_;
+      parked_ = &waiter;
+      hasParked_.store(true, std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (!poll()) {
+      return true;
+    }
+    // A signal may already have woken the waiter; whatever runs it will then
+    // find it ready.
+    return !unpark(waiter);
+  }
+
+private:
+  bool unpark(AsyncWaiter& waiter) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (AsyncWaiter** link = &parked_; *link != nullptr; link = &(*link)->next) {
+      if (*link == &waiter) {
+        *link = waiter.next;
+        hasParked_.store(parked_ != nullptr, std::memory_order_relaxed);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  LiteBlockingWaitStrategy threads_;
+  std::mutex mutex_;
+  AsyncWaiter* parked_{nullptr};
+  std::atomic<bool> hasParked_{false};
+};
+
+// co_await barrier.waitForAsync(sequence): a WaitResult as from
+// barrier.tryWaitFor(sequence), without blocking the scheduler thread.
+template <typename BarrierT>
+class AsyncWaitStrategy::BarrierAwaiter final : private CoroutineWaiter {
+public:
+  BarrierAwaiter(BarrierT& barrier, AsyncWaitStrategy& waitStrategy, int64_t sequence)
+    : barrier_(&barrier), waitStrategy_(&waitStrategy), sequence_(sequence) {}
+
+  bool await_ready() {
+    return poll();
+  }
+
+  bool await_suspend(ScheduledTask::Handle task) {
+    handle = task;
+    scheduler = task.promise().scheduler;
+    return waitStrategy_->park(*this, [this] { return poll(); });
+  }
+
+  WaitResult await_resume() const noexcept {
+    return result_;
+  }
+
+private:
+  bool resumable() override {
+    return poll() || !waitStrategy_->park(*this, [this] { return poll(); });
+  }
+
+  // Ready once alerted or once sequence is published.
+  bool poll() {
+    result_ = barrier_->pollAvailable(sequence_);
+    return !result_ || *result_ >= sequence_;
+  }
+
+  BarrierT* barrier_;
+  AsyncWaitStrategy* waitStrategy_;
+  int64_t sequence_;
+  WaitResult result_{0};
+};
+
+// co_await ringBuffer.nextAsync(n): the highest of n claimed sequences, as
+// from ringBuffer.next(n), suspending while the ring is full.
+template <typename RingBufferT>
+class AsyncWaitStrategy::CapacityAwaiter final : private CoroutineWaiter {
+public:
+  CapacityAwaiter(RingBufferT& ringBuffer, AsyncWaitStrategy& waitStrategy, int n)
+    : ringBuffer_(&ringBuffer), waitStrategy_(&waitStrategy), n_(n) {}
+
+  bool await_ready() {
+    return poll();
+  }
+
+  bool await_suspend(ScheduledTask::Handle task) {
+    handle = task;
+    scheduler = task.promise().scheduler;
+    return waitStrategy_->park(*this, [this] { return poll(); });
+  }
+
+  int64_t await_resume() const noexcept {
+    return sequence_;
+  }
+
+private:
+  bool resumable() override {
+    return poll() || !waitStrategy_->park(*this, [this] { return poll(); });
+  }
+
+  // Claims at most once: park() may poll a waiter that a signal has already
+  // posted, and the scheduler polls it again.
+  bool poll() {
+    if (claimed_) {
+      return true;
+    }
+    if (!ringBuffer_->hasAvailableCapacity(n_)) {
+      return false;
+    }
+    const auto claimed = ringBuffer_->tryNext(n_);
+    if (!claimed) {
+      return false;
+    }
+    sequence_ = *claimed;
+    claimed_ = true;
+    return true;
+  }
+
+  RingBufferT* ringBuffer_;
+  AsyncWaitStrategy* waitStrategy_;
+  int n_;
+  bool claimed_{false};
+  int64_t sequence_{0};
+};
+
+}  // namespace disruptor
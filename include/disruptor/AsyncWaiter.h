@@ -0,0 +1,21 @@
+#pragma once
+// C++-only: a consumer or producer parked on an AsyncWaitStrategy (no Java
+// equivalent).
+
+namespace disruptor {
+
+// wake() is called once per park, from signalAllWhenBlocking() on the
+// signalling thread. It hands the waiter back to whatever runs it (a
+// CoroutineScheduler or a WorkStealingExecutor), which re-checks the
+// awaited condition there.
+class AsyncWaiter {
+public:
+  virtual void wake() = 0;
+
+  AsyncWaiter* next{nullptr};
+
+protected:
+  ~AsyncWaiter() = default;
+};
+
+}  // namespace disruptor
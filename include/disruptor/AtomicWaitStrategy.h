@@ -0,0 +1,80 @@
+#pragma once
+// C++-only: a blocking wait strategy built on std::atomic::wait and
+// notify_all (no Java equivalent).
+//
+// A consumer that finds the cursor behind its sequence raises waiting_ and
+// sleeps in signals_.wait() until signalAllWhenBlocking() moves signals_ on.
+// The signal only does that, and notifies, after taking waiting_ down, so a
+// publish nobody waits for costs a fence and one relaxed load. Consumers do
+// not wait on the cursor itself: std::atomic::wait returns only once the
+// value changes, and a halt alerts the barrier without moving the cursor.
+
+#include "Sequence.h"
+#include "WaitStrategy.h"
+#include "util/ThreadHints.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace disruptor {
+
+class AtomicWaitStrategy final {
+public:
+  static constexpr bool kIsBlockingStrategy = true;
+
+  template <typename DependentSequenceT, typename Barrier>
+  int64_t waitFor(int64_t sequence,
+                  const Sequence& cursorSequence,
+                  const DependentSequenceT& dependentSequence,
+                  Barrier& barrier) {
+    return waitResultOrThrow(tryWaitFor(sequence, cursorSequence, dependentSequence, barrier));
+  }
+
+  template <typename DependentSequenceT, typename Barrier>
+  WaitResult tryWaitFor(int64_t sequence,
+                        const Sequence& cursorSequence,
+                        const DependentSequenceT& dependentSequence,
+                        Barrier& barrier) {
+    int64_t availableSequence;
+    while (cursorSequence.get() < sequence) {
+      if (barrier.isAlerted()) {
+        return std::unexpected(ErrorCode::Alerted);
+      }
+
+      // signals_ is read before waiting_ is raised, so a signal that takes
+      // down an earlier waiter's flag still moves it on and ends this wait.
+      // The fence pairs with the one in signalAllWhenBlocking(): either the
+      // signal sees waiting_, or the checks below see the new cursor or alert.
+      const int64_t signals = signals_.load(std::memory_order_acquire);
+      waiting_.store(true, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (cursorSequence.get() < sequence && !barrier.isAlerted()) {
+        signals_.wait(signals, std::memory_order_acquire);
+      }
+    }
+
+    while ((availableSequence = dependentSequence.get()) < sequence) {
+      if (barrier.isAlerted()) {
+        return std::unexpected(ErrorCode::Alerted);
+      }
+      disruptor::util::ThreadHints::onSpinWait();
+    }
+
+    return availableSequence;
+  }
+
+  void signalAllWhenBlocking() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiting_.load(std::memory_order_relaxed)
+        && waiting_.exchange(false, std::memory_order_relaxed)) {
+      signals_.fetch_add(1, std::memory_order_release);
+      signals_.notify_all();
+    }
+  }
+
+private:
+  alignas(128) std::atomic<int64_t> signals_{0};
+  std::atomic<bool> waiting_{false};
+};
+
+}  // namespace disruptor
@@ -0,0 +1,84 @@
+#pragma once
+// Availability tracking of com.lmax.disruptor.MultiProducerSequencer
+// (availableBuffer / setAvailable / isAvailable / getHighestPublishedSequence),
+// extracted so the sequencer can be instantiated with another tracker
+// (see ParityBitmapAvailableBuffer).
+
+#include "RingBufferSize.h"
+#include "util/MappedAllocator.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace disruptor {
+
+// One int per slot holding the lap number (sequence >> log2(bufferSize)) of
+// the last publication into that slot. Java's layout; the scan is one acquire
+// load per sequence.
+template <int BufferSize = kDynamicBufferSize>
+class AvailableBuffer final {
+public:
+  explicit AvailableBuffer(int bufferSize, const util::MemoryPolicy& memoryPolicy = {})
+    : bufferSize_(bufferSize)
+    , ownBuffer_(static_cast<size_t>(bufferSize),
+                 util::MappedAllocator<std::atomic<int>>(memoryPolicy))
+    , availableBuffer_(ownBuffer_.data()) {
+    for (auto& a : ownBuffer_) {
+      a.store(-1, std::memory_order_relaxed);
+    }
+  }
+
+  // C++-only: tracks availability in bufferSize flags at availableBuffer
+  // instead (e.g. in a shared memory segment, see SharedMemoryRingBuffer).
+  // Whoever owns them sets them to -1 once, before any publication.
+  AvailableBuffer(int bufferSize, std::atomic<int>* availableBuffer)
+    : bufferSize_(bufferSize), availableBuffer_(availableBuffer) {}
+
+  void setAvailable(int64_t sequence) {
+    setAvailableBufferValue(calculateIndex(sequence), calculateAvailabilityFlag(sequence));
+  }
+
+  void setAvailable(int64_t lo, int64_t hi) {
+    for (int64_t l = lo; l <= hi; ++l) {
+      setAvailable(l);
+    }
+  }
+
+  bool isAvailable(int64_t sequence) const {
+    int index = calculateIndex(sequence);
+    int flag = calculateAvailabilityFlag(sequence);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return availableBuffer_[index].load(std::memory_order_acquire) == flag;
+  }
+
+  int64_t getHighestPublishedSequence(int64_t lowerBound, int64_t availableSequence) const {
+    for (int64_t sequence = lowerBound; sequence <= availableSequence; ++sequence) {
+      if (!isAvailable(sequence)) {
+        return sequence - 1;
+      }
+    }
+    return availableSequence;
+  }
+
+private:
+  [[no_unique_address]] RingBufferSize<BufferSize> bufferSize_;
+  std::vector<std::atomic<int>, util::MappedAllocator<std::atomic<int>>> ownBuffer_;
+  std::atomic<int>* availableBuffer_;
+
+  void setAvailableBufferValue(int index, int flag) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    availableBuffer_[index].store(flag, std::memory_order_release);
+  }
+
+  int calculateAvailabilityFlag(int64_t sequence) const {
+    return static_cast<int>(sequence >> bufferSize_.shift());
+  }
+
+  int calculateIndex(int64_t sequence) const {
+    return static_cast<int>(sequence) & bufferSize_.mask();
+  }
+};
+
+}  // namespace disruptor
@@ -2,221 +2,421 @@
 // 1:1 port of com.lmax.disruptor.BatchEventProcessor
 // Source: reference/disruptor/src/main/java/com/lmax/disruptor/BatchEventProcessor.java
 
-#include "AlertException.h"
 #include "BatchRewindStrategy.h"
+#include "BatchSpanEventHandler.h"
 #include "DataProvider.h"
 #include "EventHandlerBase.h"
 #include "EventProcessor.h"
 #include "ExceptionHandler.h"
-#include "ExceptionHandlers.h"
+#include "ExceptionHandlingEventProcessor.h"
+#include "GatingTree.h"
+#include "ProcessorLifecycle.h"
 #include "RewindAction.h"
 #include "RewindHandler.h"
 #include "RewindableEventHandler.h"
 #include "RewindableException.h"
 #include "Sequence.h"
 #include "Sequencer.h"
-#include "TimeoutException.h"
+#include "WaitStrategy.h"
+#include "util/ExceptionSupport.h"
 
 #include <algorithm>
-#include <atomic>
+#include <concepts>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <span>
 #include <stdexcept>
+#include <type_traits>
 
 namespace disruptor {
 
-template <typename T, typename BarrierT>
-class BatchEventProcessor final : public EventProcessor {
+// C++-only: what BatchEventProcessor needs from its handler and data
+// provider. EventHandlerBase<T> and DataProvider<T> model them through
+// virtual calls; concrete types model them directly.
+template <typename H, typename T>
+concept BatchEventHandlerFor =
+  requires(H& handler, T& event, int64_t sequence, bool endOfBatch) {
+    handler.onEvent(event, sequence, endOfBatch);
+    handler.onBatchStart(sequence, sequence);
+    handler.onStart();
+    handler.onShutdown();
+    handler.onTimeout(sequence);
+  };
+
+template <typename P, typename T>
+concept DataProviderFor = requires(P& provider, int64_t sequence) {
+  { provider.get(sequence) } -> std::same_as<T&>;
+};
+
+// A final handler class: calls through HandlerT& cannot be overridden, so
+// the compiler resolves them statically.
+template <typename H, typename T>
+concept StaticDispatchHandler = std::is_final_v<H> && std::is_base_of_v<EventHandlerBase<T>, H>;
+
+// C++-only: how BatchEventProcessor::runSlice ended.
+enum class SliceResult {
+  MoreAvailable,  // stopped at maxEvents, more may be published
+  Idle,           // nothing published past the processor's sequence
+  Halted,
+};
+
+// C++-only: what the external-sequence constructor does with the Sequence.
+enum class ExternalSequence {
+  Reset,  // set to the initial value, as for the processor's own Sequence
+  Keep,   // left alone: it already holds the position to resume after
+};
+
+// HandlerT and DataProviderT (C++-only) default to the virtual interfaces.
+// With a final handler class and the concrete ring type, as in
+// StaticBatchEventProcessor, onEvent and get are direct calls the compiler
+// inlines, and rewind and span support are chosen from the handler's type
+// instead of by dynamic_cast.
+template <typename T,
+          typename BarrierT,
+          typename HandlerT = EventHandlerBase<T>,
+          typename DataProviderT = DataProvider<T>>
+  requires BatchEventHandlerFor<HandlerT, T> && DataProviderFor<DataProviderT, T>
+class BatchEventProcessor final : public ExceptionHandlingEventProcessor<T> {
 public:
-  BatchEventProcessor(DataProvider<T>& dataProvider,
+  BatchEventProcessor(DataProviderT& dataProvider,
                       BarrierT& sequenceBarrier,
-                      EventHandlerBase<T>& eventHandler,
+                      HandlerT& eventHandler,
                       int maxBatchSize,
                       BatchRewindStrategy* batchRewindStrategy)
-    : running_(IDLE)
-    , exceptionHandler_(nullptr)
-    , dataProvider_(&dataProvider)
+    : dataProvider_(&dataProvider)
     , sequenceBarrier_(&sequenceBarrier)
     , eventHandler_(&eventHandler)
     , batchLimitOffset_(maxBatchSize - 1)
-    , sequence_(SEQUENCER_INITIAL_CURSOR_VALUE)
+    , ownSequence_(SEQUENCER_INITIAL_CURSOR_VALUE)
+    , sequence_(&ownSequence_)
     , retriesAttempted_(0) {
     if (maxBatchSize < 1) {
-      throw std::invalid_argument("maxBatchSize must be greater than 0");
+      util::raise(std::invalid_argument("maxBatchSize must be greater than 0"));
     }
 
     // Java: if eventHandler instanceof RewindableEventHandler ->
     // TryRewindHandler(batchRewindStrategy) else NoRewindHandler
-    if (dynamic_cast<RewindableEventHandler<T>*>(&eventHandler) != nullptr) {
+    if (isRewindable(eventHandler)) {
       rewindHandler_ = std::make_unique<TryRewindHandler>(*this, batchRewindStrategy);
     } else {
       rewindHandler_ = std::make_unique<NoRewindHandler>();
     }
+    if constexpr (kMayUseSpans) {
+      spanHandler_ = asSpanHandler(eventHandler);
+    }
+  }
+
+  // C++-only: progress is recorded in sequence (e.g. a SequenceArray slot)
+  // instead of the processor's own Sequence. By default it is reset to the
+  // initial value; Keep adopts its value, e.g. a slot other processes already
+  // gate on (see SharedMemoryEventProcessor).
+  BatchEventProcessor(DataProviderT& dataProvider,
+                      BarrierT& sequenceBarrier,
+                      HandlerT& eventHandler,
+                      int maxBatchSize,
+                      BatchRewindStrategy* batchRewindStrategy,
+                      Sequence& sequence,
+                      ExternalSequence externalSequence = ExternalSequence::Reset)
+    : BatchEventProcessor(
+        dataProvider, sequenceBarrier, eventHandler, maxBatchSize, batchRewindStrategy) {
+    sequence_ = &sequence;
+    if (externalSequence == ExternalSequence::Reset) {
+      sequence_->set(SEQUENCER_INITIAL_CURSOR_VALUE);
+    }
+  }
+
+  // C++-only: progress is published through gatingTree.publish(member, ...)
+  // so the tree's nodes stay current; getSequence() is the member Sequence.
+  BatchEventProcessor(DataProviderT& dataProvider,
+                      BarrierT& sequenceBarrier,
+                      HandlerT& eventHandler,
+                      int maxBatchSize,
+                      BatchRewindStrategy* batchRewindStrategy,
+                      GatingTree& gatingTree,
+                      int member)
+    : BatchEventProcessor(dataProvider, sequenceBarrier, eventHandler, maxBatchSize,
+                          batchRewindStrategy, gatingTree.member(member)) {
+    gatingTree_ = &gatingTree;
+    gatingMember_ = member;
   }
 
   Sequence& getSequence() override {
-    return sequence_;
+    return *sequence_;
   }
 
   void halt() override {
-    running_.store(HALTED, std::memory_order_release);
-    sequenceBarrier_->alert();
+    lifecycle_.halt(*sequenceBarrier_);
   }
 
   bool isRunning() override {
-    return running_.load(std::memory_order_acquire) != IDLE;
+    return lifecycle_.isRunning();
   }
 
-  void setExceptionHandler(ExceptionHandler<T>& exceptionHandler) {
-    exceptionHandler_ = &exceptionHandler;
-    if (exceptionHandler_ == nullptr) {
-      throw std::invalid_argument("exceptionHandler must not be null");
-    }
+  void setExceptionHandler(ExceptionHandler<T>& exceptionHandler) override {
+    lifecycle_.setExceptionHandler(exceptionHandler);
   }
 
   void run() override {
-    int expected = IDLE;
-    if (running_.compare_exchange_strong(expected, RUNNING, std::memory_order_acq_rel)) {
-      sequenceBarrier_->clearAlert();
-
-      notifyStart();
-      try {
-        if (running_.load(std::memory_order_acquire) == RUNNING) {
-          processEvents();
-        }
-      } catch (...) {
-        notifyShutdown();
-        running_.store(IDLE, std::memory_order_release);
-        throw;
+    lifecycle_.run(*eventHandler_, *sequenceBarrier_, [this] { processEvents(); });
+  }
+
+  // C++-only: run() in slices, for a BatchEventProcessorTask on a shared
+  // executor. startSlices() begins as run() does and returns false if the
+  // processor was halted first. runSlice() handles at most maxEvents
+  // published events without waiting. endSlices() ends as run() does.
+  bool startSlices() {
+    return lifecycle_.start(*eventHandler_, *sequenceBarrier_);
+  }
+
+  SliceResult runSlice(int maxEvents)
+    requires requires(BarrierT& barrier) { barrier.pollAvailable(int64_t{0}); }
+  {
+    T* event = nullptr;
+    Sequence& sequence = *sequence_;
+    int64_t nextSequence = sequence.get() + 1;
+    const int64_t lastOfSlice = nextSequence + maxEvents - 1;
+
+    while (nextSequence <= lastOfSlice) {
+      const WaitResult availableSequence = sequenceBarrier_->pollAvailable(nextSequence);
+      if (!availableSequence) [[unlikely]] {
+        return lifecycle_.isHalted() ? SliceResult::Halted : SliceResult::Idle;
       }
-      notifyShutdown();
-      running_.store(IDLE, std::memory_order_release);
-    } else {
-      if (expected == RUNNING) {
-        throw std::runtime_error("Thread is already running");
+      if (*availableSequence < nextSequence) {
+        return SliceResult::Idle;
       }
-      earlyExit();
+      processAvailable(
+        sequence, nextSequence, (std::min)(*availableSequence, lastOfSlice), event);
     }
+    return SliceResult::MoreAvailable;
   }
 
-private:
-  static constexpr int IDLE = 0;
-  static constexpr int HALTED = IDLE + 1;
-  static constexpr int RUNNING = HALTED + 1;
+  void endSlices() {
+    lifecycle_.end(*eventHandler_);
+  }
 
-  std::atomic<int> running_;
-  ExceptionHandler<T>* exceptionHandler_;
-  DataProvider<T>* dataProvider_;
+private:
+  ProcessorLifecycle<T> lifecycle_;
+  DataProviderT* dataProvider_;
   BarrierT* sequenceBarrier_;
-  EventHandlerBase<T>* eventHandler_;
+  HandlerT* eventHandler_;
+  BatchSpanEventHandler<T>* spanHandler_{nullptr};
   int batchLimitOffset_;
-  Sequence sequence_;
+  Sequence ownSequence_;
+  Sequence* sequence_;
+  GatingTree* gatingTree_{nullptr};
+  int gatingMember_{0};
   std::unique_ptr<RewindHandler> rewindHandler_;
   int retriesAttempted_;
 
   void processEvents() {
     T* event = nullptr;
-    int64_t nextSequence = sequence_.get() + 1;
+    Sequence& sequence = *sequence_;
+    int64_t nextSequence = sequence.get() + 1;
 
+    // C++: alerts and timeouts come back as WaitResult errors, so halting and
+    // onTimeout are plain branches; only handler calls sit in a try block.
     while (true) {
-      const int64_t startOfBatchSequence = nextSequence;
-      try {
-        try {
-          const int64_t availableSequence = sequenceBarrier_->waitFor(nextSequence);
-          if (availableSequence < nextSequence) {
-            // Java: if insufficient available, continue waiting without moving the processor
-            // sequence backwards.
-            continue;
-          }
-          const int64_t endOfBatchSequence =
-            std::min(nextSequence + batchLimitOffset_, availableSequence);
-
-          if (nextSequence <= endOfBatchSequence) {
-            eventHandler_->onBatchStart(endOfBatchSequence - nextSequence + 1,
-                                        availableSequence - nextSequence + 1);
-          }
-
-          while (nextSequence <= endOfBatchSequence) {
-            event = &dataProvider_->get(nextSequence);
-            eventHandler_->onEvent(*event, nextSequence, nextSequence == endOfBatchSequence);
-            ++nextSequence;
-          }
-
-          retriesAttempted_ = 0;
-          sequence_.set(endOfBatchSequence);
-        } catch (const RewindableException& e) {
-          nextSequence = rewindHandler_->attemptRewindGetNextSequence(e, startOfBatchSequence);
-        }
-      } catch (const TimeoutException&) {
-        notifyTimeout(sequence_.get());
-      } catch (const AlertException&) {
-        if (running_.load(std::memory_order_acquire) != RUNNING) {
+      const WaitResult availableSequence = lifecycle_.waitFor(*sequenceBarrier_, nextSequence);
+      if (!availableSequence) [[unlikely]] {
+        if (availableSequence.error() == ErrorCode::Timeout) {
+          lifecycle_.notifyTimeout(*eventHandler_, *sequenceBarrier_, sequence.get());
+        } else if (lifecycle_.isHalted()) {
           break;
         }
-      } catch (const std::exception& ex) {
-        handleEventException(ex, nextSequence, event);
-        sequence_.set(nextSequence);
-        ++nextSequence;
+        continue;
+      }
+      if (*availableSequence < nextSequence) {
+        // Java: if insufficient available, continue waiting without moving the processor
+        // sequence backwards.
+        continue;
       }
+
+      processAvailable(sequence, nextSequence, *availableSequence, event);
     }
   }
 
-  void earlyExit() {
-    notifyStart();
-    notifyShutdown();
+  // processBatch, recovering from handler exceptions by rewinding or skipping.
+  void processAvailable(Sequence& sequence,
+                        int64_t& nextSequence,
+                        int64_t availableSequence,
+                        T*& event) {
+#if DISRUPTOR_EXCEPTIONS
+    const int64_t startOfBatchSequence = nextSequence;
+    try {
+      processBatch(sequence, nextSequence, availableSequence, event);
+    } catch (const RewindableException& e) {
+      rewindBatch(e, startOfBatchSequence, sequence, nextSequence, event);
+    } catch (const std::exception& ex) {
+      skipFailedEvent(ex, sequence, nextSequence, event);
+    }
+#else
+    processBatch(sequence, nextSequence, availableSequence, event);
+#endif
   }
 
-  void notifyTimeout(int64_t availableSequence) {
-    try {
-      eventHandler_->onTimeout(availableSequence);
-    } catch (const std::exception& e) {
-      handleEventException(e, availableSequence, nullptr);
+  // Handles up to maxBatchSize events from nextSequence and publishes them;
+  // nextSequence ends past the batch, or at the event that threw.
+  void processBatch(Sequence& sequence,
+                    int64_t& nextSequence,
+                    int64_t availableSequence,
+                    T*& event) {
+    const int64_t endOfBatchSequence =
+      std::min(nextSequence + batchLimitOffset_, availableSequence);
+
+    if (nextSequence <= endOfBatchSequence) {
+      eventHandler_->onBatchStart(endOfBatchSequence - nextSequence + 1,
+                                  availableSequence - nextSequence + 1);
     }
+
+    if constexpr (kMayUseSpans) {
+      if (spanHandler_ != nullptr) {
+        // An exception skips the whole batch: report its last event.
+        const int64_t firstOfBatch = nextSequence;
+        nextSequence = endOfBatchSequence;
+        event = &dataProvider_->get(endOfBatchSequence);
+        processSpans(firstOfBatch, endOfBatchSequence, availableSequence);
+        ++nextSequence;
+      } else {
+        deliverEvents(nextSequence, endOfBatchSequence, event);
+      }
+    } else {
+      deliverEvents(nextSequence, endOfBatchSequence, event);
+    }
+
+    retriesAttempted_ = 0;
+    publishSequence(sequence, endOfBatchSequence);
   }
 
-  void notifyStart() {
+#if DISRUPTOR_EXCEPTIONS
+  void rewindBatch(const RewindableException& e,
+                   int64_t startOfBatchSequence,
+                   Sequence& sequence,
+                   int64_t& nextSequence,
+                   T* event) {
     try {
-      eventHandler_->onStart();
+      nextSequence = rewindHandler_->attemptRewindGetNextSequence(e, startOfBatchSequence);
     } catch (const std::exception& ex) {
-      handleOnStartException(ex);
+      skipFailedEvent(ex, sequence, nextSequence, event);
     }
   }
 
-  void notifyShutdown() {
-    try {
-      eventHandler_->onShutdown();
-    } catch (const std::exception& ex) {
-      handleOnShutdownException(ex);
+  void skipFailedEvent(const std::exception& ex,
+                       Sequence& sequence,
+                       int64_t& nextSequence,
+                       T* event) {
+    handleEventException(ex, nextSequence, event);
+    publishSequence(sequence, nextSequence);
+    ++nextSequence;
+  }
+#endif
+
+  // EventHandlerBase<T> is resolved at run time; any other handler type by
+  // what it derives from.
+  static constexpr bool kDynamicHandler = std::is_same_v<HandlerT, EventHandlerBase<T>>;
+  static constexpr bool kMayUseSpans =
+    kDynamicHandler || std::is_base_of_v<BatchSpanEventHandler<T>, HandlerT>;
+
+  static bool isRewindable(HandlerT& handler) {
+    if constexpr (kDynamicHandler) {
+      return dynamic_cast<RewindableEventHandler<T>*>(&handler) != nullptr;
+    } else {
+      return std::is_base_of_v<RewindableEventHandler<T>, HandlerT>;
     }
   }
 
-  void handleEventException(const std::exception& ex, int64_t sequence, T* event) {
-    // In Java, an ExceptionHandler throwing only kills the consumer thread.
-    // In C++, an exception escaping a std::thread calls std::terminate (kills the process),
-    // so we must guard against that to preserve Java semantics.
-    try {
-      getExceptionHandler()->handleEventException(ex, sequence, event);
-    } catch (...) {
-      // Stop processing and wake any waiters.
-      halt();
+  static BatchSpanEventHandler<T>* asSpanHandler(HandlerT& handler) {
+    if constexpr (kDynamicHandler) {
+      return dynamic_cast<BatchSpanEventHandler<T>*>(&handler);
+    } else {
+      return &handler;
     }
   }
 
-  void handleOnStartException(const std::exception& ex) {
-    getExceptionHandler()->handleOnStartException(ex);
+  // Delivers [nextSequence, endOfBatchSequence] one onEvent at a time.
+  void deliverEvents(int64_t& nextSequence, int64_t endOfBatchSequence, T*& event) {
+    if constexpr (kMaySkip) {
+      if (sequenceBarrier_->hasSkippedSequences()) [[unlikely]] {
+        processSkipping(nextSequence, endOfBatchSequence, event);
+      }
+    }
+
+    while (nextSequence <= endOfBatchSequence) {
+      event = &dataProvider_->get(nextSequence);
+      eventHandler_->onEvent(*event, nextSequence, nextSequence == endOfBatchSequence);
+      ++nextSequence;
+    }
   }
 
-  void handleOnShutdownException(const std::exception& ex) {
-    getExceptionHandler()->handleOnShutdownException(ex);
+  // The barrier's sequencer may publish skipped sequences (claim chunks).
+  static constexpr bool kMaySkip =
+    requires(BarrierT& barrier, int64_t sequence) { barrier.isSkipped(sequence); };
+
+  // Delivers [nextSequence, endOfBatchSequence] minus skipped sequences;
+  // endOfBatch goes to the last delivered event.
+  void processSkipping(int64_t& nextSequence, int64_t endOfBatchSequence, T*& event)
+    requires kMaySkip
+  {
+    const int64_t lastEvent =
+      sequenceBarrier_->lastUnskippedSequence(nextSequence, endOfBatchSequence);
+    while (nextSequence <= endOfBatchSequence) {
+      if (nextSequence <= lastEvent && !sequenceBarrier_->isSkipped(nextSequence)) {
+        event = &dataProvider_->get(nextSequence);
+        eventHandler_->onEvent(*event, nextSequence, nextSequence == lastEvent);
+      }
+      ++nextSequence;
+    }
   }
 
-  std::shared_ptr<ExceptionHandler<T>> getExceptionHandler() {
-    // Java: handler == null ? ExceptionHandlers.defaultHandler() : handler;
-    if (exceptionHandler_ == nullptr) {
-      return ExceptionHandlers::defaultHandler<T>();
+  // Delivers [lo, hi] to spanHandler_ in as few onBatch calls as the
+  // storage and any skipped sequences allow.
+  void processSpans(int64_t lo, int64_t hi, int64_t availableSequence)
+    requires kMayUseSpans
+  {
+    if constexpr (kMaySkip) {
+      if (sequenceBarrier_->hasSkippedSequences()) [[unlikely]] {
+        while (lo <= hi) {
+          if (sequenceBarrier_->isSkipped(lo)) {
+            ++lo;
+            continue;
+          }
+          int64_t runEnd = lo;
+          while (runEnd < hi && !sequenceBarrier_->isSkipped(runEnd + 1)) {
+            ++runEnd;
+          }
+          deliverSpans(lo, runEnd, availableSequence);
+          lo = runEnd + 1;
+        }
+        return;
+      }
     }
-    // Non-owning pointer -> wrap without deleting.
-    return std::shared_ptr<ExceptionHandler<T>>(exceptionHandler_, [](ExceptionHandler<T>*) {});
+    deliverSpans(lo, hi, availableSequence);
+  }
+
+  void deliverSpans(int64_t lo, int64_t hi, int64_t availableSequence)
+    requires kMayUseSpans
+  {
+    auto [first, second] = dataProvider_->getSpans(lo, hi);
+    if (first.size() + second.size() == static_cast<std::size_t>(hi - lo + 1)) [[likely]] {
+      spanHandler_->onBatch(first, second, lo, availableSequence - lo + 1);
+      return;
+    }
+    for (int64_t sequence = lo; sequence <= hi; ++sequence) {
+      spanHandler_->onBatch(std::span<T>(&dataProvider_->get(sequence), 1), std::span<T>(),
+                            sequence, availableSequence - sequence + 1);
+    }
+  }
+
+  void publishSequence(Sequence& sequence, int64_t value) {
+    if (gatingTree_ == nullptr) [[likely]] {
+      sequence.set(value);
+    } else {
+      gatingTree_->publish(gatingMember_, value);
+    }
+  }
+
+  void handleEventException(const std::exception& ex, int64_t sequence, T* event) {
+    lifecycle_.handleEventException(ex, sequence, event, *sequenceBarrier_);
   }
 
   class TryRewindHandler final : public RewindHandler {
@@ -227,8 +427,8 @@ private:
     int64_t attemptRewindGetNextSequence(const RewindableException& e,
                                          int64_t startOfBatchSequence) override {
       if (strategy_ == nullptr) {
-        throw std::runtime_error(
-          "batchRewindStrategy cannot be null when building a BatchEventProcessor");
+        util::raise(std::runtime_error(
+          "batchRewindStrategy cannot be null when building a BatchEventProcessor"));
       }
       // Java: if handleRewindException(e, ++retriesAttempted) == REWIND -> return start; else reset
       // and throw e
@@ -237,7 +437,7 @@ private:
         return startOfBatchSequence;
       }
       owner_->retriesAttempted_ = 0;
-      throw e;
+      util::raise(e);
     }
 
   private:
@@ -249,9 +449,16 @@ private:
   public:
     int64_t attemptRewindGetNextSequence(const RewindableException& /*e*/,
                                          int64_t /*startOfBatchSequence*/) override {
-      throw std::runtime_error("Rewindable Exception thrown from a non-rewindable event handler");
+      util::raise(
+        std::runtime_error("Rewindable Exception thrown from a non-rewindable event handler"));
     }
   };
 };
 
+// C++-only: BatchEventProcessor with the handler and ring types fixed at
+// compile time. The DSL creates one for every StaticDispatchHandler.
+template <typename T, typename HandlerT, typename BarrierT, typename DataProviderT>
+  requires BatchEventHandlerFor<HandlerT, T> && DataProviderFor<DataProviderT, T>
+using StaticBatchEventProcessor = BatchEventProcessor<T, BarrierT, HandlerT, DataProviderT>;
+
 }  // namespace disruptor
@@ -4,6 +4,7 @@
 
 #include "BatchEventProcessor.h"
 #include "BatchRewindStrategy.h"
+#include "BatchSpanEventHandler.h"
 #include "DataProvider.h"
 #include "EventHandler.h"
 #include "RewindableEventHandler.h"
@@ -33,6 +34,16 @@ public:
     return processor;
   }
 
+  // C++-only: a whole-batch handler without a rewind strategy (a
+  // RewindableException from it is then handled as a failure).
+  template <typename T, typename BarrierT>
+  std::shared_ptr<BatchEventProcessor<T, BarrierT>> build(DataProvider<T>& dataProvider,
+                                                          BarrierT& sequenceBarrier,
+                                                          BatchSpanEventHandler<T>& eventHandler) {
+    return std::make_shared<BatchEventProcessor<T, BarrierT>>(
+      dataProvider, sequenceBarrier, eventHandler, maxBatchSize_, nullptr);
+  }
+
   template <typename T, typename BarrierT>
   std::shared_ptr<BatchEventProcessor<T, BarrierT>>
   build(DataProvider<T>& dataProvider,
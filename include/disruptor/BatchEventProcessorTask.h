@@ -0,0 +1,119 @@
+#pragma once
+// C++-only: runs a BatchEventProcessor on a WorkStealingExecutor instead of a
+// thread of its own (no Java equivalent).
+//
+// Each slice handles at most maxEventsPerSlice events. After a full slice the
+// task resubmits itself behind the other queued tasks. After an idle slice it
+// parks on the ring's AsyncWaitStrategy, and the next signal resubmits it.
+// Publishing signals, and so does the task after any slice that advanced its
+// sequence, so downstream stages on the executor wake up too. A halt alerts
+// the barrier, which also signals; the task then ends the processor.
+
+#include "AsyncWaitStrategy.h"
+#include "AsyncWaiter.h"
+#include "BatchEventProcessor.h"
+#include "WaitStrategy.h"
+#include "WorkStealingExecutor.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace disruptor {
+
+// What the DSL keeps for a consumer it can start on an executor.
+class ExecutorConsumer {
+public:
+  virtual ~ExecutorConsumer() = default;
+
+  virtual void start(WorkStealingExecutor& executor, int maxEventsPerSlice) = 0;
+
+  // Waits until the processor has ended after a halt.
+  virtual void join() = 0;
+};
+
+template <typename ProcessorT, typename BarrierT>
+class BatchEventProcessorTask final : public ExecutorConsumer,
+                                      private ExecutorTask,
+                                      private AsyncWaiter {
+public:
+  BatchEventProcessorTask(ProcessorT& processor, BarrierT& barrier, AsyncWaitStrategy& waitStrategy)
+    : processor_(&processor), barrier_(&barrier), waitStrategy_(&waitStrategy) {}
+
+  void start(WorkStealingExecutor& executor, int maxEventsPerSlice) override {
+    executor_ = &executor;
+    maxEventsPerSlice_ = maxEventsPerSlice;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      submitted_ = true;
+    }
+    executor.submit(*this);
+  }
+
+  void join() override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return !submitted_ || finished_; });
+  }
+
+private:
+  void runSlice() override {
+    if (!started_) {
+      started_ = true;
+      if (!processor_->startSlices()) {
+        finish();
+        return;
+      }
+    }
+
+    const int64_t before = processor_->getSequence().get();
+    const SliceResult result = processor_->runSlice(maxEventsPerSlice_);
+    if (processor_->getSequence().get() != before) {
+      waitStrategy_->signalAllWhenBlocking();
+    }
+
+    switch (result) {
+      case SliceResult::MoreAvailable:
+        executor_->submit(*this);
+        break;
+      case SliceResult::Idle:
+        if (!waitStrategy_->park(*this, [this] { return ready(); })) {
+          executor_->submit(*this);
+        }
+        break;
+      case SliceResult::Halted:
+        processor_->endSlices();
+        finish();
+        break;
+    }
+  }
+
+  void wake() override {
+    executor_->submit(*this);
+  }
+
+  bool ready() {
+    const WaitResult availableSequence =
+      barrier_->pollAvailable(processor_->getSequence().get() + 1);
+    return !availableSequence || *availableSequence > processor_->getSequence().get();
+  }
+
+  // join() may destroy the task as soon as the lock is released.
+  void finish() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    finished_ = true;
+    cv_.notify_all();
+  }
+
+  ProcessorT* processor_;
+  BarrierT* barrier_;
+  AsyncWaitStrategy* waitStrategy_;
+  WorkStealingExecutor* executor_{nullptr};
+  int maxEventsPerSlice_{1};
+  bool started_{false};
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool submitted_{false};
+  bool finished_{false};
+};
+
+}  // namespace disruptor
@@ -0,0 +1,40 @@
+#pragma once
+// C++-only: whole-batch callback for BatchEventProcessor (no Java equivalent;
+// the per-event counterpart is EventHandler).
+
+#include "RewindableEventHandler.h"
+
+#include <cstdint>
+#include <span>
+
+namespace disruptor {
+
+// Receives each batch a BatchEventProcessor takes from its barrier (capped
+// at maxBatchSize) in one call, as the ring's own slots: first, then second,
+// hold the events of startSequence onwards, second being empty unless the
+// batch wraps the end of the ring. A stage can then loop over plain arrays
+// (and let the compiler vectorise a reduction) instead of taking one virtual
+// onEvent per event.
+//
+// queueDepth: sequences available to this consumer, including the batch.
+// Like a RewindableEventHandler, onBatch may throw RewindableException to
+// have the batch redelivered under the processor's BatchRewindStrategy. Any
+// other exception goes to the ExceptionHandler with the batch's last sequence
+// and event; if it returns, the whole batch is skipped.
+//
+// Processors that only hand out single events (and providers without
+// contiguous storage, see DataProvider::getSpans) deliver one-event batches.
+template <typename T>
+class BatchSpanEventHandler : public RewindableEventHandler<T> {
+public:
+  ~BatchSpanEventHandler() override = default;
+
+  virtual void
+  onBatch(std::span<T> first, std::span<T> second, int64_t startSequence, int64_t queueDepth) = 0;
+
+  void onEvent(T& event, int64_t sequence, bool /*endOfBatch*/) final {
+    onBatch(std::span<T>(&event, 1), std::span<T>(), sequence, 1);
+  }
+};
+
+}  // namespace disruptor
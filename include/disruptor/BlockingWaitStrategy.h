@@ -17,22 +17,34 @@ class BlockingWaitStrategy final {
 public:
   static constexpr bool kIsBlockingStrategy = true;
 
-  template <typename Barrier>
+  template <typename DependentSequenceT, typename Barrier>
   int64_t waitFor(int64_t sequence,
                   const Sequence& cursorSequence,
-                  const Sequence& dependentSequence,
+                  const DependentSequenceT& dependentSequence,
                   Barrier& barrier) {
+    return waitResultOrThrow(tryWaitFor(sequence, cursorSequence, dependentSequence, barrier));
+  }
+
+  template <typename DependentSequenceT, typename Barrier>
+  WaitResult tryWaitFor(int64_t sequence,
+                        const Sequence& cursorSequence,
+                        const DependentSequenceT& dependentSequence,
+                        Barrier& barrier) {
     int64_t availableSequence;
     if (cursorSequence.get() < sequence) {
       std::unique_lock<std::mutex> lock(mutex_);
       while (cursorSequence.get() < sequence) {
-        barrier.checkAlert();
+        if (barrier.isAlerted()) {
+          return std::unexpected(ErrorCode::Alerted);
+        }
         cv_.wait(lock);
       }
     }
 
     while ((availableSequence = dependentSequence.get()) < sequence) {
-      barrier.checkAlert();
+      if (barrier.isAlerted()) {
+        return std::unexpected(ErrorCode::Alerted);
+      }
       disruptor::util::ThreadHints::onSpinWait();
     }
 
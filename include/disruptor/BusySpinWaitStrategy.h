@@ -1,7 +1,6 @@
 #pragma once
 // 1:1 port skeleton of com.lmax.disruptor.BusySpinWaitStrategy
 
-#include "AlertException.h"
 #include "Sequence.h"
 #include "WaitStrategy.h"
 
@@ -15,14 +14,24 @@ class BusySpinWaitStrategy final {
 public:
   static constexpr bool kIsBlockingStrategy = false;
 
-  template <typename Barrier>
+  template <typename DependentSequenceT, typename Barrier>
   int64_t waitFor(int64_t sequence,
-                  const Sequence& /*cursor*/,
-                  const Sequence& dependentSequence,
+                  const Sequence& cursor,
+                  const DependentSequenceT& dependentSequence,
                   Barrier& barrier) {
+    return waitResultOrThrow(tryWaitFor(sequence, cursor, dependentSequence, barrier));
+  }
+
+  template <typename DependentSequenceT, typename Barrier>
+  WaitResult tryWaitFor(int64_t sequence,
+                        const Sequence& /*cursor*/,
+                        const DependentSequenceT& dependentSequence,
+                        Barrier& barrier) {
     int64_t available;
     while ((available = dependentSequence.get()) < sequence) {
-      barrier.checkAlert();
+      if (barrier.isAlerted()) {
+        return std::unexpected(ErrorCode::Alerted);
+      }
 #if defined(_MSC_VER)
       _mm_pause();
 #elif defined(__i386__) || defined(__x86_64__)
@@ -0,0 +1,164 @@
+#pragma once
+// C++-only: BatchEventProcessor counterpart for ByteRingBuffer (no Java
+// equivalent).
+
+#include "ByteRingBuffer.h"
+#include "EventHandlerBase.h"
+#include "EventProcessor.h"
+#include "ExceptionHandler.h"
+#include "ProcessorLifecycle.h"
+#include "Sequence.h"
+#include "Sequencer.h"
+#include "WaitStrategy.h"
+
+#include <cstdint>
+#include <exception>
+
+namespace disruptor {
+
+// Same lifecycle and exception handling as BatchEventProcessor. The handler is
+// an ordinary EventHandler<ByteMessage>; onEvent gets a view of each data
+// record (padding records are skipped) and the record's start sequence.
+// A record is only delivered once all of its units are published, so the
+// processor may wait again for the tail of a record whose header it has
+// already seen. onBatchStart sizes are in units, not records. Units a claim
+// chunk published as skipped (see ClaimChunk) carry no record and are stepped
+// over one at a time. No rewind support.
+template <typename RingBufferT, typename BarrierT>
+class ByteEventProcessor final : public EventProcessor {
+public:
+  ByteEventProcessor(RingBufferT& ringBuffer,
+                     BarrierT& sequenceBarrier,
+                     EventHandlerBase<ByteMessage>& eventHandler)
+    : ringBuffer_(&ringBuffer)
+    , sequenceBarrier_(&sequenceBarrier)
+    , eventHandler_(&eventHandler)
+    , sequence_(SEQUENCER_INITIAL_CURSOR_VALUE) {}
+
+  Sequence& getSequence() override {
+    return sequence_;
+  }
+
+  void halt() override {
+    lifecycle_.halt(*sequenceBarrier_);
+  }
+
+  bool isRunning() override {
+    return lifecycle_.isRunning();
+  }
+
+  void setExceptionHandler(ExceptionHandler<ByteMessage>& exceptionHandler) {
+    lifecycle_.setExceptionHandler(exceptionHandler);
+  }
+
+  void run() override {
+    lifecycle_.run(*eventHandler_, *sequenceBarrier_, [this] { processEvents(); });
+  }
+
+private:
+  ProcessorLifecycle<ByteMessage> lifecycle_;
+  RingBufferT* ringBuffer_;
+  BarrierT* sequenceBarrier_;
+  EventHandlerBase<ByteMessage>* eventHandler_;
+  Sequence sequence_;
+
+  void processEvents() {
+    int64_t nextSequence = sequence_.get() + 1;
+    // Either nextSequence or, after a partially published record, its last unit.
+    int64_t waitSequence = nextSequence;
+
+    // As in BatchEventProcessor, alerts and timeouts are WaitResult branches.
+    while (true) {
+      const WaitResult availableSequence = lifecycle_.waitFor(*sequenceBarrier_, waitSequence);
+      if (!availableSequence) [[unlikely]] {
+        if (availableSequence.error() == ErrorCode::Timeout) {
+          lifecycle_.notifyTimeout(*eventHandler_, *sequenceBarrier_, sequence_.get());
+        } else if (lifecycle_.isHalted()) {
+          break;
+        }
+        continue;
+      }
+      if (*availableSequence < waitSequence) {
+        continue;
+      }
+
+      waitSequence = processAvailable(nextSequence, *availableSequence);
+      sequence_.set(nextSequence - 1);
+    }
+  }
+
+  // deliverRecords, stepping over a record whose handler call throws once the
+  // exception handler has seen it.
+  int64_t processAvailable(int64_t& nextSequence, int64_t availableSequence) {
+    ByteMessage message;
+    int64_t waitSequence = nextSequence;
+    ProcessorLifecycle<ByteMessage>::invokeGuarded(
+      [&] { waitSequence = deliverRecords(nextSequence, availableSequence, message); },
+      [&](const std::exception& ex) {
+        lifecycle_.handleEventException(ex, nextSequence, &message, *sequenceBarrier_);
+        nextSequence += ringBuffer_->recordUnits(nextSequence);
+        waitSequence = nextSequence;
+      });
+    return waitSequence;
+  }
+
+  // Delivers the complete records from nextSequence up to availableSequence.
+  // Returns the sequence to wait for next: nextSequence, or the last unit of
+  // a record that is only partly published.
+  int64_t deliverRecords(int64_t& nextSequence, int64_t availableSequence, ByteMessage& message) {
+    const bool skipping = maySkip();
+
+    eventHandler_->onBatchStart(availableSequence - nextSequence + 1,
+                                availableSequence - nextSequence + 1);
+    while (nextSequence <= availableSequence) {
+      const bool skipped = isSkipped(nextSequence, skipping);
+      const int64_t lastSequence =
+        skipped ? nextSequence : nextSequence + ringBuffer_->recordUnits(nextSequence) - 1;
+      if (lastSequence > availableSequence) {
+        return lastSequence;
+      }
+      if (!skipped && !ringBuffer_->isPadding(nextSequence)) {
+        message = ringBuffer_->get(nextSequence);
+        eventHandler_->onEvent(message, nextSequence,
+                               isEndOfBatch(lastSequence, availableSequence, skipping));
+      }
+      nextSequence = lastSequence + 1;
+    }
+    return nextSequence;
+  }
+
+  // True if no complete record follows lastSequence within the available range.
+  // A skipped unit next ends the batch early rather than scanning past it.
+  bool isEndOfBatch(int64_t lastSequence, int64_t availableSequence, bool skipping) const {
+    if (lastSequence >= availableSequence) {
+      return true;
+    }
+    if (isSkipped(lastSequence + 1, skipping)) {
+      return true;
+    }
+    return lastSequence + ringBuffer_->recordUnits(lastSequence + 1) > availableSequence;
+  }
+
+  static constexpr bool kMaySkip =
+    requires(BarrierT& barrier, int64_t sequence) { barrier.isSkipped(sequence); };
+
+  // isSkipped() is only consulted once the sequencer has handed out a claim
+  // chunk, as in BatchEventProcessor.
+  bool maySkip() const {
+    if constexpr (kMaySkip) {
+      return sequenceBarrier_->hasSkippedSequences();
+    } else {
+      return false;
+    }
+  }
+
+  bool isSkipped(int64_t sequence, bool skipping) const {
+    if constexpr (kMaySkip) {
+      return skipping && sequenceBarrier_->isSkipped(sequence);
+    } else {
+      return false;
+    }
+  }
+};
+
+}  // namespace disruptor
@@ -0,0 +1,245 @@
+#pragma once
+// C++-only: variable-length byte-message ring on top of the Disruptor
+// sequencers (no Java equivalent).
+
+#include "Cursored.h"
+#include "Error.h"
+#include "MultiProducerSequencer.h"
+#include "ParityBitmapAvailableBuffer.h"
+#include "Sequence.h"
+#include "SingleProducerSequencer.h"
+#include "util/ExceptionSupport.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace disruptor {
+
+// What consumers of a ByteRingBuffer receive: a view straight into the ring,
+// valid until the consumer's sequence moves past the record.
+using ByteMessage = std::span<const std::byte>;
+
+// A claimed record: write the message into payload, then publish(claim).
+struct ByteClaim {
+  int64_t sequence;      // first unit (the record header)
+  int64_t lastSequence;  // last unit of the record
+  std::span<std::byte> payload;
+};
+
+// The sequencer counts 8-byte units instead of events: a message of N bytes
+// is one record of 1 + ceil(N / 8) consecutive sequences, an 8-byte header
+// (length, type) followed by the payload. Records never straddle the end of
+// the ring: a claim that would is published as a padding record, which
+// consumers skip, and the claim is retried. Everything else (gating,
+// barriers, consumer graphs, multi-producer publication) is the sequencer's.
+//
+// Sequences handed to consumers are record start units; a consumer's
+// Sequence holds the last unit it has consumed. Messages are limited to half
+// the ring (maxMessageLength()) so the retry after a padding record always
+// fits.
+template <typename SequencerT>
+class ByteRingBuffer final : public Cursored {
+public:
+  using SequencerType = SequencerT;
+
+  static constexpr std::size_t kUnitBytes = 8;
+
+  template <typename... SequencerArgs>
+  static std::shared_ptr<ByteRingBuffer> create(SequencerArgs&&... sequencerArgs) {
+    return std::make_shared<ByteRingBuffer>(std::in_place,
+                                            std::forward<SequencerArgs>(sequencerArgs)...);
+  }
+
+  // sequencerArgs: ring size in units (bytes / 8) and the wait strategy.
+  template <typename... SequencerArgs>
+  explicit ByteRingBuffer(std::in_place_t, SequencerArgs&&... sequencerArgs)
+    : sequencer_(std::forward<SequencerArgs>(sequencerArgs)...)
+    , bufferSize_(sequencer_.getBufferSize())
+    , units_(static_cast<std::size_t>(bufferSize_))
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    , bytes_(reinterpret_cast<std::byte*>(units_.data())) {
+    if (bufferSize_ < 4) {
+      util::raise(std::invalid_argument("ByteRingBuffer needs at least 4 units"));
+    }
+  }
+
+  std::size_t maxMessageLength() const {
+    return static_cast<std::size_t>(bufferSize_ / 2 - 1) * kUnitBytes;
+  }
+
+  ByteClaim next(std::size_t length) {
+    const int units = unitsFor(length);
+    while (true) {
+      const int64_t hi = sequencer_.next(units);
+      const int64_t lo = hi - units + 1;
+      if (fits(lo, units)) {
+        return claimAt(lo, hi, length);
+      }
+      publishPadding(lo, hi);
+    }
+  }
+
+  std::expected<ByteClaim, Error> tryNext(std::size_t length) {
+    if (length > maxMessageLength()) [[unlikely]] {
+      return std::unexpected(Error::invalid_argument("message longer than maxMessageLength()"));
+    }
+    const int units = unitsFor(length);
+    while (true) {
+      auto hi = sequencer_.tryNext(units);
+      if (!hi) {
+        return std::unexpected(std::move(hi.error()));
+      }
+      const int64_t lo = *hi - units + 1;
+      if (fits(lo, units)) {
+        return claimAt(lo, *hi, length);
+      }
+      publishPadding(lo, *hi);
+    }
+  }
+
+  void publish(const ByteClaim& claim) {
+    sequencer_.publish(claim.sequence, claim.lastSequence);
+  }
+
+  // Claims, copies and publishes; returns the record's sequence.
+  int64_t publish(ByteMessage message) {
+    const ByteClaim claim = next(message.size());
+    if (!message.empty()) {
+      std::memcpy(claim.payload.data(), message.data(), message.size());
+    }
+    publish(claim);
+    return claim.sequence;
+  }
+
+  // The message whose record starts at sequence (a data record).
+  ByteMessage get(int64_t sequence) const {
+    const RecordHeader header = headerAt(sequence);
+    return ByteMessage(payloadAt(sequence), static_cast<std::size_t>(header.length));
+  }
+
+  // Units (sequences) taken by the record starting at sequence; padding
+  // records included.
+  int recordUnits(int64_t sequence) const {
+    return unitsFor(static_cast<std::size_t>(headerAt(sequence).length));
+  }
+
+  bool isPadding(int64_t sequence) const {
+    return headerAt(sequence).type == kPadding;
+  }
+
+  // Cursored
+  int64_t getCursor() const override {
+    return sequencer_.getCursor();
+  }
+
+  SequencerT& getSequencer() {
+    return sequencer_;
+  }
+
+  int getBufferSize() const {
+    return bufferSize_;
+  }
+
+  void addGatingSequences(Sequence* const* gatingSequences, int count) {
+    sequencer_.addGatingSequences(gatingSequences, count);
+  }
+
+  void addGatingSequences(Sequence& gatingSequence) {
+    std::array<Sequence*, 1> arr = {&gatingSequence};
+    addGatingSequences(arr.data(), 1);
+  }
+
+  bool removeGatingSequence(Sequence& sequence) {
+    return sequencer_.removeGatingSequence(sequence);
+  }
+
+  auto newBarrier(Sequence* const* sequencesToTrack, int count) {
+    return sequencer_.newBarrier(sequencesToTrack, count);
+  }
+
+  auto newBarrier() {
+    return newBarrier(nullptr, 0);
+  }
+
+  int64_t remainingCapacity() {
+    return sequencer_.remainingCapacity();
+  }
+
+private:
+  struct RecordHeader {
+    int32_t length;
+    int32_t type;
+  };
+  static_assert(sizeof(RecordHeader) == kUnitBytes);
+
+  static constexpr int32_t kData = 0;
+  static constexpr int32_t kPadding = 1;
+
+  SequencerT sequencer_;
+  int bufferSize_;
+  std::vector<uint64_t> units_;
+  std::byte* bytes_;
+
+  int unitsFor(std::size_t length) const {
+    if (length > maxMessageLength()) {
+      util::raise(std::invalid_argument("message longer than maxMessageLength()"));
+    }
+    return 1 + static_cast<int>((length + kUnitBytes - 1) / kUnitBytes);
+  }
+
+  bool fits(int64_t lo, int units) const {
+    return (static_cast<int>(lo) & (bufferSize_ - 1)) + units <= bufferSize_;
+  }
+
+  std::byte* unitAt(int64_t sequence) const {
+    const auto index = static_cast<std::size_t>(static_cast<int>(sequence) & (bufferSize_ - 1));
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return bytes_ + index * kUnitBytes;
+  }
+
+  std::byte* payloadAt(int64_t sequence) const {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return unitAt(sequence) + kUnitBytes;
+  }
+
+  RecordHeader headerAt(int64_t sequence) const {
+    RecordHeader header;
+    std::memcpy(&header, unitAt(sequence), sizeof(header));
+    return header;
+  }
+
+  void writeHeader(int64_t sequence, std::size_t length, int32_t type) {
+    const RecordHeader header{static_cast<int32_t>(length), type};
+    std::memcpy(unitAt(sequence), &header, sizeof(header));
+  }
+
+  ByteClaim claimAt(int64_t lo, int64_t hi, std::size_t length) {
+    writeHeader(lo, length, kData);
+    return ByteClaim{lo, hi, std::span<std::byte>(payloadAt(lo), length)};
+  }
+
+  // The padding record covers the whole failed claim; only its header is
+  // written, so it may wrap.
+  void publishPadding(int64_t lo, int64_t hi) {
+    writeHeader(lo, static_cast<std::size_t>(hi - lo) * kUnitBytes, kPadding);
+    sequencer_.publish(lo, hi);
+  }
+};
+
+template <typename WaitStrategyT>
+using SingleProducerByteRingBuffer = ByteRingBuffer<SingleProducerSequencer<WaitStrategyT>>;
+
+// The parity bitmap publishes a record's units with one RMW per 64 units.
+template <typename WaitStrategyT>
+using MultiProducerByteRingBuffer =
+  ByteRingBuffer<MultiProducerSequencer<WaitStrategyT, ParityBitmapAvailableBuffer>>;
+
+}  // namespace disruptor
@@ -0,0 +1,106 @@
+#pragma once
+// C++-only: per-producer claim chunks for MultiProducerSequencer (no Java
+// equivalent).
+
+#include "Error.h"
+#include "util/ExceptionSupport.h"
+
+#include <cstdint>
+#include <expected>
+#include <stdexcept>
+
+namespace disruptor {
+
+// One producer's handle on a MultiProducerSequencer: claims chunkSize
+// sequences with a single getAndAdd on the shared cursor and hands them out
+// one at a time, so single-event producers stop contending on the cursor line
+// for every event. Create one per producer thread
+// (MultiProducerSequencer::newClaimChunk / RingBuffer::newClaimChunk); it is
+// not thread-safe.
+//
+// Consumers wait for every sequence in order, so a partly used chunk holds
+// them back until its owner claims and publishes the rest. flush() (also run
+// by the destructor) publishes the unused tail as skipped: BatchEventProcessor,
+// ColumnarBatchEventProcessor, ByteEventProcessor, WorkProcessor and
+// EventPoller step over skipped sequences without calling the handler.
+// Call it whenever the producer may go idle.
+template <typename SequencerT>
+class ClaimChunk final {
+public:
+  ClaimChunk(SequencerT& sequencer, int chunkSize) : sequencer_(&sequencer), chunkSize_(chunkSize) {
+    if (chunkSize < 1 || chunkSize > sequencer.getBufferSize()) {
+      util::raise(std::invalid_argument("chunkSize must be > 0 and <= bufferSize"));
+    }
+  }
+
+  ClaimChunk(ClaimChunk&& other) noexcept
+    : sequencer_(other.sequencer_)
+    , chunkSize_(other.chunkSize_)
+    , next_(other.next_)
+    , last_(other.last_) {
+    other.next_ = other.last_ + 1;
+  }
+
+  ClaimChunk(const ClaimChunk&) = delete;
+  ClaimChunk& operator=(const ClaimChunk&) = delete;
+  ClaimChunk& operator=(ClaimChunk&&) = delete;
+
+  ~ClaimChunk() {
+    flush();
+  }
+
+  int64_t next() {
+    if (next_ > last_) [[unlikely]] {
+      last_ = sequencer_->next(chunkSize_);
+      next_ = last_ - chunkSize_ + 1;
+    }
+    return next_++;
+  }
+
+  // Falls back to a single sequence when a whole chunk does not fit.
+  std::expected<int64_t, Error> tryNext() {
+    if (next_ > last_) [[unlikely]] {
+      auto claimed = sequencer_->tryNext(chunkSize_);
+      int claimedSize = chunkSize_;
+      if (!claimed.has_value() && chunkSize_ > 1) {
+        claimed = sequencer_->tryNext(1);
+        claimedSize = 1;
+      }
+      if (!claimed.has_value()) {
+        return claimed;
+      }
+      last_ = *claimed;
+      next_ = last_ - claimedSize + 1;
+    }
+    return next_++;
+  }
+
+  void publish(int64_t sequence) {
+    sequencer_->publish(sequence);
+  }
+
+  // Publishes the claimed but unused sequences as skipped.
+  void flush() {
+    if (next_ <= last_) {
+      sequencer_->publishSkipped(next_, last_);
+      next_ = last_ + 1;
+    }
+  }
+
+  // Sequences claimed but not yet handed out by next().
+  int remaining() const {
+    return static_cast<int>(last_ - next_ + 1);
+  }
+
+  int chunkSize() const {
+    return chunkSize_;
+  }
+
+private:
+  SequencerT* sequencer_;
+  int chunkSize_;
+  int64_t next_{0};
+  int64_t last_{-1};
+};
+
+}  // namespace disruptor
@@ -0,0 +1,83 @@
+#pragma once
+// C++-only: view over a contiguous sequence range of a ColumnarRingBuffer (no
+// Java equivalent).
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <tuple>
+
+namespace disruptor {
+
+// One column of a sequence range. A range that wraps past the end of the ring
+// is split in two; second is empty otherwise.
+template <typename T>
+struct ColumnSpan {
+  std::span<T> first;
+  std::span<T> second;
+
+  std::size_t size() const noexcept {
+    return first.size() + second.size();
+  }
+};
+
+// Sequences [firstSequence, lastSequence] of a columnar ring. Holds only the
+// column base pointers, so it is cheap to copy and independent of the
+// sequencer type.
+template <typename... Columns>
+class ColumnarBatch final {
+public:
+  template <std::size_t I>
+  using ColumnType = std::tuple_element_t<I, std::tuple<Columns...>>;
+
+  ColumnarBatch(std::tuple<Columns*...> columns,
+                int bufferSize,
+                int64_t firstSequence,
+                int64_t lastSequence)
+    : columns_(columns)
+    , bufferSize_(bufferSize)
+    , firstSequence_(firstSequence)
+    , lastSequence_(lastSequence) {}
+
+  int64_t firstSequence() const noexcept {
+    return firstSequence_;
+  }
+
+  int64_t lastSequence() const noexcept {
+    return lastSequence_;
+  }
+
+  int64_t size() const noexcept {
+    return lastSequence_ - firstSequence_ + 1;
+  }
+
+  template <std::size_t I>
+  ColumnSpan<ColumnType<I>> column() const {
+    ColumnType<I>* base = std::get<I>(columns_);
+    const int start = index(firstSequence_);
+    const auto count = static_cast<std::size_t>(size());
+    const auto head = (std::min)(count, static_cast<std::size_t>(bufferSize_ - start));
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return {std::span<ColumnType<I>>(base + start, head),
+            std::span<ColumnType<I>>(base, count - head)};
+  }
+
+  template <std::size_t I>
+  ColumnType<I>& get(int64_t sequence) const {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return std::get<I>(columns_)[index(sequence)];
+  }
+
+private:
+  std::tuple<Columns*...> columns_;
+  int bufferSize_;
+  int64_t firstSequence_;
+  int64_t lastSequence_;
+
+  int index(int64_t sequence) const {
+    return static_cast<int>(sequence) & (bufferSize_ - 1);
+  }
+};
+
+}  // namespace disruptor
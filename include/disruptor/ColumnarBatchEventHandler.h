@@ -0,0 +1,25 @@
+#pragma once
+// C++-only: batch callback for ColumnarBatchEventProcessor (no Java
+// equivalent; the per-event counterpart is EventHandler).
+
+#include "ColumnarBatch.h"
+
+#include <cstdint>
+
+namespace disruptor {
+
+// Receives whole batches as per-column spans instead of one event at a time,
+// so a stage can loop over a single column (e.g. batch.column<0>().first).
+template <typename... Columns>
+class ColumnarBatchEventHandler {
+public:
+  virtual ~ColumnarBatchEventHandler() = default;
+
+  // queueDepth: sequences available to this consumer, including the batch.
+  virtual void onBatch(const ColumnarBatch<Columns...>& batch, int64_t queueDepth) = 0;
+  virtual void onStart() {}
+  virtual void onShutdown() {}
+  virtual void onTimeout(int64_t /*sequence*/) {}
+};
+
+}  // namespace disruptor
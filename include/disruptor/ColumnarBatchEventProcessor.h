@@ -0,0 +1,157 @@
+#pragma once
+// C++-only: BatchEventProcessor counterpart for ColumnarRingBuffer (no Java
+// equivalent).
+
+#include "ColumnarBatch.h"
+#include "ColumnarBatchEventHandler.h"
+#include "EventProcessor.h"
+#include "ExceptionHandler.h"
+#include "ProcessorLifecycle.h"
+#include "Sequence.h"
+#include "Sequencer.h"
+#include "WaitStrategy.h"
+#include "util/ExceptionSupport.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <stdexcept>
+
+namespace disruptor {
+
+namespace detail {
+template <typename Batch>
+struct ColumnarHandlerFor;
+
+template <typename... Columns>
+struct ColumnarHandlerFor<ColumnarBatch<Columns...>> {
+  using type = ColumnarBatchEventHandler<Columns...>;
+};
+}  // namespace detail
+
+// Same lifecycle and wait loop as BatchEventProcessor, but hands the handler
+// one ColumnarBatch per waitFor() (capped at maxBatchSize) instead of calling
+// onEvent per sequence. Sequences a claim chunk published as skipped (see
+// ClaimChunk) split the batch: each run between them is its own onBatch.
+// There is no rewind support. An exception from onBatch goes to the
+// ExceptionHandler with the batch as the event; if it returns, the whole
+// batch is skipped.
+template <typename RingBufferT, typename BarrierT>
+class ColumnarBatchEventProcessor final : public EventProcessor {
+public:
+  using Batch = typename RingBufferT::Batch;
+  using Handler = typename detail::ColumnarHandlerFor<Batch>::type;
+
+  ColumnarBatchEventProcessor(RingBufferT& ringBuffer,
+                              BarrierT& sequenceBarrier,
+                              Handler& eventHandler,
+                              int maxBatchSize)
+    : ringBuffer_(&ringBuffer)
+    , sequenceBarrier_(&sequenceBarrier)
+    , eventHandler_(&eventHandler)
+    , batchLimitOffset_(maxBatchSize - 1)
+    , sequence_(SEQUENCER_INITIAL_CURSOR_VALUE) {
+    if (maxBatchSize < 1) {
+      util::raise(std::invalid_argument("maxBatchSize must be greater than 0"));
+    }
+  }
+
+  Sequence& getSequence() override {
+    return sequence_;
+  }
+
+  void halt() override {
+    lifecycle_.halt(*sequenceBarrier_);
+  }
+
+  bool isRunning() override {
+    return lifecycle_.isRunning();
+  }
+
+  void setExceptionHandler(ExceptionHandler<Batch>& exceptionHandler) {
+    lifecycle_.setExceptionHandler(exceptionHandler);
+  }
+
+  void run() override {
+    lifecycle_.run(*eventHandler_, *sequenceBarrier_, [this] { processEvents(); });
+  }
+
+private:
+  ProcessorLifecycle<Batch> lifecycle_;
+  RingBufferT* ringBuffer_;
+  BarrierT* sequenceBarrier_;
+  Handler* eventHandler_;
+  int batchLimitOffset_;
+  Sequence sequence_;
+
+  void processEvents() {
+    int64_t nextSequence = sequence_.get() + 1;
+
+    // As in BatchEventProcessor, alerts and timeouts are WaitResult branches;
+    // only the onBatch call is guarded.
+    while (true) {
+      const WaitResult availableSequence = lifecycle_.waitFor(*sequenceBarrier_, nextSequence);
+      if (!availableSequence) [[unlikely]] {
+        if (availableSequence.error() == ErrorCode::Timeout) {
+          lifecycle_.notifyTimeout(*eventHandler_, *sequenceBarrier_, sequence_.get());
+        } else if (lifecycle_.isHalted()) {
+          break;
+        }
+        continue;
+      }
+      if (*availableSequence < nextSequence) {
+        continue;
+      }
+      const int64_t endOfBatchSequence =
+        (std::min)(nextSequence + batchLimitOffset_, *availableSequence);
+
+      if (!processBatch(nextSequence, endOfBatchSequence, *availableSequence)) {
+        break;
+      }
+      sequence_.set(endOfBatchSequence);
+      nextSequence = endOfBatchSequence + 1;
+    }
+  }
+
+  // Hands [lo, hi] to onBatch, one call per run of unskipped sequences. False
+  // if the exception handler halted the processor.
+  bool processBatch(int64_t lo, int64_t hi, int64_t availableSequence) {
+    if constexpr (kMaySkip) {
+      if (sequenceBarrier_->hasSkippedSequences()) [[unlikely]] {
+        while (lo <= hi) {
+          if (sequenceBarrier_->isSkipped(lo)) {
+            ++lo;
+            continue;
+          }
+          int64_t runEnd = lo;
+          while (runEnd < hi && !sequenceBarrier_->isSkipped(runEnd + 1)) {
+            ++runEnd;
+          }
+          if (!deliverBatch(lo, runEnd, availableSequence)) {
+            return false;
+          }
+          lo = runEnd + 1;
+        }
+        return true;
+      }
+    }
+    return deliverBatch(lo, hi, availableSequence);
+  }
+
+  bool deliverBatch(int64_t lo, int64_t hi, int64_t availableSequence) {
+    Batch batch = ringBuffer_->batch(lo, hi);
+    bool handled = true;
+    ProcessorLifecycle<Batch>::invokeGuarded(
+      [&] { eventHandler_->onBatch(batch, availableSequence - lo + 1); },
+      [&](const std::exception& ex) {
+        handled = lifecycle_.handleEventException(ex, lo, &batch, *sequenceBarrier_);
+      });
+    return handled;
+  }
+
+  // The barrier's sequencer may publish skipped sequences (claim chunks).
+  static constexpr bool kMaySkip =
+    requires(BarrierT& barrier, int64_t sequence) { barrier.isSkipped(sequence); };
+};
+
+}  // namespace disruptor
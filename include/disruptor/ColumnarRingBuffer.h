@@ -0,0 +1,211 @@
+#pragma once
+// C++-only: structure-of-arrays variant of RingBuffer (no Java equivalent).
+
+#include "ColumnarBatch.h"
+#include "Cursored.h"
+#include "Error.h"
+#include "MultiProducerSequencer.h"
+#include "Sequence.h"
+#include "SingleProducerSequencer.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace disruptor {
+
+namespace detail {
+
+// Fixed-size column allocated on a 128-byte boundary and rounded up to a whole
+// number of 128-byte blocks, so neither end shares a prefetch block with other
+// heap data (the columnar counterpart of RingBuffer's BUFFER_PAD).
+template <typename T>
+class AlignedColumn final {
+public:
+  static constexpr std::size_t kAlignment = 128;
+
+  explicit AlignedColumn(std::size_t size)
+    : data_(static_cast<T*>(::operator new(allocationSize(size), std::align_val_t{kAlignment})))
+    , size_(size) {
+    std::uninitialized_value_construct_n(data_, size_);
+  }
+
+  AlignedColumn(AlignedColumn&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr))
+    , size_(std::exchange(other.size_, 0)) {}
+
+  ~AlignedColumn() {
+    if (data_ != nullptr) {
+      ::operator delete(data_, std::align_val_t{kAlignment});
+    }
+  }
+
+  AlignedColumn(const AlignedColumn&) = delete;
+  AlignedColumn& operator=(const AlignedColumn&) = delete;
+  AlignedColumn& operator=(AlignedColumn&&) = delete;
+
+  T* data() const noexcept {
+    return data_;
+  }
+
+private:
+  T* data_;
+  std::size_t size_;
+
+  static std::size_t allocationSize(std::size_t size) {
+    return (size * sizeof(T) + kAlignment - 1) / kAlignment * kAlignment;
+  }
+};
+
+}  // namespace detail
+
+// Each event field lives in its own aligned array instead of one
+// std::vector<E>, so a stage that reads a single field streams only that
+// column through the cache and can vectorise over ColumnarBatch::column<I>().
+//
+// Columns must be trivially copyable (plain fields; slots are reused in place
+// and never destroyed individually). get(sequence) returns a tuple of
+// references, usable with structured bindings:
+//   auto [price, quantity] = ringBuffer.get(sequence);
+template <typename SequencerT, typename... Columns>
+class ColumnarRingBuffer final : public Cursored {
+  static_assert(sizeof...(Columns) > 0, "ColumnarRingBuffer requires at least one column");
+  static_assert((std::is_trivially_copyable_v<Columns> && ...),
+                "ColumnarRingBuffer columns must be trivially copyable");
+
+public:
+  using SequencerType = SequencerT;
+  using Batch = ColumnarBatch<Columns...>;
+
+  template <std::size_t I>
+  using ColumnType = std::tuple_element_t<I, std::tuple<Columns...>>;
+
+  template <typename... SequencerArgs>
+  static std::shared_ptr<ColumnarRingBuffer> create(SequencerArgs&&... sequencerArgs) {
+    return std::make_shared<ColumnarRingBuffer>(std::in_place,
+                                                std::forward<SequencerArgs>(sequencerArgs)...);
+  }
+
+  template <typename... SequencerArgs>
+  explicit ColumnarRingBuffer(std::in_place_t, SequencerArgs&&... sequencerArgs)
+    : sequencer_(std::forward<SequencerArgs>(sequencerArgs)...)
+    , bufferSize_(sequencer_.getBufferSize())
+    , columns_(detail::AlignedColumn<Columns>(static_cast<std::size_t>(bufferSize_))...) {}
+
+  std::tuple<Columns&...> get(int64_t sequence) {
+    const int index = static_cast<int>(sequence) & (bufferSize_ - 1);
+    return std::apply(
+      [index](auto&... column) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return std::tuple<Columns&...>(column.data()[index]...);
+      },
+      columns_);
+  }
+
+  template <std::size_t I>
+  ColumnType<I>& get(int64_t sequence) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return std::get<I>(columns_).data()[static_cast<int>(sequence) & (bufferSize_ - 1)];
+  }
+
+  Batch batch(int64_t firstSequence, int64_t lastSequence) {
+    return Batch(std::apply([](auto&... column) { return std::tuple(column.data()...); }, columns_),
+                 bufferSize_, firstSequence, lastSequence);
+  }
+
+  template <std::size_t I>
+  ColumnSpan<ColumnType<I>> column(int64_t firstSequence, int64_t lastSequence) {
+    return batch(firstSequence, lastSequence).template column<I>();
+  }
+
+  // Cursored
+  int64_t getCursor() const override {
+    return sequencer_.getCursor();
+  }
+
+  SequencerT& getSequencer() {
+    return sequencer_;
+  }
+
+  int getBufferSize() const {
+    return bufferSize_;
+  }
+
+  void addGatingSequences(Sequence* const* gatingSequences, int count) {
+    sequencer_.addGatingSequences(gatingSequences, count);
+  }
+
+  void addGatingSequences(Sequence& gatingSequence) {
+    std::array<Sequence*, 1> arr = {&gatingSequence};
+    addGatingSequences(arr.data(), 1);
+  }
+
+  bool removeGatingSequence(Sequence& sequence) {
+    return sequencer_.removeGatingSequence(sequence);
+  }
+
+  int64_t getMinimumGatingSequence() {
+    return sequencer_.getMinimumSequence();
+  }
+
+  auto newBarrier(Sequence* const* sequencesToTrack, int count) {
+    return sequencer_.newBarrier(sequencesToTrack, count);
+  }
+
+  auto newBarrier() {
+    return newBarrier(nullptr, 0);
+  }
+
+  bool hasAvailableCapacity(int requiredCapacity) {
+    return sequencer_.hasAvailableCapacity(requiredCapacity);
+  }
+
+  int64_t remainingCapacity() {
+    return sequencer_.remainingCapacity();
+  }
+
+  int64_t next() {
+    return sequencer_.next();
+  }
+
+  int64_t next(int n) {
+    return sequencer_.next(n);
+  }
+
+  std::expected<int64_t, Error> tryNext() {
+    return sequencer_.tryNext();
+  }
+
+  std::expected<int64_t, Error> tryNext(int n) {
+    return sequencer_.tryNext(n);
+  }
+
+  void publish(int64_t sequence) {
+    sequencer_.publish(sequence);
+  }
+
+  void publish(int64_t lo, int64_t hi) {
+    sequencer_.publish(lo, hi);
+  }
+
+private:
+  SequencerT sequencer_;
+  int bufferSize_;
+  std::tuple<detail::AlignedColumn<Columns>...> columns_;
+};
+
+template <typename WaitStrategyT, typename... Columns>
+using SingleProducerColumnarRingBuffer =
+  ColumnarRingBuffer<SingleProducerSequencer<WaitStrategyT>, Columns...>;
+
+template <typename WaitStrategyT, typename... Columns>
+using MultiProducerColumnarRingBuffer =
+  ColumnarRingBuffer<MultiProducerSequencer<WaitStrategyT>, Columns...>;
+
+}  // namespace disruptor
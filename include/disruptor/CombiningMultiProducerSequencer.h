@@ -0,0 +1,294 @@
+#pragma once
+// C++-only: flat-combining alternative to MultiProducerSequencer (no Java
+// equivalent). Drop-in SequencerT:
+//   RingBuffer<E, CombiningMultiProducerSequencer<WaitStrategyT>>
+//   dsl::Disruptor<E, ProducerType::MULTI_COMBINING, WaitStrategyT>
+
+#include "AbstractSequencer.h"
+#include "AvailableBuffer.h"
+#include "Error.h"
+#include "ProcessingSequenceBarrier.h"
+#include "Sequence.h"
+#include "SequenceGroupView.h"
+#include "WaitStrategy.h"
+#include "util/ExceptionSupport.h"
+#include "util/MappedAllocator.h"
+#include "util/ThreadHints.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <stdexcept>
+
+namespace disruptor {
+
+// Claims go through flat combining instead of a getAndAdd per producer. A
+// producer posts its request (n sequences) into a per-thread slot, then either
+// takes the combiner role or waits for its slot to be served. The combiner
+// collects every pending request, checks capacity once, advances the cursor
+// once for all of them and hands each producer its range. Under heavy
+// contention the cursor and the cached gating sequence are written by one
+// thread at a time instead of bouncing between all producers, and each
+// producer spins on its own slot's line.
+//
+// The cost is a slot post and a handoff on every claim, so the plain
+// MultiProducerSequencer remains faster with few producers. Publication is
+// unchanged: the same AvailableBufferT tracking as MultiProducerSequencer.
+//
+// Requests are served in slot order within a pass. A blocking request that
+// does not fit waits for a later pass, and so does every blocking request
+// behind it; a tryNext() request that does not fit, or sits behind a waiting
+// one, fails. More than kSlots concurrently claiming threads share slots and
+// wait for a free one.
+template <typename WaitStrategyT,
+          template <int> class AvailableBufferT = AvailableBuffer,
+          int BufferSize = kDynamicBufferSize>
+class CombiningMultiProducerSequencer final
+  : public AbstractSequencer<WaitStrategyT, BufferSize> {
+  using Base = AbstractSequencer<WaitStrategyT, BufferSize>;
+
+public:
+  static constexpr int kSlots = 64;
+
+  CombiningMultiProducerSequencer(int bufferSize,
+                                  WaitStrategyT& waitStrategy,
+                                  const util::MemoryPolicy& memoryPolicy = {})
+    : Base(bufferSize, waitStrategy), availableBuffer_(bufferSize, memoryPolicy) {}
+
+  explicit CombiningMultiProducerSequencer(WaitStrategyT& waitStrategy,
+                                           const util::MemoryPolicy& memoryPolicy = {})
+    requires(BufferSize != kDynamicBufferSize)
+    : CombiningMultiProducerSequencer(BufferSize, waitStrategy, memoryPolicy) {}
+
+  bool hasAvailableCapacity(int requiredCapacity) {
+    const int64_t cursorValue = this->cursor_.get();
+    const int64_t wrapPoint = (cursorValue + requiredCapacity) - this->bufferSize_.size();
+    return wrapPoint <= minimumSequence(cursorValue);
+  }
+
+  void claim(int64_t sequence) {
+    this->cursor_.set(sequence);
+  }
+
+  int64_t next() {
+    return next(1);
+  }
+
+  int64_t next(int n) {
+    if (n < 1 || n > this->bufferSize_.size()) {
+      util::raise(std::invalid_argument("n must be > 0 and < bufferSize"));
+    }
+    return awaitClaim(n);
+  }
+
+  std::expected<int64_t, Error> tryNext() {
+    return tryNext(1);
+  }
+
+  std::expected<int64_t, Error> tryNext(int n) {
+    if (n < 1) [[unlikely]] {
+      return std::unexpected(Error::invalid_argument("n must be > 0"));
+    }
+    if (n > this->bufferSize_.size()) [[unlikely]] {
+      return std::unexpected(Error::insufficient_capacity());
+    }
+    const int64_t claimed = awaitClaim(n | kTryFlag);
+    if (claimed == kFailed) [[unlikely]] {
+      return std::unexpected(Error::insufficient_capacity());
+    }
+    return claimed;
+  }
+
+  int64_t remainingCapacity() {
+    const int64_t produced = this->cursor_.get();
+    const int64_t consumed = minimumSequence(produced);
+    return this->getBufferSize() - (produced - consumed);
+  }
+
+  void publish(int64_t sequence) {
+    availableBuffer_.setAvailable(sequence);
+    if constexpr (WaitStrategyT::kIsBlockingStrategy) {
+      this->waitStrategy_->signalAllWhenBlocking();
+    }
+  }
+
+  void publish(int64_t lo, int64_t hi) {
+    availableBuffer_.setAvailable(lo, hi);
+    if constexpr (WaitStrategyT::kIsBlockingStrategy) {
+      this->waitStrategy_->signalAllWhenBlocking();
+    }
+  }
+
+  bool isAvailable(int64_t sequence) {
+    return availableBuffer_.isAvailable(sequence);
+  }
+
+  int64_t getHighestPublishedSequence(int64_t lowerBound, int64_t availableSequence) {
+    return availableBuffer_.getHighestPublishedSequence(lowerBound, availableSequence);
+  }
+
+  std::shared_ptr<ProcessingSequenceBarrier<CombiningMultiProducerSequencer, WaitStrategyT>>
+  newBarrier(Sequence* const* sequencesToTrack, int count) {
+    return std::make_shared<
+      ProcessingSequenceBarrier<CombiningMultiProducerSequencer, WaitStrategyT>>(
+      *this, *this->waitStrategy_, this->cursor_, sequencesToTrack, count);
+  }
+
+  template <std::size_t N>
+  auto newBarrier(const std::array<Sequence*, N>& sequencesToTrack) {
+    using BarrierT = ProcessingSequenceBarrier<CombiningMultiProducerSequencer,
+                                               WaitStrategyT,
+                                               SequenceGroupView<(N == 0 ? 1 : N)>>;
+    return std::make_shared<BarrierT>(*this, *this->waitStrategy_, this->cursor_,
+                                      sequencesToTrack.data(), static_cast<int>(N));
+  }
+
+private:
+  // Slot state: kFree, a pending request (n, | kTryFlag for tryNext) or
+  // kServed with the result (last claimed sequence, or kFailed) in claimed.
+  // kPending is combine()'s "not served yet".
+  static constexpr int64_t kFree = 0;
+  static constexpr int64_t kServed = -1;
+  static constexpr int64_t kTryFlag = int64_t{1} << 32;
+  static constexpr int64_t kFailed = -2;
+  static constexpr int64_t kPending = -3;
+
+  struct alignas(128) Slot {
+    std::atomic<int64_t> state{kFree};
+    int64_t claimed{0};
+  };
+
+  // The combiner lock and what only its holder touches.
+  struct alignas(128) CombinerState {
+    std::atomic<bool> combining{false};
+    int64_t gatingSequenceCache{SEQUENCER_INITIAL_CURSOR_VALUE};
+  };
+
+  AvailableBufferT<BufferSize> availableBuffer_;
+  CombinerState combiner_;
+  alignas(128) std::atomic<int> slotsInUse_{0};
+  std::array<Slot, kSlots> slots_;
+
+  // A thread that gets the combiner role straight away serves its own
+  // request without posting it; otherwise it posts and waits, retrying the
+  // role while its slot is pending.
+  int64_t awaitClaim(int64_t request) {
+    Slot* slot = nullptr;
+    while (true) {
+      if (slot != nullptr && slot->state.load(std::memory_order_acquire) == kServed) {
+        const int64_t claimed = slot->claimed;
+        slot->state.store(kFree, std::memory_order_release);
+        return claimed;
+      }
+      if (!combiner_.combining.load(std::memory_order_relaxed)
+          && !combiner_.combining.exchange(true, std::memory_order_acquire)) {
+        const int64_t claimed = combine(slot == nullptr ? request : kFree);
+        combiner_.combining.store(false, std::memory_order_release);
+        if (claimed != kPending) {
+          return claimed;
+        }
+        continue;
+      }
+      if (slot == nullptr) {
+        slot = &post(request);
+        continue;
+      }
+      util::ThreadHints::onSpinWait();
+    }
+  }
+
+  // Claims a free slot, starting at the calling thread's own one.
+  Slot& post(int64_t request) {
+    int index = homeSlot();
+    while (true) {
+      int64_t expected = kFree;
+      Slot& slot = slots_[static_cast<std::size_t>(index)];
+      if (slot.state.load(std::memory_order_relaxed) == kFree
+          && slot.state.compare_exchange_strong(expected, request, std::memory_order_acq_rel)) {
+        int inUse = slotsInUse_.load(std::memory_order_relaxed);
+        while (inUse <= index
+               && !slotsInUse_.compare_exchange_weak(inUse, index + 1, std::memory_order_release)) {
+          // inUse reloaded by the failed exchange
+        }
+        return slot;
+      }
+      index = (index + 1) % kSlots;
+      if (index == homeSlot()) {
+        util::ThreadHints::onSpinWait();
+      }
+    }
+  }
+
+  // One pass: serves the combiner's own request (if not kFree) and the
+  // pending posted ones that fit, with a single cursor update. Returns the
+  // own request's result, or kPending if it has to wait. A poster whose
+  // request arrives after the scan combines it itself.
+  int64_t combine(int64_t ownRequest) {
+    // Only [0, count) is read; zeroing 512 bytes per claim shows up.
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+    std::array<Slot*, kSlots> served;
+    int count = 0;
+    const int64_t current = this->cursor_.get();
+    int64_t next = current;
+    bool blocked = false;
+    // Behind a blocked request nothing is served; tryNext() fails.
+    const auto serve = [&](int64_t request) {
+      const int n = static_cast<int>(request & ~kTryFlag);
+      if (blocked || !fits(next + n, current)) {
+        blocked = blocked || (request & kTryFlag) == 0;
+        return (request & kTryFlag) != 0 ? kFailed : kPending;
+      }
+      next += n;
+      return next;
+    };
+
+    const int64_t own = ownRequest == kFree ? kPending : serve(ownRequest);
+    const int inUse = slotsInUse_.load(std::memory_order_acquire);
+    for (int i = 0; i < inUse; ++i) {
+      Slot& slot = slots_[static_cast<std::size_t>(i)];
+      const int64_t request = slot.state.load(std::memory_order_acquire);
+      if (request <= kFree) {
+        continue;
+      }
+      const int64_t claimed = serve(request);
+      if (claimed == kFailed) {
+        slot.claimed = kFailed;
+        slot.state.store(kServed, std::memory_order_release);
+      } else if (claimed != kPending) {
+        slot.claimed = claimed;
+        served[static_cast<std::size_t>(count++)] = &slot;
+      }
+    }
+    if (next != current) {
+      this->cursor_.set(next);
+    }
+    for (int i = 0; i < count; ++i) {
+      served[static_cast<std::size_t>(i)]->state.store(kServed, std::memory_order_release);
+    }
+    return own;
+  }
+
+  bool fits(int64_t nextSequence, int64_t cursorValue) {
+    const int64_t wrapPoint = nextSequence - this->bufferSize_.size();
+    int64_t& cached = combiner_.gatingSequenceCache;
+    if (wrapPoint > cached || cached > cursorValue) {
+      cached = minimumSequence(cursorValue);
+    }
+    return wrapPoint <= cached;
+  }
+
+  int64_t minimumSequence(int64_t defaultMin) {
+    return this->gatingSequences_.minimumSequence(defaultMin);
+  }
+
+  static int homeSlot() {
+    static std::atomic<int> nextThread{0};
+    thread_local const int slot = nextThread.fetch_add(1, std::memory_order_relaxed) % kSlots;
+    return slot;
+  }
+};
+
+}  // namespace disruptor
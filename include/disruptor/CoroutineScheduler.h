@@ -0,0 +1,201 @@
+#pragma once
+// C++-only: a single-threaded scheduler for coroutine consumers and producers
+// (no Java equivalent).
+//
+// ScheduledTask is a lazily started coroutine. spawn() hands it to a
+// CoroutineScheduler, and run() resumes ready coroutines on the calling thread
+// until every spawned task has finished. When nothing is ready, run() blocks
+// on a condition variable instead of spinning. A coroutine suspended in
+// co_await barrier.waitForAsync() or co_await ringBuffer.nextAsync() is parked
+// on its AsyncWaitStrategy, and the next signal posts it back here.
+
+#include "AsyncWaiter.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace disruptor {
+
+class CoroutineScheduler;
+
+// A suspended coroutine that must only be resumed once the condition it
+// awaits holds. resumable() runs on the scheduler thread: it returns true to
+// resume the coroutine, or parks the waiter again and returns false.
+class CoroutineWaiter : public AsyncWaiter {
+public:
+  virtual bool resumable() = 0;
+
+  void wake() override;
+
+  std::coroutine_handle<> handle;
+  CoroutineScheduler* scheduler{nullptr};
+
+protected:
+  ~CoroutineWaiter() = default;
+};
+
+class ScheduledTask final {
+public:
+  struct promise_type {
+    // Set by spawn(); awaiters resume the coroutine through it.
+    CoroutineScheduler* scheduler{nullptr};
+
+    ScheduledTask get_return_object() noexcept {
+      return ScheduledTask(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+
+    std::suspend_always initial_suspend() noexcept {
+      return {};
+    }
+
+    std::suspend_never final_suspend() noexcept;
+
+    void return_void() noexcept {}
+
+    // As for an exception escaping a std::thread.
+    void unhandled_exception() noexcept {
+      std::terminate();
+    }
+  };
+
+  using Handle = std::coroutine_handle<promise_type>;
+
+  ScheduledTask(ScheduledTask&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+
+  ScheduledTask(const ScheduledTask&) = delete;
+  ScheduledTask& operator=(const ScheduledTask&) = delete;
+  ScheduledTask& operator=(ScheduledTask&&) = delete;
+
+  // A task that was never spawned is destroyed unstarted.
+  ~ScheduledTask() {
+    if (handle_) {
+      handle_.destroy();
+    }
+  }
+
+private:
+  friend class CoroutineScheduler;
+
+  explicit ScheduledTask(Handle handle) : handle_(handle) {}
+
+  Handle handle_;
+};
+
+class CoroutineScheduler final {
+public:
+  CoroutineScheduler() = default;
+
+  CoroutineScheduler(const CoroutineScheduler&) = delete;
+  CoroutineScheduler& operator=(const CoroutineScheduler&) = delete;
+
+  // Queues task to start on the next run(); may be called from any thread.
+  void spawn(ScheduledTask task) {
+    ScheduledTask::Handle handle = std::exchange(task.handle_, {});
+    handle.promise().scheduler = this;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ++liveTasks_;
+    }
+    post(handle, nullptr);
+  }
+
+  // Makes handle ready; waiter, if any, is asked whether to resume it first.
+  // May be called from any thread.
+  void post(std::coroutine_handle<> handle, CoroutineWaiter* waiter) {
+    bool wake;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ready_.push_back(Entry{handle, waiter});
+      readyCount_.store(ready_.size(), std::memory_order_relaxed);
+      wake = idle_;
+    }
+    if (wake) {
+      cv_.notify_one();
+    }
+  }
+
+  // Resumes ready coroutines on this thread until all spawned tasks finish.
+  void run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (liveTasks_ > 0) {
+      if (ready_.empty()) {
+        idle_ = true;
+        cv_.wait(lock);
+        idle_ = false;
+        continue;
+      }
+      draining_.swap(ready_);
+      readyCount_.store(0, std::memory_order_relaxed);
+      lock.unlock();
+      for (const Entry& entry : draining_) {
+        if (entry.waiter == nullptr || entry.waiter->resumable()) {
+          entry.handle.resume();
+        }
+      }
+      draining_.clear();
+      lock.lock();
+    }
+  }
+
+  // Whether other coroutines are waiting to run; a hint for yieldIfBusy().
+  bool hasReady() const {
+    return readyCount_.load(std::memory_order_relaxed) != 0;
+  }
+
+  // co_await scheduler.yieldIfBusy() lets other ready coroutines run first,
+  // so a consumer that never waits does not starve its neighbours.
+  auto yieldIfBusy() {
+    struct Awaiter {
+      CoroutineScheduler* scheduler;
+
+      bool await_ready() const noexcept {
+        return !scheduler->hasReady();
+      }
+
+      void await_suspend(std::coroutine_handle<> handle) {
+        scheduler->post(handle, nullptr);
+      }
+
+      void await_resume() const noexcept {}
+    };
+    return Awaiter{this};
+  }
+
+private:
+  friend struct ScheduledTask::promise_type;
+
+  struct Entry {
+    std::coroutine_handle<> handle;
+    CoroutineWaiter* waiter;
+  };
+
+  void taskFinished() noexcept {
+    std::lock_guard<std::mutex> lock(mutex_);
+    --liveTasks_;
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<Entry> ready_;
+  std::vector<Entry> draining_;
+  std::atomic<std::size_t> readyCount_{0};
+  std::size_t liveTasks_{0};
+  bool idle_{false};
+};
+
+inline void CoroutineWaiter::wake() {
+  scheduler->post(handle, this);
+}
+
+inline std::suspend_never ScheduledTask::promise_type::final_suspend() noexcept {
+  scheduler->taskFinished();
+  return {};
+}
+
+}  // namespace disruptor
@@ -2,6 +2,8 @@
 // 1:1 port skeleton of com.lmax.disruptor.DataProvider
 
 #include <cstdint>
+#include <span>
+#include <utility>
 
 namespace disruptor {
 template <typename T>
@@ -9,5 +11,12 @@ class DataProvider {
 public:
   virtual ~DataProvider() = default;
   virtual T& get(int64_t sequence) = 0;
+
+  // C++-only: the events of lo..hi as one or two contiguous runs (the second
+  // empty unless the range wraps), or two empty spans if this provider does
+  // not store its events in one array. See BatchSpanEventHandler.
+  virtual std::pair<std::span<T>, std::span<T>> getSpans(int64_t /*lo*/, int64_t /*hi*/) {
+    return {};
+  }
 };
 }  // namespace disruptor
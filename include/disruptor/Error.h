@@ -11,6 +11,10 @@ enum class ErrorCode {
   InsufficientCapacity,
   InvalidArgument,
   RuntimeError,
+  // C++-only: tryWaitFor results, in place of AlertException and
+  // TimeoutException.
+  Alerted,
+  Timeout,
 };
 
 struct Error {
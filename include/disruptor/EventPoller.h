@@ -5,13 +5,21 @@
 #include "DataProvider.h"
 #include "FixedSequenceGroup.h"
 #include "Sequence.h"
+#include "util/ExceptionSupport.h"
 
+#include <array>
 #include <cstdint>
 #include <memory>
+#include <utility>
 
 namespace disruptor {
 
-template <typename T, typename SequencerT>
+// Java picks the cursor, the single gating sequence or a FixedSequenceGroup at
+// runtime and calls Sequence.get() virtually. C++: the gating type is a
+// template parameter (FixedSequenceGroup for a runtime count,
+// SequenceGroupView<N> for a compile-time count); with no gating sequences
+// the group wraps the cursor.
+template <typename T, typename SequencerT, typename GatingSequenceT = FixedSequenceGroup>
 class EventPoller {
 public:
   class Handler {
@@ -25,34 +33,52 @@ public:
   EventPoller(DataProvider<T>& dataProvider,
               SequencerT& sequencer,
               std::shared_ptr<Sequence> sequence,
-              Sequence& gatingSequence)
+              GatingSequenceT gatingSequence)
     : dataProvider_(&dataProvider)
     , sequencer_(&sequencer)
     , ownedSequence_(std::move(sequence))
     , sequence_(ownedSequence_.get())
-    , gatingSequence_(&gatingSequence)
-    , fixedGroup_(nullptr) {}
+    , gatingSequence_(std::move(gatingSequence)) {}
 
   PollState poll(Handler& eventHandler) {
     const int64_t currentSequence = sequence_->get();
     int64_t nextSequence = currentSequence + 1;
     const int64_t availableSequence =
-      sequencer_->getHighestPublishedSequence(nextSequence, gatingSequence_->get());
+      sequencer_->getHighestPublishedSequence(nextSequence, gatingSequence_.get());
 
     if (nextSequence <= availableSequence) {
       bool processNextEvent;
       int64_t processedSequence = currentSequence;
-      try {
+      // Skipped sequences (MultiProducerSequencer claim chunks) are consumed
+      // without calling the handler.
+      [[maybe_unused]] bool skipping = false;
+      int64_t lastEvent = availableSequence;
+      if constexpr (kMaySkip) {
+        skipping = sequencer_->hasSkippedSequences();
+        if (skipping) [[unlikely]] {
+          lastEvent = sequencer_->lastUnskippedSequence(nextSequence, availableSequence);
+        }
+      }
+      DISRUPTOR_TRY {
         do {
+          if constexpr (kMaySkip) {
+            if (skipping && sequencer_->isSkipped(nextSequence)) [[unlikely]] {
+              processNextEvent = true;
+              processedSequence = nextSequence;
+              ++nextSequence;
+              continue;
+            }
+          }
           T& event = dataProvider_->get(nextSequence);
           processNextEvent =
-            eventHandler.onEvent(event, nextSequence, nextSequence == availableSequence);
+            eventHandler.onEvent(event, nextSequence, nextSequence == lastEvent);
           processedSequence = nextSequence;
           ++nextSequence;
         } while (nextSequence <= availableSequence && processNextEvent);
-      } catch (...) {
+      }
+      DISRUPTOR_CATCH_ALL {
         sequence_->set(processedSequence);
-        throw;
+        DISRUPTOR_RETHROW;
       }
       sequence_->set(processedSequence);
       return PollState::PROCESSING;
@@ -63,27 +89,21 @@ public:
     }
   }
 
-  static std::shared_ptr<EventPoller<T, SequencerT>> newInstance(DataProvider<T>& dataProvider,
-                                                                 SequencerT& sequencer,
-                                                                 std::shared_ptr<Sequence> sequence,
-                                                                 Sequence& cursorSequence,
-                                                                 Sequence* const* gatingSequences,
-                                                                 int gatingCount) {
+  static std::shared_ptr<EventPoller<T, SequencerT, GatingSequenceT>>
+  newInstance(DataProvider<T>& dataProvider,
+              SequencerT& sequencer,
+              std::shared_ptr<Sequence> sequence,
+              Sequence& cursorSequence,
+              Sequence* const* gatingSequences,
+              int gatingCount) {
     if (gatingCount == 0) {
-      return std::make_shared<EventPoller<T, SequencerT>>(dataProvider, sequencer,
-                                                          std::move(sequence), cursorSequence);
-    }
-    if (gatingCount == 1) {
-      return std::make_shared<EventPoller<T, SequencerT>>(
-        dataProvider, sequencer, std::move(sequence),
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        *gatingSequences[0]);
+      const std::array<Sequence*, 1> cursorOnly = {&cursorSequence};
+      return std::make_shared<EventPoller<T, SequencerT, GatingSequenceT>>(
+        dataProvider, sequencer, std::move(sequence), GatingSequenceT(cursorOnly.data(), 1));
     }
-    auto poller = std::make_shared<EventPoller<T, SequencerT>>(dataProvider, sequencer,
-                                                               std::move(sequence), cursorSequence);
-    poller->fixedGroup_ = std::make_unique<FixedSequenceGroup>(gatingSequences, gatingCount);
-    poller->gatingSequence_ = poller->fixedGroup_.get();
-    return poller;
+    return std::make_shared<EventPoller<T, SequencerT, GatingSequenceT>>(
+      dataProvider, sequencer, std::move(sequence),
+      GatingSequenceT(gatingSequences, gatingCount));
   }
 
   Sequence& getSequence() {
@@ -91,12 +111,14 @@ public:
   }
 
 private:
+  static constexpr bool kMaySkip =
+    requires(SequencerT& sequencer, int64_t sequence) { sequencer.isSkipped(sequence); };
+
   DataProvider<T>* dataProvider_;
   SequencerT* sequencer_;
   std::shared_ptr<Sequence> ownedSequence_;
   Sequence* sequence_;
-  Sequence* gatingSequence_;
-  std::unique_ptr<FixedSequenceGroup> fixedGroup_;
+  GatingSequenceT gatingSequence_;
 };
 
 }  // namespace disruptor
@@ -0,0 +1,19 @@
+#pragma once
+// C++-only: an EventProcessor whose exception handler can be replaced after
+// it is built (no Java equivalent; Java's ExceptionHandlerSetting casts to
+// BatchEventProcessor). The DSL reaches any processor for events of type T
+// through this one base, whatever handler or data provider types it was
+// instantiated with.
+
+#include "EventProcessor.h"
+#include "ExceptionHandler.h"
+
+namespace disruptor {
+
+template <typename T>
+class ExceptionHandlingEventProcessor : public EventProcessor {
+public:
+  virtual void setExceptionHandler(ExceptionHandler<T>& exceptionHandler) = 0;
+};
+
+}  // namespace disruptor
@@ -3,6 +3,7 @@
 // Source: reference/disruptor/src/main/java/com/lmax/disruptor/FatalExceptionHandler.java
 
 #include "ExceptionHandler.h"
+#include "util/ExceptionSupport.h"
 
 #include <cstdint>
 #include <exception>
@@ -18,7 +19,7 @@ public:
   void handleEventException(const std::exception& ex, int64_t sequence, T* event) override {
     // Java: log ERROR and throw new RuntimeException(ex)
     std::cerr << "Exception processing: " << sequence << " " << event << " : " << ex.what() << "\n";
-    throw std::runtime_error(ex.what());
+    util::raise(std::runtime_error(ex.what()));
   }
 
   void handleOnStartException(const std::exception& ex) override {
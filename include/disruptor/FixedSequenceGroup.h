@@ -3,52 +3,68 @@
 // Source: reference/disruptor/src/main/java/com/lmax/disruptor/FixedSequenceGroup.java
 
 #include "Sequence.h"
+#include "SequenceArray.h"
 #include "util/Util.h"
 
+#include <cstddef>
 #include <cstdint>
-#include <stdexcept>
+#include <limits>
 #include <string>
 #include <vector>
 
 namespace disruptor {
 
-class FixedSequenceGroup final : public Sequence {
+// Java: FixedSequenceGroup extends Sequence and overrides get(); set()/CAS/add
+// throw UnsupportedOperationException.
+// C++: Sequence is final, so this is a standalone read-only group whose count
+// is only known at runtime (e.g. DSL-built barriers). When the count is known
+// at compile time, prefer SequenceGroupView<N>. A group of adjacent
+// Sequences (a SequenceArray, as the DSL allocates for a handler group) is
+// scanned with SequenceArray::minimumOf.
+class FixedSequenceGroup final {
 public:
-  // Java copies the array; we store pointers and treat them as identity.
+  // Java copies the array; we store pointers and treat them as identity. A
+  // follower (Sequence::follow) is stored as the Sequence it follows.
   FixedSequenceGroup(Sequence* const* sequences, int count) {
     sequences_.reserve(static_cast<size_t>(count));
     for (int i = 0; i < count; ++i) {
       // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-      sequences_.push_back(sequences[i]);
+      Sequence* sequence = sequences[i];
+      sequences_.push_back(sequence != nullptr ? sequence->gatingTarget() : nullptr);
+    }
+    // Compared as addresses: pointer arithmetic across separate Sequence
+    // objects would be undefined unless they already are one array.
+    contiguous_ = sequences_.size() > 1 && sequences_.front() != nullptr;
+    const auto first = contiguous_ ? reinterpret_cast<std::uintptr_t>(sequences_.front()) : 0;
+    for (std::size_t i = 1; contiguous_ && i < sequences_.size(); ++i) {
+      contiguous_ = reinterpret_cast<std::uintptr_t>(sequences_[i]) == first + i * sizeof(Sequence);
     }
   }
 
-  int64_t get() const noexcept override {
+  int64_t get() const noexcept {
+    // A single dependency is the common case (one upstream stage, or the
+    // cursor itself); skip the min loop for it.
+    if (sequences_.size() == 1) {
+      return sequences_.front()->get();
+    }
+    if (contiguous_) {
+      return SequenceArray::minimumOf(sequences_.front(), static_cast<int>(sequences_.size()),
+                                      (std::numeric_limits<int64_t>::max)());
+    }
     return disruptor::util::Util::getMinimumSequence(sequences_);
   }
 
-  std::string toString() const {
-    return "FixedSequenceGroup{...}";
-  }
-
-  void set(int64_t /*value*/) override {
-    throw std::runtime_error("UnsupportedOperationException");
+  int size() const {
+    return static_cast<int>(sequences_.size());
   }
 
-  bool compareAndSet(int64_t /*expectedValue*/, int64_t /*newValue*/) override {
-    throw std::runtime_error("UnsupportedOperationException");
-  }
-
-  int64_t incrementAndGet() override {
-    throw std::runtime_error("UnsupportedOperationException");
-  }
-
-  int64_t addAndGet(int64_t /*increment*/) override {
-    throw std::runtime_error("UnsupportedOperationException");
+  std::string toString() const {
+    return "FixedSequenceGroup{...}";
   }
 
 private:
   std::vector<Sequence*> sequences_;
+  bool contiguous_;
 };
 
 }  // namespace disruptor
@@ -0,0 +1,119 @@
+#pragma once
+// C++-only: a blocking wait strategy that parks consumers on a futex (no Java
+// equivalent).
+//
+// A consumer that finds the cursor behind its sequence sleeps on word_, a
+// 32-bit futex word. Bit 0 of the word says a consumer sleeps on its current
+// value; the rest counts wakes. signalAllWhenBlocking() only changes the word
+// and wakes when the bit is set, so a publish nobody waits for costs a fence
+// and one relaxed load: no mutex, no notify_all and no syscall. Clearing the
+// bit in the same step as the wake means a burst of publishes wakes a sleeping
+// consumer once. Off Linux the word is waited on through std::atomic::wait
+// instead of the futex syscall.
+
+#include "Sequence.h"
+#include "WaitStrategy.h"
+#include "util/ThreadHints.h"
+
+#include <atomic>
+#include <climits>
+#include <cstdint>
+
+#if defined(__linux__)
+#  include <linux/futex.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+namespace disruptor {
+
+class FutexWaitStrategy final {
+public:
+  static constexpr bool kIsBlockingStrategy = true;
+
+  template <typename DependentSequenceT, typename Barrier>
+  int64_t waitFor(int64_t sequence,
+                  const Sequence& cursorSequence,
+                  const DependentSequenceT& dependentSequence,
+                  Barrier& barrier) {
+    return waitResultOrThrow(tryWaitFor(sequence, cursorSequence, dependentSequence, barrier));
+  }
+
+  template <typename DependentSequenceT, typename Barrier>
+  WaitResult tryWaitFor(int64_t sequence,
+                        const Sequence& cursorSequence,
+                        const DependentSequenceT& dependentSequence,
+                        Barrier& barrier) {
+    int64_t availableSequence;
+    while (cursorSequence.get() < sequence) {
+      if (barrier.isAlerted()) {
+        return std::unexpected(ErrorCode::Alerted);
+      }
+
+      // Pairs with the fence in signalAllWhenBlocking(): either the signal
+      // sees the bit, or the checks below see the new cursor or alert.
+      const uint32_t word = word_.fetch_or(kSleeping, std::memory_order_relaxed) | kSleeping;
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (cursorSequence.get() < sequence && !barrier.isAlerted()) {
+        sleep(word);
+      }
+    }
+
+    while ((availableSequence = dependentSequence.get()) < sequence) {
+      if (barrier.isAlerted()) {
+        return std::unexpected(ErrorCode::Alerted);
+      }
+      disruptor::util::ThreadHints::onSpinWait();
+    }
+
+    return availableSequence;
+  }
+
+  void signalAllWhenBlocking() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    uint32_t word = word_.load(std::memory_order_relaxed);
+    while ((word & kSleeping) != 0) {
+      // Adding 1 clears the bit and moves the word on, so a consumer about to
+      // sleep on the old value returns at once.
+      if (word_.compare_exchange_weak(word, word + 1, std::memory_order_release,
+                                      std::memory_order_relaxed)) {
+        wakeAll();
+        return;
+      }
+    }
+  }
+
+private:
+  static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t)
+                  && std::atomic<uint32_t>::is_always_lock_free,
+                "futex word must be a plain 32-bit integer");
+
+  static constexpr uint32_t kSleeping = 1;
+
+  // Returns once word_ no longer holds word, or spuriously.
+  void sleep(uint32_t word) {
+#if defined(__linux__)
+    ::syscall(SYS_futex, futexWord(), FUTEX_WAIT_PRIVATE, word, nullptr, nullptr, 0);
+#else
+    word_.wait(word, std::memory_order_acquire);
+#endif
+  }
+
+  void wakeAll() {
+#if defined(__linux__)
+    ::syscall(SYS_futex, futexWord(), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#else
+    word_.notify_all();
+#endif
+  }
+
+#if defined(__linux__)
+  uint32_t* futexWord() {
+    return reinterpret_cast<uint32_t*>(&word_);
+  }
+#endif
+
+  alignas(128) std::atomic<uint32_t> word_{0};
+};
+
+}  // namespace disruptor
@@ -0,0 +1,256 @@
+#pragma once
+// C++-only: storage for a sequencer's gating sequences (Java keeps a volatile
+// Sequence[] swapped by AtomicReferenceFieldUpdater and relies on the GC; no
+// direct equivalent).
+
+#include "Sequence.h"
+#include "SequenceArray.h"
+#include "util/ExceptionSupport.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace disruptor {
+
+// Fixed-capacity, cache-aligned array of entries with a version counter.
+// Producers read it on every wrap check, so reads take no lock and touch no
+// reference count: minimumSequence() loads the high-water mark and the
+// entries, nothing else. Writers (add/remove, i.e. consumer setup and
+// teardown) serialise on a mutex and bump the version around each change,
+// seqlock style, so snapshot() can return a consistent copy.
+//
+// An entry is one word: a single Sequence, or a run of up to kMaxRun
+// adjacent Sequences (a SequenceArray group added in one call), packed as the
+// first Sequence's address with the run length in its low bits. Runs are
+// scanned with SequenceArray::minimumOf instead of one pointer per consumer.
+//
+// Entries are never moved: remove() shrinks or splits an entry in place (the
+// split-off tail goes to a free entry first) and add() fills the lowest free
+// ones, so a concurrent reader sees each sequence either present or absent
+// (briefly twice during a split), never skipped because another one moved.
+// As with the Java array, the caller keeps a removed Sequence alive until
+// readers may have finished with it (in practice: until the consumer's
+// thread is joined).
+class GatingSequenceRegistry final {
+public:
+  static constexpr int kCapacity = 64;
+  static constexpr int kMaxRun = static_cast<int>(alignof(Sequence));
+
+  GatingSequenceRegistry() noexcept {
+    for (auto& entry : entries_) {
+      entry.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  GatingSequenceRegistry(const GatingSequenceRegistry&) = delete;
+  GatingSequenceRegistry& operator=(const GatingSequenceRegistry&) = delete;
+
+  // All or nothing: throws std::length_error if the free entries cannot take
+  // every non-null sequence (runs of adjacent sequences take one entry).
+  void add(Sequence* const* sequences, int count) {
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    std::vector<Run> runs;
+    for (int i = 0; i < count; ++i) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      Sequence* sequence = sequences[i];
+      if (sequence == nullptr) {
+        continue;
+      }
+      if (!runs.empty() && runs.back().extendsTo(sequence)) {
+        ++runs.back().count;
+      } else {
+        runs.push_back(Run{sequence, 1});
+      }
+    }
+    if (static_cast<int>(runs.size()) > freeEntries()) {
+      util::raise(
+        std::length_error("too many gating sequences for GatingSequenceRegistry::kCapacity"));
+    }
+
+    beginWrite();
+    int highWater = highWater_.load(std::memory_order_relaxed);
+    int entry = 0;
+    for (const Run& run : runs) {
+      entry = nextFreeEntry(entry);
+      entryAt(entry).store(run.pack(), std::memory_order_release);
+      highWater = (std::max)(highWater, entry + 1);
+    }
+    highWater_.store(highWater, std::memory_order_release);
+    endWrite();
+  }
+
+  // Removes every occurrence; returns false if the sequence was not present.
+  // Removing from the middle of a run splits it and needs a free entry:
+  // throws std::length_error (nothing removed from that run) if none is left.
+  bool remove(const Sequence& sequence) {
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    bool removed = false;
+    beginWrite();
+    int highWater = highWater_.load(std::memory_order_relaxed);
+    DISRUPTOR_TRY {
+      for (int i = 0; i < highWater; ++i) {
+        const Run run = Run::unpack(entryAt(i).load(std::memory_order_relaxed));
+        if (!run.contains(&sequence)) {
+          continue;
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const Run head{run.first, static_cast<int>(&sequence - run.first)};
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const Run tail{const_cast<Sequence*>(&sequence) + 1, run.count - head.count - 1};
+        if (head.count > 0 && tail.count > 0) {
+          if (freeEntries() == 0) {
+            util::raise(std::length_error("no free GatingSequenceRegistry entry to split a run"));
+          }
+          const int spare = nextFreeEntry(0);
+          entryAt(spare).store(tail.pack(), std::memory_order_release);
+          highWater = (std::max)(highWater, spare + 1);
+          highWater_.store(highWater, std::memory_order_release);
+          entryAt(i).store(head.pack(), std::memory_order_release);
+        } else {
+          entryAt(i).store(head.count > 0 ? head.pack() : tail.pack(), std::memory_order_release);
+        }
+        removed = true;
+      }
+    }
+    DISRUPTOR_CATCH_ALL {
+      endWrite();
+      DISRUPTOR_RETHROW;
+    }
+    while (highWater > 0 && entryAt(highWater - 1).load(std::memory_order_relaxed) == 0) {
+      --highWater;
+    }
+    highWater_.store(highWater, std::memory_order_release);
+    endWrite();
+    return removed;
+  }
+
+  // Hot path: minimum of the registered sequences and defaultMin.
+  int64_t minimumSequence(int64_t defaultMin) const noexcept {
+    int64_t minimum = defaultMin;
+    const int highWater = highWater_.load(std::memory_order_acquire);
+    for (int i = 0; i < highWater; ++i) {
+      const Run run = Run::unpack(entryAt(i).load(std::memory_order_acquire));
+      if (run.count == 1) {
+        minimum = (std::min)(minimum, run.first->get());
+      } else if (run.count > 1) {
+        minimum = SequenceArray::minimumOf(run.first, run.count, minimum);
+      }
+    }
+    return minimum;
+  }
+
+  // Incremented twice per add/remove; odd while a change is in progress.
+  uint64_t version() const noexcept {
+    return version_.load(std::memory_order_acquire);
+  }
+
+  std::vector<Sequence*> snapshot() const {
+    std::vector<Sequence*> sequences;
+    while (true) {
+      const uint64_t before = version();
+      if ((before & 1U) == 0) {
+        sequences.clear();
+        const int highWater = highWater_.load(std::memory_order_acquire);
+        for (int i = 0; i < highWater; ++i) {
+          const Run run = Run::unpack(entryAt(i).load(std::memory_order_acquire));
+          for (int j = 0; j < run.count; ++j) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            sequences.push_back(run.first + j);
+          }
+        }
+        if (version() == before) {
+          return sequences;
+        }
+      }
+      std::this_thread::yield();
+    }
+  }
+
+  int size() const {
+    return static_cast<int>(snapshot().size());
+  }
+
+private:
+  // count == 0 is an empty entry. Sequences are alignof(Sequence)-aligned,
+  // which leaves log2(kMaxRun) low address bits for count - 1.
+  struct Run {
+    Sequence* first;
+    int count;
+
+    bool extendsTo(const Sequence* next) const {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      return count < kMaxRun && first + count == next;
+    }
+
+    bool contains(const Sequence* sequence) const {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      return count > 0 && first <= sequence && sequence < first + count;
+    }
+
+    std::uintptr_t pack() const {
+      if (count == 0) {
+        return 0;
+      }
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      return reinterpret_cast<std::uintptr_t>(first) | static_cast<std::uintptr_t>(count - 1);
+    }
+
+    static Run unpack(std::uintptr_t word) {
+      if (word == 0) {
+        return Run{nullptr, 0};
+      }
+      constexpr auto kCountMask = static_cast<std::uintptr_t>(kMaxRun - 1);
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast,performance-no-int-to-ptr)
+      return Run{reinterpret_cast<Sequence*>(word & ~kCountMask),
+                 static_cast<int>(word & kCountMask) + 1};
+    }
+  };
+  static_assert((kMaxRun & (kMaxRun - 1)) == 0);
+
+  // Read by producers: keep them off the version/mutex line.
+  alignas(128) std::atomic<int> highWater_{0};
+  std::array<std::atomic<std::uintptr_t>, kCapacity> entries_;
+  alignas(128) std::atomic<uint64_t> version_{0};
+  std::mutex writeMutex_;
+
+  std::atomic<std::uintptr_t>& entryAt(int i) noexcept {
+    return entries_[static_cast<std::size_t>(i)];
+  }
+
+  const std::atomic<std::uintptr_t>& entryAt(int i) const noexcept {
+    return entries_[static_cast<std::size_t>(i)];
+  }
+
+  int freeEntries() const {
+    int free = 0;
+    for (const auto& entry : entries_) {
+      free += entry.load(std::memory_order_relaxed) == 0 ? 1 : 0;
+    }
+    return free;
+  }
+
+  // Caller checked freeEntries().
+  int nextFreeEntry(int from) const {
+    while (entryAt(from).load(std::memory_order_relaxed) != 0) {
+      ++from;
+    }
+    return from;
+  }
+
+  void beginWrite() noexcept {
+    version_.fetch_add(1, std::memory_order_acq_rel);
+  }
+
+  void endWrite() noexcept {
+    version_.fetch_add(1, std::memory_order_release);
+  }
+};
+
+}  // namespace disruptor
@@ -0,0 +1,143 @@
+#pragma once
+// C++-only: hierarchical gating for a wide consumer fan-out (no Java
+// equivalent).
+
+#include "Sequence.h"
+#include "SequenceArray.h"
+#include "util/ExceptionSupport.h"
+#include "util/MappedAllocator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace disruptor {
+
+// Consumer Sequences aggregated through a tree of "group minimum" Sequences:
+// each node covers fanIn nodes of the level below, the root covers every
+// member. The producer gates on root() alone instead of scanning every
+// member on each wrap check.
+//
+// Nodes are maintained by the consumers, lazily: a member that advances only
+// recomputes its parent if it may have been the slowest child (its previous
+// value was not above the parent), and a parent that moves propagates the
+// same way. Every node is a lower bound of the members below it, so gating
+// on the root is safe. Each store is followed by a full fence before the
+// parent is read, so of two children racing off the minimum at least one
+// sees the other's new value and no node is left behind.
+//
+// Members are one contiguous SequenceArray, so a downstream barrier on all
+// of them still gets the gathered scan. Members must only be advanced
+// through publish().
+class GatingTree final {
+public:
+  GatingTree(int members, int fanIn, const util::MemoryPolicy& memoryPolicy = {})
+    : fanIn_(fanIn) {
+    if (fanIn < 2) {
+      util::raise(std::invalid_argument("GatingTree fanIn must be at least 2"));
+    }
+    levels_.push_back(std::make_unique<SequenceArray>(members, memoryPolicy));
+    while (levels_.back()->capacity() > 1) {
+      const int nodes = (levels_.back()->capacity() + fanIn - 1) / fanIn;
+      levels_.push_back(std::make_unique<SequenceArray>(nodes, memoryPolicy));
+    }
+  }
+
+  int size() const {
+    return levels_.front()->capacity();
+  }
+
+  int fanIn() const {
+    return fanIn_;
+  }
+
+  // Levels including the members; 1 for a single member.
+  int depth() const {
+    return static_cast<int>(levels_.size());
+  }
+
+  Sequence& member(int index) {
+    return (*levels_.front())[index];
+  }
+
+  bool contains(const Sequence& sequence) const {
+    return levels_.front()->contains(sequence);
+  }
+
+  // What the producer gates on.
+  Sequence& root() {
+    return (*levels_.back())[0];
+  }
+
+  // Consumer side: member's Sequence::set(value), plus upkeep of the nodes
+  // above it. Only the member's own consumer may call this.
+  void publish(int memberIndex, int64_t value) {
+    Sequence& sequence = member(memberIndex);
+    const int64_t previous = sequence.get();
+    sequence.setVolatile(value);
+    propagate(memberIndex, previous);
+  }
+
+  // Setup only: sets every member and node.
+  void reset(int64_t value) {
+    for (auto& level : levels_) {
+      for (int i = 0; i < level->capacity(); ++i) {
+        (*level)[i].set(value);
+      }
+    }
+  }
+
+private:
+  int fanIn_;
+  std::vector<std::unique_ptr<SequenceArray>> levels_;
+
+  void propagate(int index, int64_t previous) {
+    for (std::size_t level = 1; level < levels_.size(); ++level) {
+      const int parent = index / fanIn_;
+      if (previous > (*levels_[level])[parent].get()) {
+        return;  // a slower sibling will move the parent
+      }
+      if (!advance(level, parent, previous)) {
+        return;
+      }
+      index = parent;
+    }
+  }
+
+  // Raises the node to the minimum of its children. Returns false if it
+  // did not move, else true with replaced = the value it moved from.
+  bool advance(std::size_t level, int index, int64_t& replaced) {
+    Sequence& node = (*levels_[level])[index];
+    const SequenceArray& children = *levels_[level - 1];
+    const int first = index * fanIn_;
+    const int count = (std::min)(fanIn_, children.capacity() - first);
+    int64_t current = node.get();
+    bool advanced = false;
+    while (true) {
+      const int64_t minimum = SequenceArray::minimumOf(
+        &children[first], count, (std::numeric_limits<int64_t>::max)());
+      if (minimum <= current) {
+        return advanced;
+      }
+      if (node.compareAndSet(current, minimum)) {
+        if (!advanced) {
+          replaced = current;
+          advanced = true;
+        }
+        // Store-load: re-read the children (and later the parent) only
+        // after the new value is visible.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        current = minimum;
+      } else {
+        current = node.get();
+      }
+    }
+  }
+};
+
+}  // namespace disruptor
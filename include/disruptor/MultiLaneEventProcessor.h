@@ -0,0 +1,196 @@
+#pragma once
+// C++-only: BatchEventProcessor counterpart for MultiLaneRingBuffer (no Java
+// equivalent).
+
+#include "EventHandlerBase.h"
+#include "ExceptionHandler.h"
+#include "MultiLaneRingBuffer.h"
+#include "ProcessorLifecycle.h"
+#include "Sequence.h"
+#include "SequenceArray.h"
+#include "util/ExceptionSupport.h"
+#include "util/ThreadHints.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace disruptor {
+
+// Merges the lanes of a MultiLaneRingBuffer into one handler. Each pass visits
+// every lane in turn and drains up to maxBatchSize of what that lane has
+// available as one batch (onBatchStart, endOfBatch on its last event), then
+// records the lane's progress in its element of getSequences(). The sequence
+// passed to onEvent is the lane's sequence; currentLane() names the lane.
+//
+// A processor that finds every lane empty spins for kIdleSpins passes. Then,
+// with a blocking wait strategy, it parks on the strategy the lanes share
+// until any lane publishes past it; with a non-blocking one it yields between
+// passes. Halt is checked on every pass.
+template <typename E, typename WaitStrategyT>
+class MultiLaneEventProcessor final {
+public:
+  using RingBufferT = MultiLaneRingBuffer<E, WaitStrategyT>;
+  using BarrierT = typename RingBufferT::BarrierT;
+
+  static constexpr int kIdleSpins = 100;
+
+  MultiLaneEventProcessor(RingBufferT& ringBuffer,
+                          BarrierT& sequenceBarrier,
+                          EventHandlerBase<E>& eventHandler,
+                          int maxBatchSize = (std::numeric_limits<int>::max)())
+    : ringBuffer_(&ringBuffer)
+    , sequenceBarrier_(&sequenceBarrier)
+    , eventHandler_(&eventHandler)
+    , batchLimitOffset_(maxBatchSize - 1)
+    , sequences_(ringBuffer.laneCount()) {
+    if (maxBatchSize < 1) {
+      util::raise(std::invalid_argument("maxBatchSize must be greater than 0"));
+    }
+    if (sequenceBarrier.laneCount() != ringBuffer.laneCount()) {
+      util::raise(std::invalid_argument("barrier must have one lane per ring lane"));
+    }
+  }
+
+  // One Sequence per lane, for MultiLaneRingBuffer::addGatingSequences and as
+  // a dependency of a later stage's barrier.
+  SequenceArray& getSequences() {
+    return sequences_;
+  }
+
+  // The lane whose event is being handled; valid inside the handler.
+  int currentLane() const {
+    return lane_;
+  }
+
+  void halt() {
+    lifecycle_.halt(*sequenceBarrier_);
+  }
+
+  bool isRunning() {
+    return lifecycle_.isRunning();
+  }
+
+  void setExceptionHandler(ExceptionHandler<E>& exceptionHandler) {
+    lifecycle_.setExceptionHandler(exceptionHandler);
+  }
+
+  void run() {
+    lifecycle_.run(*eventHandler_, *sequenceBarrier_, [this] { processEvents(); });
+  }
+
+private:
+  ProcessorLifecycle<E> lifecycle_;
+  RingBufferT* ringBuffer_;
+  BarrierT* sequenceBarrier_;
+  EventHandlerBase<E>* eventHandler_;
+  int batchLimitOffset_;
+  SequenceArray sequences_;
+  int lane_{0};
+  Sequence idleCursor_;
+
+  void processEvents() {
+    const int laneCount = ringBuffer_->laneCount();
+    std::vector<int64_t> nextSequences(static_cast<std::size_t>(laneCount));
+    for (int i = 0; i < laneCount; ++i) {
+      nextSequences[static_cast<std::size_t>(i)] = sequences_[i].get() + 1;
+    }
+    E* event = nullptr;
+    int idlePasses = 0;
+
+    while (true) {
+      if (sequenceBarrier_->isAlerted()) [[unlikely]] {
+        if (lifecycle_.isHalted()) {
+          break;
+        }
+        continue;
+      }
+      bool drained = false;
+      ProcessorLifecycle<E>::invokeGuarded(
+        [&] {
+          for (lane_ = 0; lane_ < laneCount; ++lane_) {
+            drained = drainLane(nextSequences[static_cast<std::size_t>(lane_)], event) || drained;
+          }
+        },
+        [&](const std::exception& ex) {
+          int64_t& nextSequence = nextSequences[static_cast<std::size_t>(lane_)];
+          lifecycle_.handleEventException(ex, nextSequence, event, *sequenceBarrier_);
+          sequences_[lane_].set(nextSequence);
+          ++nextSequence;
+          drained = true;
+        });
+      if (drained) {
+        idlePasses = 0;
+      } else if (++idlePasses < kIdleSpins) {
+        util::ThreadHints::onSpinWait();
+      } else {
+        idle(nextSequences);
+      }
+    }
+  }
+
+  // Passed to the wait strategy as its barrier: "alerted" once the barrier is,
+  // or once any lane's cursor has passed what this processor has taken.
+  struct LanesPublished {
+    MultiLaneEventProcessor* processor;
+    const std::vector<int64_t>* nextSequences;
+
+    bool isAlerted() const {
+      if (processor->sequenceBarrier_->isAlerted()) {
+        return true;
+      }
+      for (int i = 0; i < processor->ringBuffer_->laneCount(); ++i) {
+        if (processor->ringBuffer_->lane(i).getCursor()
+            >= (*nextSequences)[static_cast<std::size_t>(i)]) {
+          return true;
+        }
+      }
+      return false;
+    }
+  };
+
+  // Every lane's publish, and alert(), signal the lanes' shared wait strategy,
+  // and blocking strategies re-check the barrier before each sleep. Parking
+  // on idleCursor_, which never reaches 0, with LanesPublished as the barrier
+  // therefore sleeps until any lane publishes. Events published but still held
+  // back by an upstream stage do not signal, so the processor yields while
+  // those are pending, as a RingBuffer consumer spins on its dependencies. A
+  // timeout from a timeout strategy only starts another pass.
+  void idle(const std::vector<int64_t>& nextSequences) {
+    if constexpr (WaitStrategyT::kIsBlockingStrategy) {
+      LanesPublished lanesPublished{this, &nextSequences};
+      if (!lanesPublished.isAlerted()) {
+        (void)ringBuffer_->getWaitStrategy().tryWaitFor(0, idleCursor_, idleCursor_,
+                                                         lanesPublished);
+        return;
+      }
+    }
+    std::this_thread::yield();
+  }
+
+  bool drainLane(int64_t& nextSequence, E*& event) {
+    const int64_t availableSequence = sequenceBarrier_->available(lane_);
+    if (availableSequence < nextSequence) {
+      return false;
+    }
+    const int64_t endOfBatchSequence = (std::min)(nextSequence + batchLimitOffset_,
+                                                  availableSequence);
+    eventHandler_->onBatchStart(endOfBatchSequence - nextSequence + 1,
+                                availableSequence - nextSequence + 1);
+    auto& lane = ringBuffer_->lane(lane_);
+    while (nextSequence <= endOfBatchSequence) {
+      event = &lane.get(nextSequence);
+      eventHandler_->onEvent(*event, nextSequence, nextSequence == endOfBatchSequence);
+      ++nextSequence;
+    }
+    sequences_[lane_].set(endOfBatchSequence);
+    return true;
+  }
+};
+
+}  // namespace disruptor
@@ -0,0 +1,196 @@
+#pragma once
+// C++-only: multi-producer ring built from single-producer lanes (no Java
+// equivalent).
+
+#include "EventFactory.h"
+#include "RingBuffer.h"
+#include "Sequence.h"
+#include "SequenceArray.h"
+#include "SingleProducerSequencer.h"
+#include "util/MappedAllocator.h"
+#include "util/ExceptionSupport.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace disruptor {
+
+// Consumer side of a MultiLaneRingBuffer: one ProcessingSequenceBarrier per
+// lane. available() never blocks; MultiLaneEventProcessor polls the lanes
+// round-robin and parks on the lanes' wait strategy when they are all empty.
+// Alerts go to every lane barrier.
+template <typename LaneBarrierT>
+class MultiLaneSequenceBarrier final {
+public:
+  explicit MultiLaneSequenceBarrier(std::vector<std::shared_ptr<LaneBarrierT>> lanes)
+    : lanes_(std::move(lanes)) {}
+
+  int laneCount() const {
+    return static_cast<int>(lanes_.size());
+  }
+
+  // Highest sequence of lane that is published and, with dependencies,
+  // processed by every upstream consumer of that lane.
+  int64_t available(int lane) const {
+    return lanes_[static_cast<std::size_t>(lane)]->getCursor();
+  }
+
+  LaneBarrierT& lane(int lane) {
+    return *lanes_[static_cast<std::size_t>(lane)];
+  }
+
+  bool isAlerted() const {
+    return lanes_.front()->isAlerted();
+  }
+
+  void alert() {
+    for (auto& lane : lanes_) {
+      lane->alert();
+    }
+  }
+
+  void clearAlert() {
+    for (auto& lane : lanes_) {
+      lane->clearAlert();
+    }
+  }
+
+  void checkAlert() {
+    lanes_.front()->checkAlert();
+  }
+
+private:
+  std::vector<std::shared_ptr<LaneBarrierT>> lanes_;
+};
+
+// A multi-producer ring with no shared claim cursor: each producer registers
+// once and gets its own lane, a RingBuffer over a SingleProducerSequencer, so
+// claiming and publishing never touch a line another producer writes.
+// Consumers (MultiLaneEventProcessor) merge the lanes.
+//
+// Ordering is per lane only: events from one producer arrive in order, events
+// from different producers interleave in whatever order the consumer drains
+// the lanes. Every consumer has one Sequence per lane (a SequenceArray of
+// laneCount()); addGatingSequences() gates lane i on element i, and
+// newBarrier() makes a later stage wait on element i of each upstream array,
+// so gating and stage dependencies work exactly as on a RingBuffer, per lane.
+template <typename E, typename WaitStrategyT>
+class MultiLaneRingBuffer final {
+public:
+  using LaneT = RingBuffer<E, SingleProducerSequencer<WaitStrategyT>>;
+  using LaneBarrierT =
+    typename decltype(std::declval<LaneT&>().newBarrier(nullptr, 0))::element_type;
+  using BarrierT = MultiLaneSequenceBarrier<LaneBarrierT>;
+
+  static std::shared_ptr<MultiLaneRingBuffer> create(std::shared_ptr<EventFactory<E>> factory,
+                                                     int laneCount,
+                                                     int laneSize,
+                                                     WaitStrategyT& waitStrategy,
+                                                     const util::MemoryPolicy& memoryPolicy = {}) {
+    return std::make_shared<MultiLaneRingBuffer>(
+      std::move(factory), laneCount, laneSize, waitStrategy, memoryPolicy);
+  }
+
+  MultiLaneRingBuffer(std::shared_ptr<EventFactory<E>> factory,
+                      int laneCount,
+                      int laneSize,
+                      WaitStrategyT& waitStrategy,
+                      const util::MemoryPolicy& memoryPolicy = {}) {
+    if (laneCount < 1) {
+      util::raise(std::invalid_argument("laneCount must be greater than 0"));
+    }
+    lanes_.reserve(static_cast<std::size_t>(laneCount));
+    for (int i = 0; i < laneCount; ++i) {
+      lanes_.push_back(LaneT::createSingleProducer(factory, laneSize, waitStrategy, memoryPolicy));
+    }
+  }
+
+  int laneCount() const {
+    return static_cast<int>(lanes_.size());
+  }
+
+  int getLaneSize() const {
+    return lanes_.front()->getBufferSize();
+  }
+
+  LaneT& lane(int lane) {
+    return *lanes_[static_cast<std::size_t>(lane)];
+  }
+
+  // Hands out the next unused lane. Each producer thread calls this once and
+  // publishes only through its lane (single-producer rules apply per lane).
+  LaneT& registerProducer() {
+    const int lane = registeredProducers_.fetch_add(1, std::memory_order_relaxed);
+    if (lane >= laneCount()) {
+      registeredProducers_.fetch_sub(1, std::memory_order_relaxed);
+      util::raise(std::length_error("every lane already has a producer"));
+    }
+    return this->lane(lane);
+  }
+
+  // The strategy every lane was created with; any lane's publish signals it.
+  WaitStrategyT& getWaitStrategy() {
+    return lane(0).getSequencer().getWaitStrategy();
+  }
+
+  E& get(int lane, int64_t sequence) {
+    return this->lane(lane).get(sequence);
+  }
+
+  // Lane i is gated on laneSequences[i].
+  void addGatingSequences(SequenceArray& laneSequences) {
+    requireLaneCount(laneSequences);
+    for (int i = 0; i < laneCount(); ++i) {
+      lane(i).addGatingSequences(laneSequences[i]);
+    }
+  }
+
+  bool removeGatingSequences(SequenceArray& laneSequences) {
+    requireLaneCount(laneSequences);
+    bool removed = false;
+    for (int i = 0; i < laneCount(); ++i) {
+      removed = lane(i).removeGatingSequence(laneSequences[i]) || removed;
+    }
+    return removed;
+  }
+
+  // Lane i's barrier waits on element i of every upstream consumer's array.
+  std::shared_ptr<BarrierT> newBarrier(SequenceArray* const* dependencies, int count) {
+    std::vector<std::shared_ptr<LaneBarrierT>> barriers;
+    barriers.reserve(lanes_.size());
+    std::vector<Sequence*> laneDependencies(static_cast<std::size_t>(count));
+    for (int k = 0; k < count; ++k) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      requireLaneCount(*dependencies[k]);
+    }
+    for (int i = 0; i < laneCount(); ++i) {
+      for (int k = 0; k < count; ++k) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        laneDependencies[static_cast<std::size_t>(k)] = &(*dependencies[k])[i];
+      }
+      barriers.push_back(lane(i).newBarrier(laneDependencies.data(), count));
+    }
+    return std::make_shared<BarrierT>(std::move(barriers));
+  }
+
+  std::shared_ptr<BarrierT> newBarrier() {
+    return newBarrier(nullptr, 0);
+  }
+
+private:
+  std::vector<std::shared_ptr<LaneT>> lanes_;
+  std::atomic<int> registeredProducers_{0};
+
+  void requireLaneCount(const SequenceArray& laneSequences) const {
+    if (laneSequences.capacity() != laneCount()) {
+      util::raise(std::invalid_argument("need one sequence per lane"));
+    }
+  }
+};
+
+}  // namespace disruptor
@@ -4,40 +4,74 @@
 // reference/disruptor/src/main/java/com/lmax/disruptor/MultiProducerSequencer.java
 
 #include "AbstractSequencer.h"
+#include "AvailableBuffer.h"
+#include "ClaimChunk.h"
 #include "Error.h"
 #include "ProcessingSequenceBarrier.h"
 #include "Sequence.h"
+#include "SequenceGroupView.h"
 #include "WaitStrategy.h"
+#include "util/ExceptionSupport.h"
+#include "util/MappedAllocator.h"
 #include "util/ThreadHints.h"
 #include "util/Util.h"
 
+#include <array>
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <expected>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <type_traits>
 #include <vector>
 
 namespace disruptor {
 
-template <typename WaitStrategyT>
-class MultiProducerSequencer final : public AbstractSequencer<WaitStrategyT> {
+// AvailableBufferT tracks which claimed sequences have been published:
+// AvailableBuffer (Java's int-per-slot layout) or ParityBitmapAvailableBuffer.
+// BufferSize != kDynamicBufferSize fixes the ring size (and the tracker's
+// index mask/shift) at compile time. ExternalCursor claims on a cursor held
+// elsewhere (see AbstractSequencer).
+template <typename WaitStrategyT,
+          template <int> class AvailableBufferT = AvailableBuffer,
+          int BufferSize = kDynamicBufferSize,
+          bool ExternalCursor = false>
+class MultiProducerSequencer final
+  : public AbstractSequencer<WaitStrategyT, BufferSize, ExternalCursor> {
+  using Base = AbstractSequencer<WaitStrategyT, BufferSize, ExternalCursor>;
+
 public:
-  MultiProducerSequencer(int bufferSize, WaitStrategyT& waitStrategy)
-    : AbstractSequencer<WaitStrategyT>(bufferSize, waitStrategy)
+  // memoryPolicy backs the availability buffer (see MappedAllocator).
+  MultiProducerSequencer(int bufferSize,
+                         WaitStrategyT& waitStrategy,
+                         const util::MemoryPolicy& memoryPolicy = {})
+    requires(!ExternalCursor)
+    : Base(bufferSize, waitStrategy)
     , gatingSequenceCache_(SEQUENCER_INITIAL_CURSOR_VALUE)
-    , availableBuffer_(static_cast<size_t>(bufferSize))
-    , indexMask_(bufferSize - 1)
-    , indexShift_(disruptor::util::Util::log2(bufferSize))
-    , gatingSequencesCache_(nullptr) {
-    for (auto& a : availableBuffer_) {
-      a.store(-1, std::memory_order_relaxed);
-    }
-  }
+    , availableBuffer_(bufferSize, memoryPolicy) {}
+
+  // C++-only: claims on cursor and publishes into availableBuffer (bufferSize
+  // flags) held elsewhere, e.g. in a shared memory segment (see
+  // SharedMemoryRingBuffer). Neither is initialised here.
+  MultiProducerSequencer(int bufferSize,
+                         WaitStrategyT& waitStrategy,
+                         Sequence& cursor,
+                         std::atomic<int>* availableBuffer)
+    requires(ExternalCursor &&
+             std::is_constructible_v<AvailableBufferT<BufferSize>, int, std::atomic<int>*>)
+    : Base(bufferSize, waitStrategy, cursor)
+    , gatingSequenceCache_(SEQUENCER_INITIAL_CURSOR_VALUE)
+    , availableBuffer_(bufferSize, availableBuffer) {}
+
+  explicit MultiProducerSequencer(WaitStrategyT& waitStrategy,
+                                  const util::MemoryPolicy& memoryPolicy = {})
+    requires(BufferSize != kDynamicBufferSize && !ExternalCursor)
+    : MultiProducerSequencer(BufferSize, waitStrategy, memoryPolicy) {}
 
   bool hasAvailableCapacity(int requiredCapacity) {
-    auto snap = this->gatingSequences_.load(std::memory_order_acquire);
-    // Java passes gatingSequences array + cursor.get()
-    return hasAvailableCapacity(snap.get(), requiredCapacity, this->cursor_.get());
+    return hasAvailableCapacity(requiredCapacity, this->cursor_.get());
   }
 
   void claim(int64_t sequence) {
@@ -49,13 +83,13 @@ public:
   }
 
   int64_t next(int n) {
-    if (n < 1 || n > this->bufferSize_) {
-      throw std::invalid_argument("n must be > 0 and < bufferSize");
+    if (n < 1 || n > this->bufferSize_.size()) {
+      util::raise(std::invalid_argument("n must be > 0 and < bufferSize"));
     }
 
     int64_t current = this->cursor_.getAndAdd(n);
     int64_t nextSequence = current + n;
-    int64_t wrapPoint = nextSequence - this->bufferSize_;
+    int64_t wrapPoint = nextSequence - this->bufferSize_.size();
     int64_t cachedGatingSequence = gatingSequenceCache_.get();
 
     if (wrapPoint > cachedGatingSequence || cachedGatingSequence > current) {
@@ -87,8 +121,7 @@ public:
       current = this->cursor_.get();
       next = current + n;
 
-      auto snap = this->gatingSequences_.load(std::memory_order_acquire);
-      if (!hasAvailableCapacity(snap.get(), n, current)) [[unlikely]] {
+      if (!hasAvailableCapacity(n, current)) [[unlikely]] {
         return std::unexpected(Error::insufficient_capacity());
       }
     } while (!this->cursor_.compareAndSet(current, next));
@@ -103,76 +136,117 @@ public:
   }
 
   void publish(int64_t sequence) {
-    setAvailable(sequence);
+    availableBuffer_.setAvailable(sequence);
     if constexpr (WaitStrategyT::kIsBlockingStrategy) {
       this->waitStrategy_->signalAllWhenBlocking();
     }
   }
 
   void publish(int64_t lo, int64_t hi) {
-    for (int64_t l = lo; l <= hi; ++l) {
-      setAvailable(l);
-    }
+    availableBuffer_.setAvailable(lo, hi);
     if constexpr (WaitStrategyT::kIsBlockingStrategy) {
       this->waitStrategy_->signalAllWhenBlocking();
     }
   }
 
+  // C++-only: a per-producer claim handle; see ClaimChunk. The first call
+  // enables skip tracking (one int per slot), after which consumers check
+  // isSkipped() for every event.
+  ClaimChunk<MultiProducerSequencer> newClaimChunk(int chunkSize) {
+    std::call_once(skippedLapsOnce_, [this] {
+      const auto size = static_cast<std::size_t>(this->bufferSize_.size());
+      skippedLapsStorage_ = std::make_unique<std::atomic<int>[]>(size);
+      for (std::size_t i = 0; i < size; ++i) {
+        skippedLapsStorage_[i].store(-1, std::memory_order_relaxed);
+      }
+      skippedLaps_.store(skippedLapsStorage_.get(), std::memory_order_release);
+    });
+    return ClaimChunk<MultiProducerSequencer>(*this, chunkSize);
+  }
+
+  // Publishes claimed sequences that carry no event (ClaimChunk::flush).
+  // They count as published for getHighestPublishedSequence; consumers skip
+  // them.
+  void publishSkipped(int64_t lo, int64_t hi) {
+    std::atomic<int>* laps = skippedLaps_.load(std::memory_order_acquire);
+    if (laps == nullptr) {
+      util::raise(std::logic_error("publishSkipped requires newClaimChunk"));
+    }
+    for (int64_t sequence = lo; sequence <= hi; ++sequence) {
+      // Ordered before the consumer's acquire of the slot's availability.
+      laps[skipIndex(sequence)].store(skipLap(sequence), std::memory_order_relaxed);
+    }
+    publish(lo, hi);
+  }
+
+  // False until the first newClaimChunk(); consumers then check isSkipped().
+  bool hasSkippedSequences() const {
+    return skippedLaps_.load(std::memory_order_acquire) != nullptr;
+  }
+
+  // Only meaningful for a sequence the caller has seen published.
+  bool isSkipped(int64_t sequence) const {
+    const std::atomic<int>* laps = skippedLaps_.load(std::memory_order_acquire);
+    return laps != nullptr
+           && laps[skipIndex(sequence)].load(std::memory_order_relaxed) == skipLap(sequence);
+  }
+
+  // Highest sequence in [lo, hi] that is not skipped, or lo - 1.
+  int64_t lastUnskippedSequence(int64_t lo, int64_t hi) const {
+    while (hi >= lo && isSkipped(hi)) {
+      --hi;
+    }
+    return hi;
+  }
+
   bool isAvailable(int64_t sequence) {
-    int index = calculateIndex(sequence);
-    int flag = calculateAvailabilityFlag(sequence);
-    return availableBuffer_[static_cast<size_t>(index)].load(std::memory_order_acquire) == flag;
+    return availableBuffer_.isAvailable(sequence);
   }
 
   int64_t getHighestPublishedSequence(int64_t lowerBound, int64_t availableSequence) {
-    for (int64_t sequence = lowerBound; sequence <= availableSequence; ++sequence) {
-      if (!isAvailable(sequence)) {
-        return sequence - 1;
-      }
-    }
-    return availableSequence;
+    return availableBuffer_.getHighestPublishedSequence(lowerBound, availableSequence);
   }
 
-  std::shared_ptr<ProcessingSequenceBarrier<MultiProducerSequencer<WaitStrategyT>, WaitStrategyT>>
+  std::shared_ptr<ProcessingSequenceBarrier<MultiProducerSequencer, WaitStrategyT>>
   newBarrier(Sequence* const* sequencesToTrack, int count) {
-    return std::make_shared<
-      ProcessingSequenceBarrier<MultiProducerSequencer<WaitStrategyT>, WaitStrategyT>>(
+    return std::make_shared<ProcessingSequenceBarrier<MultiProducerSequencer, WaitStrategyT>>(
       *this, *this->waitStrategy_, this->cursor_, sequencesToTrack, count);
   }
 
-  // Override to invalidate cache when gating sequences change
-  void addGatingSequences(Sequence* const* gatingSequences, int count) {
-    AbstractSequencer<WaitStrategyT>::addGatingSequences(gatingSequences, count);
-    gatingSequencesCache_ = nullptr;  // Invalidate cache
-  }
-
-  bool removeGatingSequence(Sequence& sequence) {
-    bool result = AbstractSequencer<WaitStrategyT>::removeGatingSequence(sequence);
-    gatingSequencesCache_ = nullptr;  // Invalidate cache
-    return result;
+  // Dependency count known at compile time: the barrier gates on a
+  // SequenceGroupView<N> (the cursor when N == 0) instead of a FixedSequenceGroup.
+  template <std::size_t N>
+  auto newBarrier(const std::array<Sequence*, N>& sequencesToTrack) {
+    using BarrierT = ProcessingSequenceBarrier<MultiProducerSequencer,
+                                               WaitStrategyT,
+                                               SequenceGroupView<(N == 0 ? 1 : N)>>;
+    return std::make_shared<BarrierT>(*this, *this->waitStrategy_, this->cursor_,
+                                      sequencesToTrack.data(), static_cast<int>(N));
   }
 
 private:
   Sequence gatingSequenceCache_;
-  std::vector<std::atomic<int>> availableBuffer_;
-  int indexMask_;
-  int indexShift_;
-  // Optimization: Cache raw pointer to gatingSequences vector to avoid atomic
-  // shared_ptr operations. This is safe because gatingSequences_ is only
-  // updated during add/remove (not on hot path), and we refresh the cache when
-  // it's null.
-  mutable const std::vector<Sequence*>* gatingSequencesCache_;
-
-  bool hasAvailableCapacity(const std::vector<Sequence*>* gatingSequences,
-                            int requiredCapacity,
-                            int64_t cursorValue) {
-    int64_t wrapPoint = (cursorValue + requiredCapacity) - this->bufferSize_;
+  AvailableBufferT<BufferSize> availableBuffer_;
+  // Lap of the last skipped publication per slot, like AvailableBuffer's
+  // flags; allocated by the first newClaimChunk().
+  std::atomic<std::atomic<int>*> skippedLaps_{nullptr};
+  std::unique_ptr<std::atomic<int>[]> skippedLapsStorage_;
+  std::once_flag skippedLapsOnce_;
+
+  std::size_t skipIndex(int64_t sequence) const {
+    return static_cast<std::size_t>(sequence & this->bufferSize_.mask());
+  }
+
+  int skipLap(int64_t sequence) const {
+    return static_cast<int>(sequence >> this->bufferSize_.shift());
+  }
+
+  bool hasAvailableCapacity(int requiredCapacity, int64_t cursorValue) {
+    int64_t wrapPoint = (cursorValue + requiredCapacity) - this->bufferSize_.size();
     int64_t cachedGatingSequence = gatingSequenceCache_.get();
 
     if (wrapPoint > cachedGatingSequence || cachedGatingSequence > cursorValue) {
-      int64_t minSequence =
-        gatingSequences ? disruptor::util::Util::getMinimumSequence(*gatingSequences, cursorValue)
-                        : cursorValue;
+      int64_t minSequence = minimumSequence(cursorValue);
       gatingSequenceCache_.set(minSequence);
 
       if (wrapPoint > minSequence) {
@@ -183,39 +257,8 @@ private:
     return true;
   }
 
-  void setAvailable(int64_t sequence) {
-    setAvailableBufferValue(calculateIndex(sequence), calculateAvailabilityFlag(sequence));
-  }
-
-  void setAvailableBufferValue(int index, int flag) {
-    availableBuffer_[static_cast<size_t>(index)].store(flag, std::memory_order_release);
-  }
-
-  int calculateAvailabilityFlag(int64_t sequence) const {
-    return static_cast<int>(sequence >> indexShift_);
-  }
-
-  int calculateIndex(int64_t sequence) const {
-    return static_cast<int>(sequence) & indexMask_;
-  }
-
   int64_t minimumSequence(int64_t defaultMin) {
-    // Optimization: Cache raw pointer to avoid shared_ptr atomic operations on
-    // hot path. gatingSequences_ is updated rarely (only when consumers are
-    // added/removed), but accessed frequently in next(). Use cached pointer for
-    // fast path.
-    auto* cached = gatingSequencesCache_;
-    if (!cached) {
-      // Fallback: reload if cache is null (initialization or after
-      // modifications)
-      auto snap = this->gatingSequences_.load(std::memory_order_acquire);
-      if (!snap) {
-        return defaultMin;
-      }
-      gatingSequencesCache_ = snap.get();
-      return disruptor::util::Util::getMinimumSequence(*snap, defaultMin);
-    }
-    return disruptor::util::Util::getMinimumSequence(*cached, defaultMin);
+    return this->gatingSequences_.minimumSequence(defaultMin);
   }
 };
 
@@ -4,7 +4,6 @@
 
 #include "EventProcessor.h"
 #include "Sequence.h"
-#include "Sequencer.h"
 
 #include <atomic>
 #include <cstdint>
@@ -16,7 +15,10 @@ namespace disruptor {
 template <typename T, typename RingBufferT>
 class NoOpEventProcessor final : public EventProcessor {
 public:
-  explicit NoOpEventProcessor(RingBufferT& sequencer) : sequence_(sequencer), running_(false) {}
+  explicit NoOpEventProcessor(RingBufferT& sequencer) : running_(false) {
+    static_assert(!std::is_reference_v<RingBufferT>, "RingBufferT must not be a reference type");
+    sequence_.follow(sequencer.getSequencer().cursorSequence());
+  }
 
   Sequence& getSequence() override {
     return sequence_;
@@ -38,23 +40,13 @@ public:
   }
 
 private:
-  // Java inner SequencerFollowingSequence extends Sequence and wraps RingBuffer.getCursor().
-  class SequencerFollowingSequence final : public Sequence {
-  public:
-    explicit SequencerFollowingSequence(RingBufferT& sequencer)
-      : Sequence(SEQUENCER_INITIAL_CURSOR_VALUE), sequencer_(&sequencer) {
-      static_assert(!std::is_reference_v<RingBufferT>, "RingBufferT must not be a reference type");
-    }
-
-    int64_t get() const noexcept override {
-      return sequencer_->getCursor();
-    }
-
-  private:
-    std::remove_reference_t<RingBufferT>* sequencer_;
-  };
-
-  SequencerFollowingSequence sequence_;
+  // Java inner SequencerFollowingSequence extends Sequence and overrides get()
+  // to return RingBuffer.getCursor(). Sequence is final in C++, so this is a
+  // separate Sequence that follows the cursor: gating registration, barriers
+  // built on it and the DSL's backlog check read the cursor through
+  // gatingTarget(), while registration's writes land here and never move the
+  // cursor. Its own get() is only what the last registration wrote.
+  Sequence sequence_;
   std::atomic<bool> running_;
 };
 
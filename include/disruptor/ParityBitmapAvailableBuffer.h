@@ -0,0 +1,131 @@
+#pragma once
+// C++-only alternative to MultiProducerSequencer's availableBuffer (no Java
+// equivalent). Drop-in for AvailableBuffer:
+//   MultiProducerSequencer<WaitStrategyT, ParityBitmapAvailableBuffer>
+
+#include "RingBufferSize.h"
+#include "util/MappedAllocator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace disruptor {
+
+// One bit per slot holding the parity of the lap that last published into it.
+// Sequence s is available when bit (s & mask) equals (s >> log2(bufferSize)) & 1.
+// Initial bits are 1, i.e. lap -1 published, nothing of lap 0.
+//
+// A 1M-slot ring needs 128 KB instead of 4 MB, and getHighestPublishedSequence
+// checks up to 64 slots per acquire load: the scan of a 4096-event batch is 64
+// loads plus a countr_zero on the first word with a gap. publish(lo, hi) sets a
+// whole word's worth of slots with one fetch_or/fetch_and.
+//
+// Only the lap parity is kept, so a slot is reported as published once its bit
+// matches, regardless of how many laps apart the two publications were. That is
+// enough for the sequencer, which never claims a slot again before consumers
+// (and hence the previous publication) have moved past it.
+//
+// Producers publishing neighbouring sequences now RMW the same word; with many
+// producers on small batches the int-per-slot AvailableBuffer can still win.
+template <int BufferSize = kDynamicBufferSize>
+class ParityBitmapAvailableBuffer final {
+public:
+  explicit ParityBitmapAvailableBuffer(int bufferSize, const util::MemoryPolicy& memoryPolicy = {})
+    : bufferSize_(bufferSize)
+    , words_(static_cast<size_t>((bufferSize + kBitsPerWord - 1) / kBitsPerWord),
+             util::MappedAllocator<std::atomic<uint64_t>>(memoryPolicy)) {
+    for (auto& w : words_) {
+      w.store(~uint64_t{0}, std::memory_order_relaxed);
+    }
+  }
+
+  void setAvailable(int64_t sequence) {
+    const int index = calculateIndex(sequence);
+    const uint64_t bit = uint64_t{1} << (index & kBitMask);
+    auto& word = words_[static_cast<size_t>(index >> kWordShift)];
+    if (calculateParity(sequence)) {
+      word.fetch_or(bit, std::memory_order_release);
+    } else {
+      word.fetch_and(~bit, std::memory_order_release);
+    }
+  }
+
+  // All slots of one run share a word and a lap, so each run is a single RMW.
+  void setAvailable(int64_t lo, int64_t hi) {
+    int64_t sequence = lo;
+    while (sequence <= hi) {
+      const int index = calculateIndex(sequence);
+      const int bit = index & kBitMask;
+      const int run = runLength(index, hi - sequence + 1);
+      const uint64_t mask = runMask(bit, run);
+      auto& word = words_[static_cast<size_t>(index >> kWordShift)];
+      if (calculateParity(sequence)) {
+        word.fetch_or(mask, std::memory_order_release);
+      } else {
+        word.fetch_and(~mask, std::memory_order_release);
+      }
+      sequence += run;
+    }
+  }
+
+  bool isAvailable(int64_t sequence) const {
+    const int index = calculateIndex(sequence);
+    const uint64_t word =
+      words_[static_cast<size_t>(index >> kWordShift)].load(std::memory_order_acquire);
+    return ((word >> (index & kBitMask)) & 1U) == calculateParity(sequence);
+  }
+
+  int64_t getHighestPublishedSequence(int64_t lowerBound, int64_t availableSequence) const {
+    int64_t sequence = lowerBound;
+    while (sequence <= availableSequence) {
+      const int index = calculateIndex(sequence);
+      const int bit = index & kBitMask;
+      const int run = runLength(index, availableSequence - sequence + 1);
+      const uint64_t word =
+        words_[static_cast<size_t>(index >> kWordShift)].load(std::memory_order_acquire);
+      // Bits that match this lap's parity are published.
+      const uint64_t published = calculateParity(sequence) ? word : ~word;
+      const uint64_t missing = ~published & runMask(bit, run);
+      if (missing != 0) {
+        return sequence + (std::countr_zero(missing) - bit) - 1;
+      }
+      sequence += run;
+    }
+    return availableSequence;
+  }
+
+private:
+  static constexpr int kBitsPerWord = 64;
+  static constexpr int kBitMask = kBitsPerWord - 1;
+  static constexpr int kWordShift = 6;
+
+  [[no_unique_address]] RingBufferSize<BufferSize> bufferSize_;
+  std::vector<std::atomic<uint64_t>, util::MappedAllocator<std::atomic<uint64_t>>> words_;
+
+  // Slots from index up to the end of its word, the end of the ring (rings
+  // smaller than 64 slots) or the requested count, whichever comes first.
+  int runLength(int index, int64_t remaining) const {
+    const int toBoundary =
+      (std::min)(kBitsPerWord - (index & kBitMask), bufferSize_.size() - index);
+    return static_cast<int>((std::min)(static_cast<int64_t>(toBoundary), remaining));
+  }
+
+  static uint64_t runMask(int bit, int run) {
+    const uint64_t low = run == kBitsPerWord ? ~uint64_t{0} : (uint64_t{1} << run) - 1;
+    return low << bit;
+  }
+
+  uint64_t calculateParity(int64_t sequence) const {
+    return static_cast<uint64_t>(sequence >> bufferSize_.shift()) & 1U;
+  }
+
+  int calculateIndex(int64_t sequence) const {
+    return static_cast<int>(sequence) & bufferSize_.mask();
+  }
+};
+
+}  // namespace disruptor
@@ -0,0 +1,136 @@
+#pragma once
+// C++-only: hash-partitioned handler groups on one ring (no Java equivalent).
+// Wired up by dsl::Disruptor::handleEventsWithPartitioned.
+
+#include "EventHandler.h"
+#include "RingBufferSize.h"
+#include "Sequence.h"
+#include "util/ExceptionSupport.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+
+namespace disruptor {
+
+// One partition number per ring slot, kept outside the events. Producers tag
+// each claimed sequence with its key's hash between next() and publish(); the
+// publish orders the tag like the rest of the event. A partition's processor
+// then decides whether an event is its own from a 2-byte tag (64 slots per
+// cache line) instead of loading the event.
+class PartitionTags final {
+public:
+  PartitionTags(int bufferSize, int partitions)
+    : bufferSize_(bufferSize)
+    , partitions_(partitions)
+    , tags_(std::make_unique<std::uint16_t[]>(static_cast<std::size_t>(bufferSize))) {
+    if (partitions < 1 || partitions > 0xFFFF) {
+      util::raise(std::invalid_argument("partitions must be between 1 and 65535"));
+    }
+  }
+
+  int partitions() const {
+    return partitions_;
+  }
+
+  int bufferSize() const {
+    return bufferSize_.size();
+  }
+
+  // Producer side: the event at sequence goes to partition keyHash % partitions.
+  void tag(int64_t sequence, std::uint64_t keyHash) {
+    tags_[index(sequence)] =
+      static_cast<std::uint16_t>(keyHash % static_cast<std::uint64_t>(partitions_));
+  }
+
+  int partitionOf(int64_t sequence) const {
+    return tags_[index(sequence)];
+  }
+
+private:
+  RingBufferSize<kDynamicBufferSize> bufferSize_;
+  int partitions_;
+  std::unique_ptr<std::uint16_t[]> tags_;
+
+  std::size_t index(int64_t sequence) const {
+    return static_cast<std::size_t>(sequence & bufferSize_.mask());
+  }
+};
+
+// Runs handler for the events tagged with partition and steps over the rest.
+// Events go to handler as the processor delivers them. endOfBatch reaches
+// handler on its last event of each processor batch, found when the batch
+// starts by scanning its tags back from the end. The batch starts one past the
+// processor's Sequence (setSequenceCallback), else at its first event.
+// onBatchStart is not forwarded (the batch size counts other partitions'
+// events). A claim-chunk sequencer's skipped slots keep stale tags; one that
+// matches takes endOfBatch with it.
+template <typename T>
+class PartitionedEventHandler final : public EventHandler<T> {
+public:
+  PartitionedEventHandler(EventHandler<T>& handler, const PartitionTags& tags, int partition)
+    : handler_(&handler), tags_(&tags), partition_(partition) {
+    if (partition < 0 || partition >= tags.partitions()) {
+      util::raise(std::invalid_argument("partition out of range"));
+    }
+  }
+
+  void onBatchStart(int64_t batchSize, int64_t /*queueDepth*/) override {
+    batchSize_ = batchSize;
+  }
+
+  void onEvent(T& event, int64_t sequence, bool endOfBatch) override {
+    if (batchSize_ > 0) {
+      const int64_t first = sequenceCallback_ != nullptr ? sequenceCallback_->get() + 1 : sequence;
+      lastOwnedSequence_ = lastOwnedSequence(first, first + batchSize_ - 1);
+      batchSize_ = 0;
+    }
+    if (tags_->partitionOf(sequence) == partition_) {
+      handler_->onEvent(event, sequence, endOfBatch || sequence == lastOwnedSequence_);
+    }
+  }
+
+  void onStart() override {
+    handler_->onStart();
+  }
+
+  void onShutdown() override {
+    handler_->onShutdown();
+  }
+
+  void onTimeout(int64_t sequence) override {
+    handler_->onTimeout(sequence);
+  }
+
+  void setSequenceCallback(Sequence& sequenceCallback) override {
+    sequenceCallback_ = &sequenceCallback;
+    handler_->setSequenceCallback(sequenceCallback);
+  }
+
+  EventHandler<T>& handler() {
+    return *handler_;
+  }
+
+  int partition() const {
+    return partition_;
+  }
+
+private:
+  EventHandler<T>* handler_;
+  const PartitionTags* tags_;
+  int partition_;
+  Sequence* sequenceCallback_{nullptr};
+  int64_t batchSize_{0};
+  int64_t lastOwnedSequence_{-1};
+
+  // Highest sequence in [lo, hi] tagged with partition_, or lo - 1.
+  int64_t lastOwnedSequence(int64_t lo, int64_t hi) const {
+    while (hi >= lo && tags_->partitionOf(hi) != partition_) {
+      --hi;
+    }
+    return hi;
+  }
+};
+
+}  // namespace disruptor
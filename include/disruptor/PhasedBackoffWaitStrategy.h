@@ -59,11 +59,19 @@ public:
                                                            std::in_place, 0);
   }
 
-  template <typename Barrier>
+  template <typename DependentSequenceT, typename Barrier>
   int64_t waitFor(int64_t sequence,
                   const Sequence& cursor,
-                  const Sequence& dependentSequence,
+                  const DependentSequenceT& dependentSequence,
                   Barrier& barrier) {
+    return waitResultOrThrow(tryWaitFor(sequence, cursor, dependentSequence, barrier));
+  }
+
+  template <typename DependentSequenceT, typename Barrier>
+  WaitResult tryWaitFor(int64_t sequence,
+                        const Sequence& cursor,
+                        const DependentSequenceT& dependentSequence,
+                        Barrier& barrier) {
     int64_t availableSequence;
     int64_t startTimeNs = 0;
     int counter = SPIN_TRIES;
@@ -80,7 +88,7 @@ public:
         } else {
           const int64_t timeDelta = nowNanos() - startTimeNs;
           if (timeDelta > yieldTimeoutNanos_) {
-            return fallbackStrategy_.waitFor(sequence, cursor, dependentSequence, barrier);
+            return fallbackStrategy_.tryWaitFor(sequence, cursor, dependentSequence, barrier);
           } else if (timeDelta > spinTimeoutNanos_) {
             std::this_thread::yield();
           }
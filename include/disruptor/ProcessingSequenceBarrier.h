@@ -6,41 +6,105 @@
 #include "FixedSequenceGroup.h"
 #include "Sequence.h"
 #include "WaitStrategy.h"
+#include "util/ExceptionSupport.h"
 
+#include <array>
 #include <atomic>
+#include <concepts>
 #include <cstdint>
-#include <memory>
+#include <utility>
 
 namespace disruptor {
 
 // Java: final class ProcessingSequenceBarrier implements SequenceBarrier
 // C++ (template): eliminate virtual dispatch by templating on Sequencer + WaitStrategy.
-template <typename SequencerT, typename WaitStrategyT>
+//
+// Java stores the dependent sequence as a Sequence (either the cursor or a
+// FixedSequenceGroup) and relies on virtual get(). Here the dependent type is
+// a template parameter: FixedSequenceGroup when the dependency count is only
+// known at runtime, SequenceGroupView<N> when it is known at compile time.
+// With no dependencies the group wraps the cursor itself.
+template <typename SequencerT,
+          typename WaitStrategyT,
+          typename DependentSequenceT = FixedSequenceGroup>
 class ProcessingSequenceBarrier final {
 public:
+  using DependentSequenceType = DependentSequenceT;
+
+  // C++-only: WaitStrategyT has tryWaitFor (see WaitStrategy.h).
+  static constexpr bool kStrategyTriesWait = requires(WaitStrategyT& waitStrategy,
+                                                      Sequence& cursor,
+                                                      DependentSequenceT& dependentSequence,
+                                                      ProcessingSequenceBarrier& barrier) {
+    { waitStrategy.tryWaitFor(int64_t{0}, cursor, dependentSequence, barrier) }
+      -> std::same_as<WaitResult>;
+  };
+
   ProcessingSequenceBarrier(SequencerT& sequencer,
                             WaitStrategyT& waitStrategy,
                             Sequence& cursorSequence,
                             Sequence* const* dependentSequences,
                             int dependentCount)
+    : ProcessingSequenceBarrier(
+        sequencer,
+        waitStrategy,
+        cursorSequence,
+        makeDependentSequence(cursorSequence, dependentSequences, dependentCount)) {}
+
+  ProcessingSequenceBarrier(SequencerT& sequencer,
+                            WaitStrategyT& waitStrategy,
+                            Sequence& cursorSequence,
+                            DependentSequenceT dependentSequence)
     : waitStrategy_(&waitStrategy)
+    , dependentSequence_(std::move(dependentSequence))
     , alerted_(false)
     , cursorSequence_(&cursorSequence)
-    , sequencer_(&sequencer) {
-    if (dependentCount == 0) {
-      dependentSequence_ = &cursorSequence;
+    , sequencer_(&sequencer) {}
+
+  int64_t waitFor(int64_t sequence) {
+    if constexpr (kStrategyTriesWait) {
+      return waitResultOrThrow(tryWaitFor(sequence));
     } else {
-      fixedGroup_ = std::make_unique<FixedSequenceGroup>(dependentSequences, dependentCount);
-      dependentSequence_ = fixedGroup_.get();
+      checkAlert();
+
+      int64_t availableSequence =
+        waitStrategy_->waitFor(sequence, *cursorSequence_, dependentSequence_, *this);
+
+      if (availableSequence < sequence) {
+        return availableSequence;
+      }
+
+      return sequencer_->getHighestPublishedSequence(sequence, availableSequence);
     }
   }
 
-  int64_t waitFor(int64_t sequence) {
-    checkAlert();
+  // C++-only: waitFor without exceptions; an alert or a wait strategy timeout
+  // is returned as ErrorCode::Alerted or ErrorCode::Timeout.
+  WaitResult tryWaitFor(int64_t sequence)
+    requires kStrategyTriesWait
+  {
+    if (isAlerted()) [[unlikely]] {
+      return std::unexpected(ErrorCode::Alerted);
+    }
+
+    const WaitResult availableSequence =
+      waitStrategy_->tryWaitFor(sequence, *cursorSequence_, dependentSequence_, *this);
 
-    int64_t availableSequence =
-      waitStrategy_->waitFor(sequence, *cursorSequence_, *dependentSequence_, *this);
+    if (!availableSequence || *availableSequence < sequence) {
+      return availableSequence;
+    }
 
+    return sequencer_->getHighestPublishedSequence(sequence, *availableSequence);
+  }
+
+  // C++-only: tryWaitFor without the wait. A result below sequence means it
+  // is not available yet.
+  WaitResult pollAvailable(int64_t sequence) {
+    if (isAlerted()) [[unlikely]] {
+      return std::unexpected(ErrorCode::Alerted);
+    }
+
+    const int64_t availableSequence = dependentSequence_.get();
     if (availableSequence < sequence) {
       return availableSequence;
     }
@@ -48,8 +112,40 @@ public:
     return sequencer_->getHighestPublishedSequence(sequence, availableSequence);
   }
 
+  // C++-only: co_await barrier.waitForAsync(sequence) from a ScheduledTask
+  // waits like tryWaitFor, suspending the coroutine instead of the thread.
+  // Needs a wait strategy with coroutine support (AsyncWaitStrategy).
+  auto waitForAsync(int64_t sequence)
+    requires requires {
+      typename WaitStrategyT::template BarrierAwaiter<ProcessingSequenceBarrier>;
+    }
+  {
+    return typename WaitStrategyT::template BarrierAwaiter<ProcessingSequenceBarrier>(
+      *this, *waitStrategy_, sequence);
+  }
+
   int64_t getCursor() const {
-    return dependentSequence_->get();
+    return dependentSequence_.get();
+  }
+
+  // C++-only: skipped sequences (MultiProducerSequencer claim chunks), for
+  // processors to step over.
+  bool hasSkippedSequences() const
+    requires requires(const SequencerT& sequencer) { sequencer.hasSkippedSequences(); }
+  {
+    return sequencer_->hasSkippedSequences();
+  }
+
+  bool isSkipped(int64_t sequence) const
+    requires requires(const SequencerT& sequencer) { sequencer.isSkipped(sequence); }
+  {
+    return sequencer_->isSkipped(sequence);
+  }
+
+  int64_t lastUnskippedSequence(int64_t lo, int64_t hi) const
+    requires requires(const SequencerT& sequencer) { sequencer.lastUnskippedSequence(lo, hi); }
+  {
+    return sequencer_->lastUnskippedSequence(lo, hi);
   }
 
   bool isAlerted() const {
@@ -67,19 +163,26 @@ public:
 
   void checkAlert() {
     if (isAlerted()) {
-      throw AlertException::INSTANCE();
+      util::raise(AlertException::INSTANCE());
     }
   }
 
 private:
   WaitStrategyT* waitStrategy_;
-  Sequence* dependentSequence_ = nullptr;
+  DependentSequenceT dependentSequence_;
   std::atomic<bool> alerted_;
   Sequence* cursorSequence_;
   SequencerT* sequencer_;
 
-  // Holds FixedSequenceGroup storage when needed.
-  std::unique_ptr<FixedSequenceGroup> fixedGroup_;
+  static DependentSequenceT makeDependentSequence(Sequence& cursorSequence,
+                                                  Sequence* const* dependentSequences,
+                                                  int dependentCount) {
+    if (dependentCount == 0) {
+      const std::array<Sequence*, 1> cursorOnly = {&cursorSequence};
+      return DependentSequenceT(cursorOnly.data(), 1);
+    }
+    return DependentSequenceT(dependentSequences, dependentCount);
+  }
 };
 
 }  // namespace disruptor
@@ -0,0 +1,188 @@
+#pragma once
+// C++-only: the run state, start/shutdown notifications and exception routing
+// of com.lmax.disruptor.BatchEventProcessor, pulled out so that the
+// processors which cannot be a BatchEventProcessor (columnar, byte, multi-lane
+// and work processors) share one copy instead of each keeping its own.
+
+#include "AlertException.h"
+#include "ExceptionHandler.h"
+#include "ExceptionHandlers.h"
+#include "TimeoutException.h"
+#include "WaitStrategy.h"
+#include "util/ExceptionSupport.h"
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <stdexcept>
+
+namespace disruptor {
+
+// A processor holds one as a member. Handler is anything with onStart() and
+// onShutdown() (and onTimeout() for notifyTimeout()); Barrier is anything with
+// alert() and clearAlert().
+template <typename T>
+class ProcessorLifecycle final {
+public:
+  // Java's run(): processEvents() runs between onStart and onShutdown, unless
+  // a halt() landed first. Calling run() on a running processor throws.
+  template <typename Handler, typename Barrier, typename ProcessEvents>
+  void run(Handler& handler, Barrier& barrier, ProcessEvents&& processEvents) {
+    if (!start(handler, barrier)) {
+      return;
+    }
+    DISRUPTOR_TRY {
+      if (running_.load(std::memory_order_acquire) == RUNNING) {
+        processEvents();
+      }
+    }
+    DISRUPTOR_CATCH_ALL {
+      end(handler);
+      DISRUPTOR_RETHROW;
+    }
+    end(handler);
+  }
+
+  // The first half of run(), for processors driven in slices: returns false,
+  // after onStart and onShutdown, if the processor was halted first.
+  template <typename Handler, typename Barrier>
+  bool start(Handler& handler, Barrier& barrier) {
+    int expected = IDLE;
+    if (!running_.compare_exchange_strong(expected, RUNNING, std::memory_order_acq_rel)) {
+      if (expected == RUNNING) {
+        util::raise(std::runtime_error("Thread is already running"));
+      }
+      notifyStart(handler);
+      notifyShutdown(handler);
+      return false;
+    }
+    barrier.clearAlert();
+    notifyStart(handler);
+    return true;
+  }
+
+  // The second half of run().
+  template <typename Handler>
+  void end(Handler& handler) {
+    notifyShutdown(handler);
+    running_.store(IDLE, std::memory_order_release);
+  }
+
+  template <typename Barrier>
+  void halt(Barrier& barrier) {
+    running_.store(HALTED, std::memory_order_release);
+    barrier.alert();
+  }
+
+  bool isRunning() const {
+    return running_.load(std::memory_order_acquire) != IDLE;
+  }
+
+  // True once halt() was called; an alert seen while this is false is spurious.
+  bool isHalted() const {
+    return running_.load(std::memory_order_acquire) != RUNNING;
+  }
+
+  void setExceptionHandler(ExceptionHandler<T>& exceptionHandler) {
+    exceptionHandler_ = &exceptionHandler;
+    if (exceptionHandler_ == nullptr) {
+      util::raise(std::invalid_argument("exceptionHandler must not be null"));
+    }
+  }
+
+  // Java: handler == null ? ExceptionHandlers.defaultHandler() : handler.
+  ExceptionHandler<T>& getExceptionHandler() const {
+    if (exceptionHandler_ == nullptr) {
+      return *ExceptionHandlers::defaultHandler<T>();
+    }
+    return *exceptionHandler_;
+  }
+
+  template <typename Handler>
+  void notifyStart(Handler& handler) {
+    invokeGuarded([&] { handler.onStart(); },
+                  [&](const std::exception& ex) {
+                    getExceptionHandler().handleOnStartException(ex);
+                  });
+  }
+
+  template <typename Handler>
+  void notifyShutdown(Handler& handler) {
+    invokeGuarded([&] { handler.onShutdown(); },
+                  [&](const std::exception& ex) {
+                    getExceptionHandler().handleOnShutdownException(ex);
+                  });
+  }
+
+  template <typename Handler, typename Barrier>
+  void notifyTimeout(Handler& handler, Barrier& barrier, int64_t availableSequence) {
+    invokeGuarded([&] { handler.onTimeout(availableSequence); },
+                  [&](const std::exception& ex) {
+                    handleEventException(ex, availableSequence, nullptr, barrier);
+                  });
+  }
+
+  // In Java an ExceptionHandler that throws only ends the consumer thread; in
+  // C++ an exception escaping a thread calls std::terminate, so the processor
+  // is halted instead. Returns false in that case.
+  template <typename Barrier>
+  bool handleEventException(const std::exception& ex,
+                            int64_t sequence,
+                            T* event,
+                            Barrier& barrier) {
+    DISRUPTOR_TRY {
+      getExceptionHandler().handleEventException(ex, sequence, event);
+      return true;
+    }
+    DISRUPTOR_CATCH_ALL {
+      halt(barrier);
+    }
+    return false;
+  }
+
+  // The barrier's tryWaitFor, so alerts and timeouts are plain branches in a
+  // processor's loop. Barriers without it report them by throwing.
+  template <typename Barrier>
+  static WaitResult waitFor(Barrier& barrier, int64_t sequence) {
+    if constexpr (requires { barrier.tryWaitFor(sequence); }) {
+      return barrier.tryWaitFor(sequence);
+    } else {
+#if DISRUPTOR_EXCEPTIONS
+      try {
+        return barrier.waitFor(sequence);
+      } catch (const TimeoutException&) {
+        return std::unexpected(ErrorCode::Timeout);
+      } catch (const AlertException&) {
+        return std::unexpected(ErrorCode::Alerted);
+      }
+#else
+      return barrier.waitFor(sequence);
+#endif
+    }
+  }
+
+  // Runs call; a std::exception it throws goes to onException.
+  template <typename Call, typename OnException>
+  static void invokeGuarded(Call&& call, OnException&& onException) {
+#if DISRUPTOR_EXCEPTIONS
+    try {
+      call();
+    } catch (const std::exception& ex) {
+      onException(ex);
+    }
+#else
+    (void)onException;
+    call();
+#endif
+  }
+
+private:
+  static constexpr int IDLE = 0;
+  static constexpr int HALTED = IDLE + 1;
+  static constexpr int RUNNING = HALTED + 1;
+
+  std::atomic<int> running_{IDLE};
+  ExceptionHandler<T>* exceptionHandler_{nullptr};
+};
+
+}  // namespace disruptor
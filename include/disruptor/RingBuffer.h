@@ -3,6 +3,7 @@
 // Source: reference/disruptor/src/main/java/com/lmax/disruptor/RingBuffer.java
 
 #include "AbstractSequencer.h"
+#include "CombiningMultiProducerSequencer.h"
 #include "Cursored.h"
 #include "DataProvider.h"
 #include "Error.h"
@@ -13,16 +14,26 @@
 #include "EventTranslatorThreeArg.h"
 #include "EventTranslatorTwoArg.h"
 #include "EventTranslatorVararg.h"
+#include "GatingTree.h"
 #include "MultiProducerSequencer.h"
+#include "RingBufferSize.h"
 #include "Sequence.h"
+#include "SequenceGroupView.h"
 #include "SingleProducerSequencer.h"
+#include "SpanClaim.h"
 #include "WaitStrategy.h"
+#include "util/ExceptionSupport.h"
+#include "util/MappedAllocator.h"
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <expected>
 #include <memory>
 #include <optional>
+#include <span>
+#include <type_traits>
 #include <stdexcept>
 #include <utility>
 #include <vector>
@@ -30,33 +41,57 @@
 namespace disruptor {
 
 // Template RingBuffer: parameterized by the concrete Sequencer type.
-template <typename E, typename SequencerT>
+//
+// BufferSize != kDynamicBufferSize fixes the ring size at compile time: slots
+// live in an inline std::array, elementAt() masks with a constant, and the
+// sequencer is always held by value (no unique_ptr constructor), so
+// sequencer() has no runtime branch. Pair it with a sequencer of the same
+// size, see FixedSingleProducerRingBuffer / FixedMultiProducerRingBuffer.
+// The object embeds the whole ring; allocate it with create() rather than on
+// the stack.
+template <typename E, typename SequencerT, int BufferSize = kDynamicBufferSize>
 class RingBuffer final : public DataProvider<E>, public Cursored {
+  static constexpr bool kFixedBufferSize = BufferSize != kDynamicBufferSize;
+
 public:
   static constexpr int64_t INITIAL_CURSOR_VALUE = Sequence::INITIAL_VALUE;
   using SequencerType = SequencerT;
 
-  // Factory methods
+  // Compile-time ring size: builds the sequencer in place from its
+  // constructor arguments (e.g. just the wait strategy).
+  template <typename... SequencerArgs>
+  static std::shared_ptr<RingBuffer> create(std::shared_ptr<EventFactory<E>> factory,
+                                            SequencerArgs&&... sequencerArgs)
+    requires kFixedBufferSize
+  {
+    return std::make_shared<RingBuffer>(std::move(factory), std::in_place,
+                                        std::forward<SequencerArgs>(sequencerArgs)...);
+  }
+
+  // Factory methods. memoryPolicy backs the slots and the sequencer's
+  // availability buffer (huge pages, pre-fault, mlock); see MappedAllocator.
   template <typename WaitStrategyT>
   static std::shared_ptr<RingBuffer<E, MultiProducerSequencer<WaitStrategyT>>>
   createMultiProducer(std::shared_ptr<EventFactory<E>> factory,
                       int bufferSize,
-                      WaitStrategyT& waitStrategy) {
+                      WaitStrategyT& waitStrategy,
+                      const util::MemoryPolicy& memoryPolicy = {}) {
     using Seq = MultiProducerSequencer<WaitStrategyT>;
-    auto seq = std::make_unique<Seq>(bufferSize, waitStrategy);
+    auto seq = std::make_unique<Seq>(bufferSize, waitStrategy, memoryPolicy);
     return std::shared_ptr<RingBuffer<E, Seq>>(
-      new RingBuffer<E, Seq>(std::move(factory), std::move(seq)));
+      new RingBuffer<E, Seq>(std::move(factory), std::move(seq), memoryPolicy));
   }
 
   template <typename WaitStrategyT>
   static std::shared_ptr<RingBuffer<E, SingleProducerSequencer<WaitStrategyT>>>
   createSingleProducer(std::shared_ptr<EventFactory<E>> factory,
                        int bufferSize,
-                       WaitStrategyT& waitStrategy) {
+                       WaitStrategyT& waitStrategy,
+                       const util::MemoryPolicy& memoryPolicy = {}) {
     using Seq = SingleProducerSequencer<WaitStrategyT>;
     auto seq = std::make_unique<Seq>(bufferSize, waitStrategy);
     return std::shared_ptr<RingBuffer<E, Seq>>(
-      new RingBuffer<E, Seq>(std::move(factory), std::move(seq)));
+      new RingBuffer<E, Seq>(std::move(factory), std::move(seq), memoryPolicy));
   }
 
   // DataProvider
@@ -64,6 +99,18 @@ public:
     return elementAt(sequence);
   }
 
+  // C++-only: slots are one array, so lo..hi is at most two runs.
+  std::pair<std::span<E>, std::span<E>> getSpans(int64_t lo, int64_t hi) override {
+    const int n = static_cast<int>(hi - lo + 1);
+    const int index = static_cast<int>(lo) & bufferSize_.mask();
+    const int firstSize = (std::min)(n, bufferSize_.size() - index);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    E* slots = entries_.data() + BUFFER_PAD;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return {std::span<E>(slots + index, static_cast<std::size_t>(firstSize)),
+            std::span<E>(slots, static_cast<std::size_t>(n - firstSize))};
+  }
+
   // Cursored
   int64_t getCursor() const override {
     return sequencer().getCursor();
@@ -88,6 +135,11 @@ public:
     addGatingSequences(arr.data(), 1);
   }
 
+  // C++-only: see AbstractSequencer::addGatingSequences(GatingTree&).
+  void addGatingSequences(GatingTree& tree) {
+    sequencer().addGatingSequences(tree);
+  }
+
   int64_t getMinimumGatingSequence() {
     return sequencer().getMinimumSequence();
   }
@@ -105,6 +157,12 @@ public:
     return newBarrier(nullptr, 0);
   }
 
+  // Compile-time dependency count; see SequenceGroupView.
+  template <std::size_t N>
+  auto newBarrier(const std::array<Sequence*, N>& sequencesToTrack) {
+    return sequencer().newBarrier(sequencesToTrack);
+  }
+
   std::shared_ptr<EventPoller<E, SequencerT>> newPoller(Sequence* const* gatingSequences,
                                                         int count) {
     auto pollerSequence = std::make_shared<Sequence>();
@@ -117,8 +175,19 @@ public:
     return newPoller(nullptr, 0);
   }
 
+  // Compile-time gating count: the poller reads a SequenceGroupView<N> (the
+  // cursor when N == 0) instead of a FixedSequenceGroup.
+  template <std::size_t N>
+  auto newPoller(const std::array<Sequence*, N>& gatingSequences) {
+    using PollerT = EventPoller<E, SequencerT, SequenceGroupView<(N == 0 ? 1 : N)>>;
+    auto pollerSequence = std::make_shared<Sequence>();
+    return PollerT::newInstance(*this, sequencer(), std::move(pollerSequence),
+                                sequencer().cursorSequence(), gatingSequences.data(),
+                                static_cast<int>(N));
+  }
+
   int getBufferSize() const {
-    return bufferSize_;
+    return bufferSize_.size();
   }
 
   bool hasAvailableCapacity(int requiredCapacity) {
@@ -145,6 +214,20 @@ public:
     return sequencer().tryNext(n);
   }
 
+  // C++-only: co_await nextAsync(n) from a ScheduledTask claims like next(n),
+  // suspending the coroutine while the ring is full instead of spinning.
+  // Needs a wait strategy with coroutine support (AsyncWaitStrategy).
+  auto nextAsync(int n = 1)
+    requires requires(SequencerT& sequencer) {
+      typename std::remove_reference_t<
+        decltype(sequencer.getWaitStrategy())>::template CapacityAwaiter<RingBuffer>;
+    }
+  {
+    using WaitStrategyT = std::remove_reference_t<decltype(sequencer().getWaitStrategy())>;
+    return typename WaitStrategyT::template CapacityAwaiter<RingBuffer>(
+      *this, sequencer().getWaitStrategy(), n);
+  }
+
   void publish(int64_t sequence) {
     sequencer().publish(sequence);
   }
@@ -153,6 +236,33 @@ public:
     sequencer().publish(lo, hi);
   }
 
+  // C++-only: per-producer claim chunks; see ClaimChunk.
+  auto newClaimChunk(int chunkSize)
+    requires requires(SequencerT& s) { s.newClaimChunk(chunkSize); }
+  {
+    return sequencer().newClaimChunk(chunkSize);
+  }
+
+  // C++-only: claims n sequences (as next(n)) and returns their slots as at
+  // most two contiguous spans, so a producer can copy or decode a batch
+  // straight into the ring. Publish with publish(claim); see SpanClaim.
+  SpanClaim<E> claimSpan(int n) {
+    return spanClaimFor(next(n), n);
+  }
+
+  // As claimSpan, failing like tryNext(n) instead of waiting for capacity.
+  std::expected<SpanClaim<E>, Error> tryClaimSpan(int n) {
+    std::expected<int64_t, Error> hi = tryNext(n);
+    if (!hi) [[unlikely]] {
+      return std::unexpected(hi.error());
+    }
+    return spanClaimFor(*hi, n);
+  }
+
+  void publish(const SpanClaim<E>& claim) {
+    publish(claim.lo, claim.hi);
+  }
+
   // EventSink-like helpers
   void publishEvent(EventTranslator<E>& translator) {
     int64_t sequence = next();
@@ -242,16 +352,17 @@ public:
     }
     int64_t finalSequence = next(batchSize);
     int64_t initialSequence = finalSequence - (batchSize - 1);
-    try {
+    DISRUPTOR_TRY {
       for (int i = 0; i < batchSize; ++i) {
         auto* tr = translators[static_cast<size_t>(batchStartsAt + i)];
         if (tr) {
           tr->translateTo(get(initialSequence + i), initialSequence + i);
         }
       }
-    } catch (...) {
+    }
+    DISRUPTOR_CATCH_ALL {
       publish(initialSequence, finalSequence);
-      throw;
+      DISRUPTOR_RETHROW;
     }
     publish(initialSequence, finalSequence);
   }
@@ -283,41 +394,47 @@ public:
   RingBuffer(std::shared_ptr<EventFactory<E>> eventFactory,
              std::in_place_t,
              SequencerArgs&&... sequencerArgs)
+    : RingBuffer(std::move(eventFactory),
+                 util::MemoryPolicy{},
+                 std::in_place,
+                 std::forward<SequencerArgs>(sequencerArgs)...) {}
+
+  // As above, with the slots allocated according to memoryPolicy (ignored
+  // for a compile-time size, whose slots are inline). Pass the policy on in
+  // sequencerArgs too for a MultiProducerSequencer's availability buffer.
+  template <typename... SequencerArgs>
+  RingBuffer(std::shared_ptr<EventFactory<E>> eventFactory,
+             const util::MemoryPolicy& memoryPolicy,
+             std::in_place_t,
+             SequencerArgs&&... sequencerArgs)
     : sequencerValue_(std::in_place, std::forward<SequencerArgs>(sequencerArgs)...)
     , sequencerOwner_(nullptr)
-    , usingValue_(true) {
-    bufferSize_ = sequencerValue_->getBufferSize();
-    indexMask_ = bufferSize_ - 1;
-    entries_.resize(static_cast<size_t>(bufferSize_ + 2 * BUFFER_PAD));
-    if (!eventFactory) {
-      throw std::invalid_argument("eventFactory must not be null");
+    , usingValue_(true)
+    , bufferSize_(sequencerValue_->getBufferSize())
+    , entries_(makeEntries(memoryPolicy)) {
+    if constexpr (!kFixedBufferSize) {
+      entries_.resize(static_cast<size_t>(bufferSize_.size() + 2 * BUFFER_PAD));
     }
-    if (bufferSize_ < 1) {
-      throw std::invalid_argument("bufferSize must not be less than 1");
-    }
-    if ((bufferSize_ & (bufferSize_ - 1)) != 0) {
-      throw std::invalid_argument("bufferSize must be a power of 2");
+    if (!eventFactory) {
+      util::raise(std::invalid_argument("eventFactory must not be null"));
     }
     fill(*eventFactory);
   }
 
   // Legacy constructor accepting unique_ptr (for backward compatibility with
   // tests).
-  RingBuffer(std::shared_ptr<EventFactory<E>> eventFactory, std::unique_ptr<SequencerT> sequencer)
-    : indexMask_(sequencer->getBufferSize() - 1)
-    , entries_(static_cast<size_t>(sequencer->getBufferSize() + 2 * BUFFER_PAD))
-    , bufferSize_(sequencer->getBufferSize())
-    , sequencerValue_(std::nullopt)
+  RingBuffer(std::shared_ptr<EventFactory<E>> eventFactory,
+             std::unique_ptr<SequencerT> sequencer,
+             const util::MemoryPolicy& memoryPolicy = {})
+    requires(!kFixedBufferSize)
+    : sequencerValue_(std::nullopt)
     , sequencerOwner_(std::move(sequencer))
-    , usingValue_(false) {
+    , usingValue_(false)
+    , bufferSize_(sequencerOwner_->getBufferSize())
+    , entries_(static_cast<size_t>(bufferSize_.size() + 2 * BUFFER_PAD),
+               util::MappedAllocator<E>(memoryPolicy)) {
     if (!eventFactory) {
-      throw std::invalid_argument("eventFactory must not be null");
-    }
-    if (bufferSize_ < 1) {
-      throw std::invalid_argument("bufferSize must not be less than 1");
-    }
-    if ((bufferSize_ & (bufferSize_ - 1)) != 0) {
-      throw std::invalid_argument("bufferSize must be a power of 2");
+      util::raise(std::invalid_argument("eventFactory must not be null"));
     }
     fill(*eventFactory);
   }
@@ -330,31 +447,56 @@ private:
   static constexpr int BUFFER_PAD = 32;
 
   void fill(EventFactory<E>& eventFactory) {
-    for (int i = 0; i < bufferSize_; ++i) {
+    for (int i = 0; i < bufferSize_.size(); ++i) {
       entries_[static_cast<size_t>(BUFFER_PAD + i)] = eventFactory.newInstance();
     }
   }
 
   E& elementAt(int64_t sequence) {
     return entries_[static_cast<size_t>(
-      BUFFER_PAD + (static_cast<int>(sequence) & static_cast<int>(indexMask_)))];
+      BUFFER_PAD + (static_cast<int>(sequence) & bufferSize_.mask()))];
+  }
+
+  SpanClaim<E> spanClaimFor(int64_t hi, int n) {
+    const int64_t lo = hi - (n - 1);
+    auto [first, second] = getSpans(lo, hi);
+    return SpanClaim<E>{lo, hi, first, second};
   }
 
-  int64_t indexMask_;
-  std::vector<E> entries_;
-  int bufferSize_;
   // For value-based constructor: sequencer_ is stored by value in optional.
   // For unique_ptr-based constructor: sequencerOwner_ holds the sequencer.
   std::optional<SequencerT> sequencerValue_;
   std::unique_ptr<SequencerT> sequencerOwner_;
   bool usingValue_;
+  [[no_unique_address]] RingBufferSize<BufferSize> bufferSize_;
+  using Entries =
+    std::conditional_t<kFixedBufferSize,
+                       std::array<E, static_cast<size_t>(BufferSize + 2 * BUFFER_PAD)>,
+                       std::vector<E, util::MappedAllocator<E>>>;
+  Entries entries_;
+
+  static Entries makeEntries([[maybe_unused]] const util::MemoryPolicy& memoryPolicy) {
+    if constexpr (kFixedBufferSize) {
+      return Entries();
+    } else {
+      return Entries(util::MappedAllocator<E>(memoryPolicy));
+    }
+  }
 
   SequencerT& sequencer() {
-    return usingValue_ ? *sequencerValue_ : *sequencerOwner_;
+    if constexpr (kFixedBufferSize) {
+      return *sequencerValue_;
+    } else {
+      return usingValue_ ? *sequencerValue_ : *sequencerOwner_;
+    }
   }
 
   const SequencerT& sequencer() const {
-    return usingValue_ ? *sequencerValue_ : *sequencerOwner_;
+    if constexpr (kFixedBufferSize) {
+      return *sequencerValue_;
+    } else {
+      return usingValue_ ? *sequencerValue_ : *sequencerOwner_;
+    }
   }
 };
 
@@ -365,4 +507,20 @@ using SingleProducerRingBuffer = RingBuffer<E, SingleProducerSequencer<WaitStrat
 template <typename E, typename WaitStrategyT>
 using MultiProducerRingBuffer = RingBuffer<E, MultiProducerSequencer<WaitStrategyT>>;
 
+template <typename E, typename WaitStrategyT>
+using CombiningMultiProducerRingBuffer =
+  RingBuffer<E, CombiningMultiProducerSequencer<WaitStrategyT>>;
+
+// Compile-time ring size; construct with create(eventFactory, waitStrategy).
+template <typename E, typename WaitStrategyT, int BufferSize>
+using FixedSingleProducerRingBuffer =
+  RingBuffer<E, SingleProducerSequencer<WaitStrategyT, BufferSize>, BufferSize>;
+
+template <typename E,
+          typename WaitStrategyT,
+          int BufferSize,
+          template <int> class AvailableBufferT = AvailableBuffer>
+using FixedMultiProducerRingBuffer =
+  RingBuffer<E, MultiProducerSequencer<WaitStrategyT, AvailableBufferT, BufferSize>, BufferSize>;
+
 }  // namespace disruptor
@@ -0,0 +1,80 @@
+#pragma once
+// C++-only: ring size/mask/shift either fixed at compile time or validated at
+// construction (no Java equivalent; Java always uses runtime fields).
+
+#include "util/ExceptionSupport.h"
+
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+
+namespace disruptor {
+
+// Template argument selecting a ring size chosen at runtime, i.e. the Java
+// behaviour. Any other value is the compile-time ring size.
+inline constexpr int kDynamicBufferSize = 0;
+
+// Compile-time ring size: size(), mask() and shift() are constants, so index
+// and wrap-point arithmetic folds into immediates. Empty; hold it with
+// [[no_unique_address]].
+template <int BufferSize>
+class RingBufferSize {
+  static_assert(BufferSize > 0, "bufferSize must not be less than 1");
+  static_assert((BufferSize & (BufferSize - 1)) == 0, "bufferSize must be a power of 2");
+
+public:
+  // Accepts the runtime size so fixed and dynamic sequencers share constructors.
+  explicit RingBufferSize(int bufferSize) {
+    if (bufferSize != BufferSize) {
+      util::raise(std::invalid_argument("bufferSize does not match the compile-time ring size"));
+    }
+  }
+
+  static constexpr int size() noexcept {
+    return BufferSize;
+  }
+
+  static constexpr int mask() noexcept {
+    return BufferSize - 1;
+  }
+
+  static constexpr int shift() noexcept {
+    return std::countr_zero(static_cast<uint32_t>(BufferSize));
+  }
+};
+
+template <>
+class RingBufferSize<kDynamicBufferSize> {
+public:
+  explicit RingBufferSize(int bufferSize)
+    : size_(bufferSize)
+    , mask_(bufferSize - 1)
+    , shift_(0) {
+    if (bufferSize < 1) {
+      util::raise(std::invalid_argument("bufferSize must not be less than 1"));
+    }
+    if ((bufferSize & (bufferSize - 1)) != 0) {
+      util::raise(std::invalid_argument("bufferSize must be a power of 2"));
+    }
+    shift_ = std::countr_zero(static_cast<uint32_t>(bufferSize));
+  }
+
+  int size() const noexcept {
+    return size_;
+  }
+
+  int mask() const noexcept {
+    return mask_;
+  }
+
+  int shift() const noexcept {
+    return shift_;
+  }
+
+private:
+  int size_;
+  int mask_;
+  int shift_;
+};
+
+}  // namespace disruptor
@@ -22,8 +22,15 @@ namespace disruptor {
 //
 // This satisfies Intel's Rule 18: separate synchronization variables by 128
 // bytes. See docs/CACHE_LINE_PADDING.md for details.
-
-class alignas(128) Sequence {
+//
+// Java lets FixedSequenceGroup/SequenceGroup extend Sequence and override
+// get(). Here Sequence is final and non-virtual so every get()/set() on the
+// hot path is a direct, inlinable call and no vtable pointer lives in the
+// padded block. Groups are separate "sequence-like" types (anything with
+// `int64_t get() const`): FixedSequenceGroup, SequenceGroupView<N> and
+// SequenceGroup. Barriers, pollers and wait strategies are templated on them.
+
+class alignas(128) Sequence final {
 public:
   static constexpr int64_t INITIAL_VALUE = -1;
 
@@ -31,14 +38,12 @@ public:
 
   explicit Sequence(int64_t initial) noexcept : value_(initial) {}
 
-  virtual ~Sequence() = default;
-
   // Java: long value = this.value; VarHandle.acquireFence(); return value;
   // Java reads a plain field (not volatile), then executes acquireFence.
   // This allows reading a "slightly stale" value, which may reduce memory
   // barrier overhead. C++: Match Java semantics - relaxed load + acquire fence.
   // TSAN annotation: inform TSAN about acquire semantics on sequence address.
-  virtual int64_t get() const {
+  int64_t get() const noexcept {
 #if DISRUPTOR_TSAN_ENABLED
     // TSan doesn't support atomic_thread_fence, use acquire load instead
     // TSan automatically detects acquire semantics from memory_order_acquire
@@ -54,7 +59,7 @@ public:
   // Java executes release fence first, then writes to plain field (not
   // volatile). C++: Match Java semantics - release fence + relaxed store.
   // TSAN annotation: inform TSAN about release semantics on sequence address.
-  virtual void set(int64_t v) {
+  void set(int64_t v) {
 #if DISRUPTOR_TSAN_ENABLED
     // TSan doesn't support atomic_thread_fence, use release store instead
     // TSan automatically detects release semantics from memory_order_release
@@ -70,7 +75,7 @@ public:
   // C++: Matches Java semantics - release fence + relaxed store + full fence.
   // This pattern may provide better performance than a single seq_cst store.
   // TSAN annotation: inform TSAN about release semantics on sequence address.
-  virtual void setVolatile(int64_t v) {
+  void setVolatile(int64_t v) {
 #if DISRUPTOR_TSAN_ENABLED
     // TSan doesn't support atomic_thread_fence, use seq_cst store instead
     // TSan automatically detects seq_cst semantics from memory_order_seq_cst
@@ -82,7 +87,7 @@ public:
 #endif
   }
 
-  virtual bool compareAndSet(int64_t expected, int64_t desired) {
+  bool compareAndSet(int64_t expected, int64_t desired) {
     return value_.compare_exchange_weak(expected, desired, std::memory_order_acq_rel,
                                         std::memory_order_acquire);
   }
@@ -91,7 +96,7 @@ public:
   // C++: Match Java semantics - relaxed fetch_add + acquire-release fence.
   // This pattern matches get()/set() style and may provide better performance
   // than memory_order_acq_rel on the atomic operation itself.
-  virtual int64_t incrementAndGet() {
+  int64_t incrementAndGet() {
 #if DISRUPTOR_TSAN_ENABLED
     // TSan doesn't support atomic_thread_fence, use acq_rel on operation instead
     // TSan automatically detects acq_rel semantics from memory_order_acq_rel
@@ -103,7 +108,7 @@ public:
 #endif
   }
 
-  virtual int64_t addAndGet(int64_t increment) {
+  int64_t addAndGet(int64_t increment) {
 #if DISRUPTOR_TSAN_ENABLED
     // TSan doesn't support atomic_thread_fence, use acq_rel on operation instead
     // TSan automatically detects acq_rel semantics from memory_order_acq_rel
@@ -115,7 +120,7 @@ public:
 #endif
   }
 
-  virtual int64_t getAndAdd(int64_t increment) {
+  int64_t getAndAdd(int64_t increment) {
 #if DISRUPTOR_TSAN_ENABLED
     // TSan doesn't support atomic_thread_fence, use acq_rel on operation instead
     // TSan automatically detects acq_rel semantics from memory_order_acq_rel
@@ -127,8 +132,33 @@ public:
 #endif
   }
 
+  // C++-only: makes this Sequence stand in for leader. Everything that reads a
+  // dependency (gating registration, sequence groups, barriers, the DSL's
+  // backlog check) reads leader through gatingTarget(), while writes such as
+  // gating registration's still land here. Java gets the same effect by
+  // overriding get() (NoOpEventProcessor's SequencerFollowingSequence).
+  void follow(Sequence& leader) noexcept {
+    leader_ = &leader;
+  }
+
+  // The Sequence to read in place of this one.
+  Sequence* gatingTarget() noexcept {
+    return leader_ != nullptr ? leader_ : this;
+  }
+
+  const Sequence* gatingTarget() const noexcept {
+    return leader_ != nullptr ? leader_ : this;
+  }
+
 private:
+  // SequenceArray checks that value_ is at offset 0.
+  friend class SequenceArray;
+
   std::atomic<int64_t> value_;
+  // Shares value_'s cache line, but is only written by follow() before the
+  // Sequence is published to other threads, so it never invalidates the line.
+  // Placed after value_ so sizeof is unchanged (see SequenceArray).
+  Sequence* leader_{nullptr};
 };
 
 }  // namespace disruptor
@@ -0,0 +1,149 @@
+#pragma once
+// C++-only: contiguous storage for many consumer Sequences (no Java
+// equivalent; Java sequences are separate heap objects).
+
+#include "Sequence.h"
+#include "util/ExceptionSupport.h"
+#include "util/MappedAllocator.h"
+#include "util/TsanAnnotations.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#if (defined(__AVX512F__) || defined(__AVX2__)) && !DISRUPTOR_TSAN_ENABLED
+#  include <immintrin.h>
+#  define DISRUPTOR_SEQUENCE_ARRAY_GATHER 1
+#else
+#  define DISRUPTOR_SEQUENCE_ARRAY_GATHER 0
+#endif
+
+namespace disruptor {
+
+// A fixed number of Sequences in one allocation. Each is still a padded
+// 128-byte Sequence, so neighbours never share a prefetch pair, but the
+// values sit at a fixed stride from one base address: the minimum over them
+// is a strided scan (AVX-512/AVX2 gathers when compiled for them) instead of
+// a pointer chase through separately allocated objects.
+//
+// The DSL puts the processors of one handleEventsWith/then group here, so the
+// ring's gating path (GatingSequenceRegistry) and the next stage's barrier
+// (FixedSequenceGroup) see them as one contiguous run.
+class SequenceArray final {
+public:
+  explicit SequenceArray(int capacity, const util::MemoryPolicy& memoryPolicy = {})
+    : allocator_(memoryPolicy), capacity_(capacity) {
+    if (capacity < 1) {
+      util::raise(std::invalid_argument("SequenceArray capacity must be greater than 0"));
+    }
+    sequences_ = allocator_.allocate(static_cast<std::size_t>(capacity));
+    std::uninitialized_default_construct_n(sequences_, capacity);
+  }
+
+  ~SequenceArray() {
+    std::destroy_n(sequences_, capacity_);
+    allocator_.deallocate(sequences_, static_cast<std::size_t>(capacity_));
+  }
+
+  SequenceArray(const SequenceArray&) = delete;
+  SequenceArray& operator=(const SequenceArray&) = delete;
+
+  int capacity() const {
+    return capacity_;
+  }
+
+  Sequence& operator[](int index) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return sequences_[index];
+  }
+
+  const Sequence& operator[](int index) const {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return sequences_[index];
+  }
+
+  Sequence* data() {
+    return sequences_;
+  }
+
+  bool contains(const Sequence& sequence) const {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto address = reinterpret_cast<std::uintptr_t>(&sequence);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto base = reinterpret_cast<std::uintptr_t>(sequences_);
+    return address >= base
+           && address - base < static_cast<std::size_t>(capacity_) * sizeof(Sequence);
+  }
+
+  int64_t minimum(int64_t defaultMin = (std::numeric_limits<int64_t>::max)()) const {
+    return minimumOf(sequences_, capacity_, defaultMin);
+  }
+
+  // Minimum of defaultMin and count adjacent Sequences starting at first;
+  // works on any contiguous run, not only a SequenceArray's. Same ordering as
+  // count Sequence::get() calls: plain loads, then one acquire fence.
+  static int64_t minimumOf(const Sequence* first, int count, int64_t defaultMin) noexcept {
+    int64_t minimum = defaultMin;
+    int i = 0;
+#if DISRUPTOR_SEQUENCE_ARRAY_GATHER
+    // The value is the first member of a standard-layout Sequence (asserted
+    // below), so the values are int64s kStride apart from first. Aligned
+    // 8-byte gather elements are single-copy atomic on x86.
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto* values = reinterpret_cast<const long long*>(first);
+#  if defined(__AVX512F__)
+    const __m512i index = _mm512_setr_epi64(0, kStride, 2 * kStride, 3 * kStride, 4 * kStride,
+                                            5 * kStride, 6 * kStride, 7 * kStride);
+    __m512i lanes = _mm512_set1_epi64(minimum);
+    // Masked forms and a scalar reduction: the unmasked intrinsics start from
+    // an undefined vector, which GCC 12 reports as uninitialized.
+    for (; i + 8 <= count; i += 8) {
+      const __m512i gathered =
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        _mm512_mask_i64gather_epi64(lanes, 0xFF, index, values + i * kStride, 8);
+      lanes = _mm512_mask_min_epi64(lanes, 0xFF, lanes, gathered);
+    }
+    alignas(64) std::array<long long, 8> reduced{};
+    _mm512_store_si512(reduced.data(), lanes);
+    minimum = *(std::min_element)(reduced.begin(), reduced.end());
+#  else
+    const __m256i index = _mm256_setr_epi64x(0, kStride, 2 * kStride, 3 * kStride);
+    const __m256i allLanes = _mm256_set1_epi64x(-1);
+    __m256i lanes = _mm256_set1_epi64x(minimum);
+    for (; i + 4 <= count; i += 4) {
+      const __m256i gathered =
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        _mm256_mask_i64gather_epi64(lanes, values + i * kStride, index, allLanes, 8);
+      lanes = _mm256_blendv_epi8(lanes, gathered, _mm256_cmpgt_epi64(lanes, gathered));
+    }
+    alignas(32) std::array<long long, 4> reduced{};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    _mm256_store_si256(reinterpret_cast<__m256i*>(reduced.data()), lanes);
+    minimum = (std::min)((std::min)(reduced[0], reduced[1]), (std::min)(reduced[2], reduced[3]));
+#  endif
+    std::atomic_thread_fence(std::memory_order_acquire);
+#endif
+    for (; i < count; ++i) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      minimum = (std::min)(minimum, first[i].get());
+    }
+    return minimum;
+  }
+
+private:
+  static_assert(std::is_standard_layout_v<Sequence> && sizeof(Sequence) % sizeof(int64_t) == 0);
+  static_assert(offsetof(Sequence, value_) == 0, "minimumOf reads the value at each Sequence");
+  static constexpr int kStride = static_cast<int>(sizeof(Sequence) / sizeof(int64_t));
+
+  util::MappedAllocator<Sequence> allocator_;
+  int capacity_;
+  Sequence* sequences_;
+};
+
+}  // namespace disruptor
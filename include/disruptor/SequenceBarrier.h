@@ -9,6 +9,8 @@
 //   void alert();
 //   void clearAlert();
 //   void checkAlert();
+//   WaitResult tryWaitFor(int64_t sequence);  // C++-only, optional; see
+//                                              // ProcessingSequenceBarrier
 //
 // This file no longer defines a base class. It is kept as documentation and a
 // compatibility placeholder while the codebase is migrated.
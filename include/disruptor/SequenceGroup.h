@@ -16,11 +16,14 @@
 
 namespace disruptor {
 
-class SequenceGroup final : public Sequence, public Cursored {
+// Java: SequenceGroup extends Sequence so it can be passed anywhere a Sequence
+// is expected. C++: Sequence is final, so the group is a standalone
+// sequence-like type (get()/set()) usable as a barrier/poller dependency.
+class SequenceGroup final : public Cursored {
 public:
-  SequenceGroup() : Sequence(-1), sequences_(std::make_shared<std::vector<Sequence*>>()) {}
+  SequenceGroup() : sequences_(std::make_shared<std::vector<Sequence*>>()) {}
 
-  int64_t get() const noexcept override {
+  int64_t get() const noexcept {
     auto snap = sequences_.load(std::memory_order_acquire);
     if (!snap) {
       // Guard against Windows macro max()
@@ -33,7 +36,7 @@ public:
     return get();
   }
 
-  void set(int64_t value) noexcept override {
+  void set(int64_t value) noexcept {
     auto snap = sequences_.load(std::memory_order_acquire);
     if (!snap)
       return;
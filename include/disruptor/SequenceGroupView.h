@@ -0,0 +1,63 @@
+#pragma once
+// C++-only counterpart of FixedSequenceGroup for a compile-time number of
+// sequences (no Java equivalent).
+
+#include "Sequence.h"
+#include "util/ExceptionSupport.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace disruptor {
+
+// Read-only minimum over exactly N sequences. The pointers live inline in the
+// owning barrier/poller and the min loop is fully unrolled, so a barrier with a
+// single dependency reads that Sequence directly.
+template <std::size_t N>
+class SequenceGroupView final {
+  static_assert(N > 0, "SequenceGroupView requires at least one sequence");
+
+public:
+  // A follower (Sequence::follow) is stored as the Sequence it follows.
+  explicit SequenceGroupView(const std::array<Sequence*, N>& sequences) {
+    for (std::size_t i = 0; i < N; ++i) {
+      sequences_[i] = sequences[i]->gatingTarget();
+    }
+  }
+
+  // Same shape as FixedSequenceGroup so barriers/pollers can build either.
+  SequenceGroupView(Sequence* const* sequences, int count) {
+    if (count != static_cast<int>(N)) {
+      util::raise(std::invalid_argument("SequenceGroupView: count does not match N"));
+    }
+    for (std::size_t i = 0; i < N; ++i) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      sequences_[i] = sequences[i]->gatingTarget();
+    }
+  }
+
+  int64_t get() const noexcept {
+    if constexpr (N == 1) {
+      return sequences_[0]->get();
+    } else {
+      int64_t minimum = sequences_[0]->get();
+      for (std::size_t i = 1; i < N; ++i) {
+        // Guard against Windows macro min()
+        minimum = (std::min)(minimum, sequences_[i]->get());
+      }
+      return minimum;
+    }
+  }
+
+  static constexpr int size() {
+    return static_cast<int>(N);
+  }
+
+private:
+  std::array<Sequence*, N> sequences_{};
+};
+
+}  // namespace disruptor
@@ -3,9 +3,11 @@
 // Source: reference/disruptor/src/main/java/com/lmax/disruptor/SequenceGroups.java
 
 #include "Cursored.h"
+#include "GatingSequenceRegistry.h"
 #include "Sequence.h"
 
 #include <atomic>
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -95,6 +97,45 @@ public:
 
     return numToRemove != 0;
   }
+
+  // Sequencer overloads: same cursor handshake, but the sequences go into a
+  // GatingSequenceRegistry instead of a new snapshot vector.
+  template <typename Holder>
+  static void addSequences(Holder& holder,
+                           GatingSequenceRegistry& registry,
+                           const Cursored& cursor,
+                           Sequence* const* sequencesToAdd,
+                           int count) {
+    (void)holder;
+    // A follower (Sequence::follow) is written like any other sequence, but
+    // the registry reads the sequence it follows.
+    std::vector<Sequence*> targets(static_cast<std::size_t>(count));
+    for (int i = 0; i < count; ++i) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      Sequence* sequence = sequencesToAdd[i];
+      targets[static_cast<std::size_t>(i)] =
+        sequence != nullptr ? sequence->gatingTarget() : nullptr;
+    }
+    setAll(sequencesToAdd, count, cursor.getCursor());
+    registry.add(targets.data(), count);
+    setAll(sequencesToAdd, count, cursor.getCursor());
+  }
+
+  template <typename Holder>
+  static bool removeSequence(Holder& holder, GatingSequenceRegistry& registry, Sequence& sequence) {
+    (void)holder;
+    return registry.remove(*sequence.gatingTarget());
+  }
+
+private:
+  static void setAll(Sequence* const* sequences, int count, int64_t value) {
+    for (int i = 0; i < count; ++i) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      if (auto* seq = sequences[i]) {
+        seq->set(value);
+      }
+    }
+  }
 };
 
 }  // namespace disruptor
@@ -0,0 +1,56 @@
+#pragma once
+// C++-only: BatchEventProcessor counterpart for SharedMemoryRingBuffer (no
+// Java equivalent).
+
+#include "BatchEventProcessor.h"
+#include "DataProvider.h"
+#include "EventHandlerBase.h"
+#include "ExceptionHandler.h"
+#include "ExceptionHandlingEventProcessor.h"
+#include "Sequence.h"
+
+#include <limits>
+
+namespace disruptor {
+
+// A BatchEventProcessor that records progress in a Sequence owned by the
+// caller: for a shared memory ring that is the consumer slot's sequence in
+// the segment, which producers in other processes gate on. The slot keeps
+// the position addConsumer() gave it, so the consumer starts after the
+// events published before it joined.
+template <typename T, typename BarrierT>
+class SharedMemoryEventProcessor final : public ExceptionHandlingEventProcessor<T> {
+public:
+  SharedMemoryEventProcessor(DataProvider<T>& dataProvider,
+                             BarrierT& sequenceBarrier,
+                             EventHandlerBase<T>& eventHandler,
+                             Sequence& sequence,
+                             int maxBatchSize = std::numeric_limits<int>::max())
+    : processor_(dataProvider, sequenceBarrier, eventHandler, maxBatchSize, nullptr, sequence,
+                 ExternalSequence::Keep) {}
+
+  Sequence& getSequence() override {
+    return processor_.getSequence();
+  }
+
+  void halt() override {
+    processor_.halt();
+  }
+
+  bool isRunning() override {
+    return processor_.isRunning();
+  }
+
+  void setExceptionHandler(ExceptionHandler<T>& exceptionHandler) override {
+    processor_.setExceptionHandler(exceptionHandler);
+  }
+
+  void run() override {
+    processor_.run();
+  }
+
+private:
+  BatchEventProcessor<T, BarrierT> processor_;
+};
+
+}  // namespace disruptor
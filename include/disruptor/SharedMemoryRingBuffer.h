@@ -0,0 +1,332 @@
+#pragma once
+// C++-only: multi-producer ring buffer whose cursor, consumer sequences,
+// availability buffer and slots all live in one shared memory segment, so
+// producers and consumers can run in different processes (no Java
+// equivalent).
+
+#include "AvailableBuffer.h"
+#include "DataProvider.h"
+#include "Error.h"
+#include "MultiProducerSequencer.h"
+#include "ProcessingSequenceBarrier.h"
+#include "RingBufferSize.h"
+#include "Sequence.h"
+#include "Sequencer.h"
+#include "util/ExceptionSupport.h"
+#include "util/SharedMemorySegment.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace disruptor {
+
+namespace detail {
+
+// Fixed header at offset 0 of the segment. The arrays follow at the offsets
+// computed by SharedRingLayout; every field any process writes after creation
+// is a lock-free (hence address-free) atomic.
+struct SharedRingHeader {
+  static constexpr uint64_t kMagic = 0x5254505552534944ULL;  // "DISRUPTR"
+  static constexpr uint32_t kVersion = 2;
+
+  uint64_t magic;
+  uint32_t version;
+  uint32_t eventSize;
+  uint32_t eventAlignment;
+  int32_t bufferSize;
+  int32_t maxConsumers;
+  // Set last by the creating process; attach() refuses a segment without it.
+  std::atomic<uint32_t> ready;
+  Sequence cursor;
+};
+
+struct SharedRingLayout {
+  std::size_t consumersOffset;
+  std::size_t consumerStatesOffset;
+  std::size_t availableOffset;
+  std::size_t slotsOffset;
+  std::size_t totalBytes;
+
+  static SharedRingLayout of(int bufferSize,
+                             int maxConsumers,
+                             std::size_t eventSize,
+                             std::size_t eventAlignment) {
+    constexpr std::size_t kAlign = 128;
+    const auto align = [](std::size_t offset, std::size_t alignment) {
+      return (offset + alignment - 1) / alignment * alignment;
+    };
+    SharedRingLayout layout{};
+    layout.consumersOffset = align(sizeof(SharedRingHeader), kAlign);
+    layout.consumerStatesOffset =
+      align(layout.consumersOffset + sizeof(Sequence) * static_cast<std::size_t>(maxConsumers),
+            kAlign);
+    layout.availableOffset = align(layout.consumerStatesOffset
+                                     + sizeof(std::atomic<uint32_t>)
+                                         * static_cast<std::size_t>(maxConsumers),
+                                   kAlign);
+    layout.slotsOffset = align(layout.availableOffset
+                                 + sizeof(std::atomic<int>) * static_cast<std::size_t>(bufferSize),
+                               (std::max)(kAlign, eventAlignment));
+    layout.totalBytes = layout.slotsOffset + eventSize * static_cast<std::size_t>(bufferSize);
+    return layout;
+  }
+};
+
+}  // namespace detail
+
+// Every process maps the same segment and builds its own
+// SharedMemoryRingBuffer over it (create() once, attach() elsewhere). Each
+// one claims and publishes through a MultiProducerSequencer whose cursor and
+// availability buffer are the segment's, so any number of processes may
+// publish. Consumers take one of maxConsumers slots with addConsumer(). Every
+// process's sequencer gates on all the slots; a free slot holds INT64_MAX and
+// so gates nothing. A consumer process that dies without removeConsumer()
+// stalls the producers once they wrap, as a stuck consumer thread would.
+//
+// Events are copied in place and read by other processes, so they must be
+// trivially copyable. Wait strategies that park on a condition variable are
+// rejected: their signal does not cross the process boundary.
+template <typename E, typename WaitStrategyT>
+class SharedMemoryRingBuffer final : public DataProvider<E> {
+  static_assert(std::is_trivially_copyable_v<E>,
+                "SharedMemoryRingBuffer events must be trivially copyable");
+  static_assert(!WaitStrategyT::kIsBlockingStrategy,
+                "blocking wait strategies signal through process-local condition variables");
+  static_assert(std::atomic<int64_t>::is_always_lock_free && std::atomic<int>::is_always_lock_free
+                  && std::atomic<uint32_t>::is_always_lock_free,
+                "atomics in shared memory must be lock-free");
+
+public:
+  using SequencerT =
+    MultiProducerSequencer<WaitStrategyT, AvailableBuffer, kDynamicBufferSize, true>;
+  using BarrierT = ProcessingSequenceBarrier<SequencerT, WaitStrategyT>;
+
+  static std::size_t requiredBytes(int bufferSize, int maxConsumers) {
+    return detail::SharedRingLayout::of(bufferSize, maxConsumers, sizeof(E), alignof(E))
+      .totalBytes;
+  }
+
+  // Initialises a fresh segment of at least requiredBytes(bufferSize,
+  // maxConsumers) bytes.
+  static std::shared_ptr<SharedMemoryRingBuffer> create(util::SharedMemorySegment segment,
+                                                        int bufferSize,
+                                                        int maxConsumers,
+                                                        WaitStrategyT& waitStrategy) {
+    const RingBufferSize<kDynamicBufferSize> size(bufferSize);
+    if (maxConsumers < 1) {
+      util::raise(std::invalid_argument("maxConsumers must not be less than 1"));
+    }
+    const auto layout =
+      detail::SharedRingLayout::of(bufferSize, maxConsumers, sizeof(E), alignof(E));
+    if (segment.size() < layout.totalBytes) {
+      util::raise(std::invalid_argument("shared memory segment is smaller than requiredBytes()"));
+    }
+
+    auto* base = static_cast<std::byte*>(segment.data());
+    auto* header = new (base) detail::SharedRingHeader{detail::SharedRingHeader::kMagic,
+                                                       detail::SharedRingHeader::kVersion,
+                                                       static_cast<uint32_t>(sizeof(E)),
+                                                       static_cast<uint32_t>(alignof(E)),
+                                                       bufferSize,
+                                                       maxConsumers,
+                                                       {0},
+                                                       Sequence(Sequencer::INITIAL_CURSOR_VALUE)};
+    for (int i = 0; i < maxConsumers; ++i) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      new (base + layout.consumersOffset + sizeof(Sequence) * static_cast<std::size_t>(i))
+        Sequence(kFreeSlotSequence);
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      new (base + layout.consumerStatesOffset
+           + sizeof(std::atomic<uint32_t>) * static_cast<std::size_t>(i))
+        std::atomic<uint32_t>(kConsumerFree);
+    }
+    for (int i = 0; i < bufferSize; ++i) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      new (base + layout.availableOffset + sizeof(std::atomic<int>) * static_cast<std::size_t>(i))
+        std::atomic<int>(-1);
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      new (base + layout.slotsOffset + sizeof(E) * static_cast<std::size_t>(i)) E();
+    }
+    header->ready.store(1, std::memory_order_release);
+
+    return std::shared_ptr<SharedMemoryRingBuffer>(
+      new SharedMemoryRingBuffer(std::move(segment), size, layout, waitStrategy));
+  }
+
+  // Maps a segment initialised by create() in this or another process.
+  // Throws std::runtime_error if it was not created for this event type.
+  static std::shared_ptr<SharedMemoryRingBuffer> attach(util::SharedMemorySegment segment,
+                                                        WaitStrategyT& waitStrategy) {
+    if (segment.size() < sizeof(detail::SharedRingHeader)) {
+      util::raise(std::runtime_error("shared memory segment too small for a ring header"));
+    }
+    const auto* header = static_cast<const detail::SharedRingHeader*>(segment.data());
+    if (header->magic != detail::SharedRingHeader::kMagic
+        || header->version != detail::SharedRingHeader::kVersion
+        || header->ready.load(std::memory_order_acquire) != 1) {
+      util::raise(std::runtime_error("shared memory segment does not hold an initialised ring"));
+    }
+    if (header->eventSize != sizeof(E) || header->eventAlignment != alignof(E)) {
+      util::raise(std::runtime_error("shared memory ring was created for a different event type"));
+    }
+    const auto layout =
+      detail::SharedRingLayout::of(header->bufferSize, header->maxConsumers, sizeof(E), alignof(E));
+    if (segment.size() < layout.totalBytes) {
+      util::raise(std::runtime_error("shared memory segment is truncated"));
+    }
+    const RingBufferSize<kDynamicBufferSize> size(header->bufferSize);
+    return std::shared_ptr<SharedMemoryRingBuffer>(
+      new SharedMemoryRingBuffer(std::move(segment), size, layout, waitStrategy));
+  }
+
+  E& get(int64_t sequence) override {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return slots_[static_cast<int>(sequence) & bufferSize_.mask()];
+  }
+
+  int64_t next() {
+    return sequencer_.next();
+  }
+
+  int64_t next(int n) {
+    return sequencer_.next(n);
+  }
+
+  std::expected<int64_t, Error> tryNext() {
+    return sequencer_.tryNext();
+  }
+
+  std::expected<int64_t, Error> tryNext(int n) {
+    return sequencer_.tryNext(n);
+  }
+
+  void publish(int64_t sequence) {
+    sequencer_.publish(sequence);
+  }
+
+  void publish(int64_t lo, int64_t hi) {
+    sequencer_.publish(lo, hi);
+  }
+
+  bool isAvailable(int64_t sequence) {
+    return sequencer_.isAvailable(sequence);
+  }
+
+  int64_t getHighestPublishedSequence(int64_t lowerBound, int64_t availableSequence) {
+    return sequencer_.getHighestPublishedSequence(lowerBound, availableSequence);
+  }
+
+  // Claims a free consumer slot and returns its index. Its sequence is set to
+  // the cursor, so the consumer sees events published after it was added.
+  // Throws std::runtime_error if all maxConsumers slots are taken.
+  int addConsumer() {
+    for (int slot = 0; slot < maxConsumers_; ++slot) {
+      uint32_t expected = kConsumerFree;
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      if (consumerStates_[slot].compare_exchange_strong(expected, kConsumerActive)) {
+        // Moving the slot off INT64_MAX is what adds the consumer to every
+        // process's gating sequences.
+        Sequence& sequence = consumerSequence(slot);
+        sequence.setVolatile(getCursor());
+        // Java's SequenceGroups.addSequences does the same: a producer that
+        // read the slot before the store above may have moved on.
+        sequence.set(getCursor());
+        return slot;
+      }
+    }
+    util::raise(std::runtime_error("all shared memory ring consumer slots are in use"));
+  }
+
+  void removeConsumer(int slot) {
+    consumerSequence(slot).set(kFreeSlotSequence);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    consumerStates_[slot].store(kConsumerFree, std::memory_order_release);
+  }
+
+  Sequence& consumerSequence(int slot) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return consumers_[slot];
+  }
+
+  // Barrier over the shared cursor, or over other consumers' sequences
+  // (consumerSequence() of their slots) for a dependent stage.
+  std::shared_ptr<BarrierT> newBarrier(Sequence* const* sequencesToTrack, int count) {
+    return sequencer_.newBarrier(sequencesToTrack, count);
+  }
+
+  int64_t getCursor() const {
+    return sequencer_.getCursor();
+  }
+
+  int getBufferSize() const {
+    return bufferSize_.size();
+  }
+
+  int getMaxConsumers() const {
+    return maxConsumers_;
+  }
+
+  int64_t getMinimumSequence() {
+    return sequencer_.getMinimumSequence();
+  }
+
+  int64_t remainingCapacity() {
+    return sequencer_.remainingCapacity();
+  }
+
+  const util::SharedMemorySegment& segment() const {
+    return segment_;
+  }
+
+private:
+  static constexpr uint32_t kConsumerFree = 0;
+  static constexpr uint32_t kConsumerActive = 1;
+  static constexpr int64_t kFreeSlotSequence = (std::numeric_limits<int64_t>::max)();
+
+  util::SharedMemorySegment segment_;
+  RingBufferSize<kDynamicBufferSize> bufferSize_;
+  detail::SharedRingHeader* header_;
+  int maxConsumers_;
+  Sequence* consumers_;
+  std::atomic<uint32_t>* consumerStates_;
+  E* slots_;
+  SequencerT sequencer_;
+
+  SharedMemoryRingBuffer(util::SharedMemorySegment segment,
+                         RingBufferSize<kDynamicBufferSize> bufferSize,
+                         const detail::SharedRingLayout& layout,
+                         WaitStrategyT& waitStrategy)
+    : segment_(std::move(segment))
+    , bufferSize_(bufferSize)
+    , header_(at<detail::SharedRingHeader>(0))
+    , maxConsumers_(header_->maxConsumers)
+    , consumers_(at<Sequence>(layout.consumersOffset))
+    , consumerStates_(at<std::atomic<uint32_t>>(layout.consumerStatesOffset))
+    , slots_(at<E>(layout.slotsOffset))
+    , sequencer_(bufferSize.size(), waitStrategy, header_->cursor,
+                 at<std::atomic<int>>(layout.availableOffset)) {
+    std::vector<Sequence*> slots(static_cast<std::size_t>(maxConsumers_));
+    for (int slot = 0; slot < maxConsumers_; ++slot) {
+      slots[static_cast<std::size_t>(slot)] = &consumerSequence(slot);
+    }
+    sequencer_.addGatingSequencesInPlace(slots.data(), maxConsumers_);
+  }
+
+  template <typename U>
+  U* at(std::size_t offset) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return std::launder(reinterpret_cast<U*>(static_cast<std::byte*>(segment_.data()) + offset));
+  }
+};
+
+}  // namespace disruptor
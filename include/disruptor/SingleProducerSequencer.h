@@ -7,7 +7,10 @@
 #include "Error.h"
 #include "ProcessingSequenceBarrier.h"
 #include "Sequence.h"
+#include "SequenceGroupView.h"
 #include "WaitStrategy.h"
+#include "util/ExceptionSupport.h"
+#include "util/MappedAllocator.h"
 #include "util/ThreadHints.h"
 #include "util/Util.h"
 
@@ -45,32 +48,53 @@ inline std::atomic<uint64_t>& sp_wrap_wait_loops() {
 namespace detail {
 
 // 112 bytes of padding (same shape as Java p10..p77).
-template <typename WaitStrategyT>
-struct SpSequencerPad : public AbstractSequencer<WaitStrategyT> {
+template <typename WaitStrategyT, int BufferSize>
+struct SpSequencerPad : public AbstractSequencer<WaitStrategyT, BufferSize> {
   std::array<std::byte, 112> p1{};
 
   SpSequencerPad(int bufferSize, WaitStrategyT& waitStrategy)
-    : AbstractSequencer<WaitStrategyT>(bufferSize, waitStrategy) {}
+    : AbstractSequencer<WaitStrategyT, BufferSize>(bufferSize, waitStrategy) {}
 };
 
-template <typename WaitStrategyT>
-struct SpSequencerFields : public SpSequencerPad<WaitStrategyT> {
+template <typename WaitStrategyT, int BufferSize>
+struct SpSequencerFields : public SpSequencerPad<WaitStrategyT, BufferSize> {
   int64_t nextValue_;
   int64_t cachedValue_;
 
   SpSequencerFields(int bufferSize, WaitStrategyT& waitStrategy)
-    : SpSequencerPad<WaitStrategyT>(bufferSize, waitStrategy)
+    : SpSequencerPad<WaitStrategyT, BufferSize>(bufferSize, waitStrategy)
     , nextValue_(Sequence::INITIAL_VALUE)
     , cachedValue_(Sequence::INITIAL_VALUE) {}
 };
 
 }  // namespace detail
 
-template <typename WaitStrategyT>
-class SingleProducerSequencer final : public detail::SpSequencerFields<WaitStrategyT> {
+// BufferSize != kDynamicBufferSize: ring size fixed at compile time, so the
+// wrap-point and capacity arithmetic below works on constants.
+template <typename WaitStrategyT, int BufferSize = kDynamicBufferSize>
+class SingleProducerSequencer final : public detail::SpSequencerFields<WaitStrategyT, BufferSize> {
+  using Base = AbstractSequencer<WaitStrategyT, BufferSize>;
+
 public:
   SingleProducerSequencer(int bufferSize, WaitStrategyT& waitStrategy)
-    : detail::SpSequencerFields<WaitStrategyT>(bufferSize, waitStrategy) {}
+    : detail::SpSequencerFields<WaitStrategyT, BufferSize>(bufferSize, waitStrategy) {}
+
+  // Same signature as MultiProducerSequencer so callers can pass a policy to
+  // either; a single producer keeps no per-slot metadata to place.
+  SingleProducerSequencer(int bufferSize,
+                          WaitStrategyT& waitStrategy,
+                          const util::MemoryPolicy& /*memoryPolicy*/)
+    : SingleProducerSequencer(bufferSize, waitStrategy) {}
+
+  explicit SingleProducerSequencer(WaitStrategyT& waitStrategy)
+    requires(BufferSize != kDynamicBufferSize)
+    : SingleProducerSequencer(BufferSize, waitStrategy) {}
+
+#ifndef NDEBUG
+  ~SingleProducerSequencer() {
+    forgetProducerThread();
+  }
+#endif
 
   bool hasAvailableCapacity(int requiredCapacity) {
     return hasAvailableCapacity(requiredCapacity, false);
@@ -86,16 +110,16 @@ public:
     // SPSC performance and Java only performs this when assertions are enabled.
 #ifndef NDEBUG
     if (!sameThread()) {
-      throw std::runtime_error("Accessed by two threads - use ProducerType.MULTI!");
+      util::raise(std::runtime_error("Accessed by two threads - use ProducerType.MULTI!"));
     }
 #endif
-    if (n < 1 || n > this->bufferSize_) {
-      throw std::invalid_argument("n must be > 0 and < bufferSize");
+    if (n < 1 || n > this->bufferSize_.size()) {
+      util::raise(std::invalid_argument("n must be > 0 and < bufferSize"));
     }
 
     int64_t nextValue = this->nextValue_;
     int64_t nextSequence = nextValue + n;
-    int64_t wrapPoint = nextSequence - this->bufferSize_;
+    int64_t wrapPoint = nextSequence - this->bufferSize_.size();
     int64_t cachedGatingSequence = this->cachedValue_;
 
     if (wrapPoint > cachedGatingSequence || cachedGatingSequence > nextValue) {
@@ -160,45 +184,37 @@ public:
 
   bool isAvailable(int64_t sequence) {
     const int64_t currentSequence = this->cursor_.get();
-    return sequence <= currentSequence && sequence > currentSequence - this->bufferSize_;
+    return sequence <= currentSequence && sequence > currentSequence - this->bufferSize_.size();
   }
 
   int64_t getHighestPublishedSequence(int64_t /*lowerBound*/, int64_t availableSequence) {
     return availableSequence;
   }
 
-  std::shared_ptr<ProcessingSequenceBarrier<SingleProducerSequencer<WaitStrategyT>, WaitStrategyT>>
+  std::shared_ptr<ProcessingSequenceBarrier<SingleProducerSequencer, WaitStrategyT>>
   newBarrier(Sequence* const* sequencesToTrack, int count) {
-    return std::make_shared<
-      ProcessingSequenceBarrier<SingleProducerSequencer<WaitStrategyT>, WaitStrategyT>>(
+    return std::make_shared<ProcessingSequenceBarrier<SingleProducerSequencer, WaitStrategyT>>(
       *this, *this->waitStrategy_, this->cursor_, sequencesToTrack, count);
   }
 
-  // Override to invalidate cache when gating sequences change
-  void addGatingSequences(Sequence* const* gatingSequences, int count) {
-    AbstractSequencer<WaitStrategyT>::addGatingSequences(gatingSequences, count);
-    gatingSequencesCache_ = nullptr;  // Invalidate cache
-  }
-
-  bool removeGatingSequence(Sequence& sequence) {
-    bool result = AbstractSequencer<WaitStrategyT>::removeGatingSequence(sequence);
-    gatingSequencesCache_ = nullptr;  // Invalidate cache
-    return result;
+  // Dependency count known at compile time: the barrier gates on a
+  // SequenceGroupView<N> (the cursor when N == 0) instead of a FixedSequenceGroup.
+  template <std::size_t N>
+  auto newBarrier(const std::array<Sequence*, N>& sequencesToTrack) {
+    using BarrierT = ProcessingSequenceBarrier<SingleProducerSequencer,
+                                               WaitStrategyT,
+                                               SequenceGroupView<(N == 0 ? 1 : N)>>;
+    return std::make_shared<BarrierT>(*this, *this->waitStrategy_, this->cursor_,
+                                      sequencesToTrack.data(), static_cast<int>(N));
   }
 
 private:
-  // Optimization: Cache raw pointer to gatingSequences vector to avoid atomic
-  // shared_ptr operations. This is safe because gatingSequences_ is only
-  // updated during add/remove (not on hot path), and we refresh the cache when
-  // it's null.
-  mutable const std::vector<Sequence*>* gatingSequencesCache_ = nullptr;
-
   // Trailing padding to mirror Java's extra padding in the concrete class.
-  std::array<std::byte, 112 - sizeof(const std::vector<Sequence*>*)> p2_{};
+  std::array<std::byte, 112> p2_{};
 
   bool hasAvailableCapacity(int requiredCapacity, bool doStore) {
     int64_t nextValue = this->nextValue_;
-    int64_t wrapPoint = (nextValue + requiredCapacity) - this->bufferSize_;
+    int64_t wrapPoint = (nextValue + requiredCapacity) - this->bufferSize_.size();
     int64_t cachedGatingSequence = this->cachedValue_;
 
     if (wrapPoint > cachedGatingSequence || cachedGatingSequence > nextValue) {
@@ -218,22 +234,7 @@ private:
   }
 
   int64_t minimumSequence(int64_t defaultMin) {
-    // Optimization: Cache raw pointer to avoid shared_ptr atomic operations on
-    // hot path. gatingSequences_ is updated rarely (only when consumers are
-    // added/removed), but accessed frequently in next(). Use cached pointer for
-    // fast path.
-    auto* cached = gatingSequencesCache_;
-    if (!cached) {
-      // Fallback: reload if cache is null (initialization or after
-      // modifications)
-      auto snap = this->gatingSequences_.load(std::memory_order_acquire);
-      if (!snap) {
-        return defaultMin;
-      }
-      gatingSequencesCache_ = snap.get();
-      return disruptor::util::Util::getMinimumSequence(*snap, defaultMin);
-    }
-    return disruptor::util::Util::getMinimumSequence(*cached, defaultMin);
+    return this->gatingSequences_.minimumSequence(defaultMin);
   }
 
   // Java-only debug assertion; best-effort in C++.
@@ -241,18 +242,36 @@ private:
 #ifdef NDEBUG
     return true;
 #else
-    static std::mutex m;
-    static std::unordered_map<const SingleProducerSequencer*, std::thread::id> producers;
-    std::lock_guard<std::mutex> lock(m);
+    auto& registry = producerThreads();
+    std::lock_guard<std::mutex> lock(registry.mutex);
     const auto tid = std::this_thread::get_id();
-    auto it = producers.find(this);
-    if (it == producers.end()) {
-      producers.emplace(this, tid);
+    auto it = registry.producers.find(this);
+    if (it == registry.producers.end()) {
+      registry.producers.emplace(this, tid);
       return true;
     }
     return it->second == tid;
 #endif
   }
+
+#ifndef NDEBUG
+  struct ProducerThreads {
+    std::mutex mutex;
+    std::unordered_map<const SingleProducerSequencer*, std::thread::id> producers;
+  };
+
+  static ProducerThreads& producerThreads() {
+    static ProducerThreads registry;
+    return registry;
+  }
+
+  // A later sequencer at the same address must not inherit this one's thread.
+  void forgetProducerThread() {
+    auto& registry = producerThreads();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.producers.erase(this);
+  }
+#endif
 };
 
 }  // namespace disruptor
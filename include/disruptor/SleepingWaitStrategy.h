@@ -23,16 +23,27 @@ public:
   SleepingWaitStrategy(int retries, int64_t sleepTimeNs)
     : retries_(retries), sleepTimeNs_(sleepTimeNs) {}
 
-  template <typename Barrier>
+  template <typename DependentSequenceT, typename Barrier>
   int64_t waitFor(int64_t sequence,
-                  const Sequence& /*cursor*/,
-                  const Sequence& dependentSequence,
+                  const Sequence& cursor,
+                  const DependentSequenceT& dependentSequence,
                   Barrier& barrier) {
+    return waitResultOrThrow(tryWaitFor(sequence, cursor, dependentSequence, barrier));
+  }
+
+  template <typename DependentSequenceT, typename Barrier>
+  WaitResult tryWaitFor(int64_t sequence,
+                        const Sequence& /*cursor*/,
+                        const DependentSequenceT& dependentSequence,
+                        Barrier& barrier) {
     int64_t availableSequence;
     int counter = retries_;
 
     while ((availableSequence = dependentSequence.get()) < sequence) {
-      counter = applyWaitMethod(barrier, counter);
+      if (barrier.isAlerted()) {
+        return std::unexpected(ErrorCode::Alerted);
+      }
+      counter = applyWaitMethod(counter);
     }
     return availableSequence;
   }
@@ -47,10 +58,7 @@ private:
   int retries_;
   int64_t sleepTimeNs_;
 
-  template <typename Barrier>
-  int applyWaitMethod(Barrier& barrier, int counter) {
-    barrier.checkAlert();
-
+  int applyWaitMethod(int counter) {
     if (counter > SPIN_THRESHOLD) {
       return counter - 1;
     } else if (counter > 0) {
@@ -0,0 +1,33 @@
+#pragma once
+// C++-only: a claimed run of ring slots as contiguous memory (no Java
+// equivalent). Returned by RingBuffer::claimSpan / tryClaimSpan.
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace disruptor {
+
+// Sequences lo..hi, claimed but not yet published. The slots are first
+// followed by second: first runs from lo's slot towards the end of the ring
+// and second, empty unless the claim wraps, continues from the ring's first
+// slot. Producers fill them in place (memcpy, bulk decode) and hand the claim
+// back to RingBuffer::publish, which publishes lo..hi in one call.
+template <typename E>
+struct SpanClaim {
+  int64_t lo;
+  int64_t hi;
+  std::span<E> first;
+  std::span<E> second;
+
+  std::size_t size() const {
+    return first.size() + second.size();
+  }
+
+  // The slot of sequence lo + offset.
+  E& operator[](std::size_t offset) const {
+    return offset < first.size() ? first[offset] : second[offset - first.size()];
+  }
+};
+
+}  // namespace disruptor
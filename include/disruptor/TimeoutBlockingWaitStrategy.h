@@ -4,7 +4,6 @@
 // reference/disruptor/src/main/java/com/lmax/disruptor/TimeoutBlockingWaitStrategy.java
 
 #include "Sequence.h"
-#include "TimeoutException.h"
 #include "WaitStrategy.h"
 #include "util/Util.h"
 
@@ -22,27 +21,39 @@ public:
   // nanoseconds value.
   explicit TimeoutBlockingWaitStrategy(int64_t timeoutInNanos) : timeoutInNanos_(timeoutInNanos) {}
 
-  template <typename Barrier>
+  template <typename DependentSequenceT, typename Barrier>
   int64_t waitFor(int64_t sequence,
                   const Sequence& cursorSequence,
-                  const Sequence& dependentSequence,
+                  const DependentSequenceT& dependentSequence,
                   Barrier& barrier) {
+    return waitResultOrThrow(tryWaitFor(sequence, cursorSequence, dependentSequence, barrier));
+  }
+
+  template <typename DependentSequenceT, typename Barrier>
+  WaitResult tryWaitFor(int64_t sequence,
+                        const Sequence& cursorSequence,
+                        const DependentSequenceT& dependentSequence,
+                        Barrier& barrier) {
     int64_t timeoutNanos = timeoutInNanos_;
 
     int64_t availableSequence;
     if (cursorSequence.get() < sequence) {
       std::unique_lock<std::mutex> lock(mutex_);
       while (cursorSequence.get() < sequence) {
-        barrier.checkAlert();
+        if (barrier.isAlerted()) {
+          return std::unexpected(ErrorCode::Alerted);
+        }
         timeoutNanos = disruptor::util::Util::awaitNanos(cv_, lock, timeoutNanos);
         if (timeoutNanos <= 0) {
-          throw TimeoutException::INSTANCE();
+          return std::unexpected(ErrorCode::Timeout);
         }
       }
     }
 
     while ((availableSequence = dependentSequence.get()) < sequence) {
-      barrier.checkAlert();
+      if (barrier.isAlerted()) {
+        return std::unexpected(ErrorCode::Alerted);
+      }
     }
 
     return availableSequence;
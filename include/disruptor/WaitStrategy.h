@@ -9,10 +9,28 @@
 // Required API for a WaitStrategy type `WS`:
 //   int64_t WS::waitFor(int64_t sequence,
 //                       const Sequence& cursor,
-//                       const Sequence& dependentSequence,
+//                       const DependentSequenceT& dependentSequence,
 //                       Barrier& barrier);
 //   void WS::signalAllWhenBlocking();
 //   static constexpr bool WS::kIsBlockingStrategy;
+//
+// `DependentSequenceT` is any sequence-like type with `int64_t get() const`
+// (Sequence, FixedSequenceGroup, SequenceGroupView<N>, SequenceGroup), so the
+// dependent read in the spin loop is a direct call rather than a virtual one.
+//
+// C++-only, optional: WaitResult WS::tryWaitFor(same arguments), which
+// reports an alerted barrier (barrier.isAlerted()) and a timeout as
+// ErrorCode::Alerted and ErrorCode::Timeout instead of throwing. The
+// strategies here implement waitFor on top of it; ProcessingSequenceBarrier
+// uses it when present.
+
+#include "AlertException.h"
+#include "Error.h"
+#include "TimeoutException.h"
+#include "util/ExceptionSupport.h"
+
+#include <cstdint>
+#include <expected>
 
 namespace disruptor {
 
@@ -22,4 +40,18 @@ class SequenceBarrier;  // Legacy type; will be removed after full template
 
 // This file intentionally does NOT define a base class.
 
+// C++-only: the available sequence, or ErrorCode::Alerted / ErrorCode::Timeout.
+using WaitResult = std::expected<int64_t, ErrorCode>;
+
+// Java's waitFor contract for a WaitResult: AlertException or TimeoutException.
+inline int64_t waitResultOrThrow(const WaitResult& result) {
+  if (result) [[likely]] {
+    return *result;
+  }
+  if (result.error() == ErrorCode::Timeout) {
+    util::raise(TimeoutException::INSTANCE());
+  }
+  util::raise(AlertException::INSTANCE());
+}
+
 }  // namespace disruptor
@@ -0,0 +1,24 @@
+#pragma once
+// Port of com.lmax.disruptor.WorkHandler from Disruptor 3.x (removed in 4.0,
+// so there is no source under reference/).
+
+#include "EventHandlerIdentity.h"
+
+namespace disruptor {
+
+// Handler for a WorkerPool: each event goes to exactly one of the pool's
+// handlers, so onEvent gets neither a sequence nor an end-of-batch flag.
+template <typename T>
+class WorkHandler : public EventHandlerIdentity {
+public:
+  ~WorkHandler() override = default;
+
+  virtual void onEvent(T& event) = 0;
+
+  // Java: WorkHandler implementations could also implement LifecycleAware.
+  virtual void onStart() {}
+
+  virtual void onShutdown() {}
+};
+
+}  // namespace disruptor
@@ -0,0 +1,164 @@
+#pragma once
+// Port of com.lmax.disruptor.WorkProcessor from Disruptor 3.x (removed in 4.0,
+// so there is no source under reference/).
+
+#include "AlertException.h"
+#include "DataProvider.h"
+#include "EventProcessor.h"
+#include "ExceptionHandler.h"
+#include "ProcessorLifecycle.h"
+#include "Sequence.h"
+#include "Sequencer.h"
+#include "TimeoutException.h"
+#include "WorkHandler.h"
+#include "util/ExceptionSupport.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+
+namespace disruptor {
+
+// One worker of a WorkerPool. The workers share workSequence, the highest
+// sequence any of them has claimed, and take the next sequences from it with a
+// compareAndSet, so each event is handled by exactly one worker.
+//
+// C++-only: claimBatchSize lets a worker take up to that many sequences per
+// compareAndSet, but never more than the barrier last reported available, so
+// a worker does not sit on claimed sequences another one could handle. 1 is
+// Java's behaviour.
+//
+// getSequence() stays at the work sequence value seen at the last claim until
+// the worker claims again, which keeps the producer behind every sequence the
+// worker still has to handle. Sequences a claim chunk published as skipped
+// (see ClaimChunk) count as handled without reaching the WorkHandler.
+template <typename T, typename BarrierT>
+class WorkProcessor final : public EventProcessor {
+public:
+  WorkProcessor(DataProvider<T>& dataProvider,
+                BarrierT& sequenceBarrier,
+                WorkHandler<T>& workHandler,
+                ExceptionHandler<T>& exceptionHandler,
+                Sequence& workSequence,
+                int claimBatchSize = 1)
+    : dataProvider_(&dataProvider)
+    , sequenceBarrier_(&sequenceBarrier)
+    , workHandler_(&workHandler)
+    , workSequence_(&workSequence)
+    , claimBatchSize_(claimBatchSize) {
+    if (claimBatchSize < 1) {
+      util::raise(std::invalid_argument("claimBatchSize must be greater than 0"));
+    }
+    lifecycle_.setExceptionHandler(exceptionHandler);
+  }
+
+  Sequence& getSequence() override {
+    return sequence_;
+  }
+
+  void halt() override {
+    lifecycle_.halt(*sequenceBarrier_);
+  }
+
+  bool isRunning() override {
+    return lifecycle_.isRunning();
+  }
+
+  // Same lifecycle as BatchEventProcessor: a halt() that lands before run()
+  // makes run() return straight away instead of losing the halt.
+  void run() override {
+    lifecycle_.run(*workHandler_, *sequenceBarrier_, [this] { processEvents(); });
+  }
+
+private:
+  ProcessorLifecycle<T> lifecycle_;
+  Sequence sequence_{SEQUENCER_INITIAL_CURSOR_VALUE};
+  DataProvider<T>* dataProvider_;
+  BarrierT* sequenceBarrier_;
+  WorkHandler<T>* workHandler_;
+  Sequence* workSequence_;
+  int claimBatchSize_;
+
+  void processEvents() {
+    bool processedSequence = true;
+    int64_t cachedAvailableSequence = (std::numeric_limits<int64_t>::min)();
+    int64_t nextSequence = sequence_.get();
+    int64_t lastClaimedSequence = nextSequence;
+    bool skipping = false;
+    T* event = nullptr;
+
+    while (true) {
+      try {
+        // If the previous sequence was handled, move to the next one of the
+        // current claim, or claim more from the work sequence.
+        if (processedSequence) {
+          processedSequence = false;
+          if (nextSequence < lastClaimedSequence) {
+            ++nextSequence;
+          } else {
+            int64_t current;
+            do {
+              current = workSequence_->get();
+              sequence_.set(current);
+              lastClaimedSequence = current + claimSize(current, cachedAvailableSequence);
+            } while (!workSequence_->compareAndSet(current, lastClaimedSequence));
+            nextSequence = current + 1;
+          }
+        }
+
+        if (cachedAvailableSequence >= nextSequence) {
+          if (!isSkipped(nextSequence, skipping)) {
+            event = &dataProvider_->get(nextSequence);
+            workHandler_->onEvent(*event);
+          }
+          processedSequence = true;
+        } else {
+          cachedAvailableSequence = sequenceBarrier_->waitFor(nextSequence);
+          skipping = maySkip();
+        }
+      } catch (const TimeoutException&) {
+        // Java: only reported to handlers implementing TimeoutHandler.
+      } catch (const AlertException&) {
+        if (lifecycle_.isHalted()) {
+          break;
+        }
+      } catch (const std::exception& ex) {
+        // Java: handle, then mark this sequence processed and move on.
+        lifecycle_.handleEventException(ex, nextSequence, event, *sequenceBarrier_);
+        processedSequence = true;
+      }
+    }
+  }
+
+  int64_t claimSize(int64_t current, int64_t cachedAvailableSequence) const {
+    if (claimBatchSize_ == 1 || cachedAvailableSequence <= current) {
+      return 1;
+    }
+    return (std::min)(static_cast<int64_t>(claimBatchSize_), cachedAvailableSequence - current);
+  }
+
+  static constexpr bool kMaySkip =
+    requires(BarrierT& barrier, int64_t sequence) { barrier.isSkipped(sequence); };
+
+  // isSkipped() is only consulted once the sequencer has handed out a claim
+  // chunk, as in BatchEventProcessor.
+  bool maySkip() const {
+    if constexpr (kMaySkip) {
+      return sequenceBarrier_->hasSkippedSequences();
+    } else {
+      return false;
+    }
+  }
+
+  bool isSkipped(int64_t sequence, bool skipping) const {
+    if constexpr (kMaySkip) {
+      return skipping && sequenceBarrier_->isSkipped(sequence);
+    } else {
+      return false;
+    }
+  }
+};
+
+}  // namespace disruptor
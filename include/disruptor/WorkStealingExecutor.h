@@ -0,0 +1,159 @@
+#pragma once
+// C++-only: a small work-stealing thread pool for resumable consumer tasks
+// (no Java equivalent).
+//
+// Each worker has its own queue. submit() from a worker thread queues to that
+// worker, and from any other thread it queues round-robin. A worker runs its
+// own tasks in FIFO order, so a task that resubmits itself goes behind the
+// others. When its queue is empty, a worker steals the newest task of
+// another worker. When every queue is empty it sleeps on a condition
+// variable until the next submit(). A task is queued at most once at a time;
+// BatchEventProcessorTask resubmits itself after a full slice, and from
+// AsyncWaitStrategy's signal after an idle one.
+
+#include "util/ExceptionSupport.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace disruptor {
+
+class ExecutorTask {
+public:
+  // Runs one slice on a worker thread; must not block.
+  virtual void runSlice() = 0;
+
+protected:
+  ~ExecutorTask() = default;
+};
+
+class WorkStealingExecutor final {
+public:
+  explicit WorkStealingExecutor(int workerCount) {
+    if (workerCount < 1) {
+      util::raise(std::invalid_argument("workerCount must be greater than 0"));
+    }
+    for (int i = 0; i < workerCount; ++i) {
+      workers_.push_back(std::make_unique<Worker>());
+    }
+    for (int i = 0; i < workerCount; ++i) {
+      threads_.emplace_back([this, i] { runWorker(static_cast<std::size_t>(i)); });
+    }
+  }
+
+  WorkStealingExecutor(const WorkStealingExecutor&) = delete;
+  WorkStealingExecutor& operator=(const WorkStealingExecutor&) = delete;
+
+  // Stops the workers; tasks still queued are not run. Halt the consumers
+  // first.
+  ~WorkStealingExecutor() {
+    {
+      std::lock_guard<std::mutex> lock(idleMutex_);
+      stopping_ = true;
+    }
+    idleCv_.notify_all();
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  int getWorkerCount() const {
+    return static_cast<int>(workers_.size());
+  }
+
+  void submit(ExecutorTask& task) {
+    const std::size_t index =
+      currentExecutor_ == this
+        ? currentWorker_
+        : nextWorker_.fetch_add(1, std::memory_order_relaxed) % workers_.size();
+    {
+      Worker& worker = *workers_[index];
+      std::lock_guard<std::mutex> lock(worker.mutex);
+      worker.tasks.push_back(&task);
+    }
+
+    // Pairs with runWorker: either it sees the task or this sees it idle.
+    queued_.fetch_add(1, std::memory_order_seq_cst);
+    if (idleWorkers_.load(std::memory_order_seq_cst) > 0) {
+      std::lock_guard<std::mutex> lock(idleMutex_);
+      idleCv_.notify_one();
+    }
+  }
+
+private:
+  struct alignas(128) Worker {
+    std::mutex mutex;
+    std::deque<ExecutorTask*> tasks;
+  };
+
+  void runWorker(std::size_t index) {
+    currentExecutor_ = this;
+    currentWorker_ = index;
+    while (true) {
+      if (ExecutorTask* task = take(index)) {
+        task->runSlice();
+        continue;
+      }
+
+      std::unique_lock<std::mutex> lock(idleMutex_);
+      idleWorkers_.fetch_add(1, std::memory_order_seq_cst);
+      idleCv_.wait(lock, [this] {
+        return stopping_ || queued_.load(std::memory_order_seq_cst) > 0;
+      });
+      idleWorkers_.fetch_sub(1, std::memory_order_relaxed);
+      if (stopping_) {
+        return;
+      }
+    }
+  }
+
+  ExecutorTask* take(std::size_t index) {
+    if (ExecutorTask* task = pop(*workers_[index], false)) {
+      return task;
+    }
+    for (std::size_t i = 1; i < workers_.size(); ++i) {
+      if (ExecutorTask* task = pop(*workers_[(index + i) % workers_.size()], true)) {
+        return task;
+      }
+    }
+    return nullptr;
+  }
+
+  ExecutorTask* pop(Worker& worker, bool steal) {
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (worker.tasks.empty()) {
+      return nullptr;
+    }
+    ExecutorTask* task;
+    if (steal) {
+      task = worker.tasks.back();
+      worker.tasks.pop_back();
+    } else {
+      task = worker.tasks.front();
+      worker.tasks.pop_front();
+    }
+    queued_.fetch_sub(1, std::memory_order_relaxed);
+    return task;
+  }
+
+  static inline thread_local const WorkStealingExecutor* currentExecutor_ = nullptr;
+  static inline thread_local std::size_t currentWorker_ = 0;
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::vector<std::thread> threads_;
+  std::atomic<std::size_t> nextWorker_{0};
+  alignas(128) std::atomic<int> queued_{0};
+  std::atomic<int> idleWorkers_{0};
+  std::mutex idleMutex_;
+  std::condition_variable idleCv_;
+  bool stopping_{false};
+};
+
+}  // namespace disruptor
@@ -0,0 +1,162 @@
+#pragma once
+// Port of com.lmax.disruptor.WorkerPool from Disruptor 3.x (removed in 4.0,
+// so there is no source under reference/).
+
+#include "Cursored.h"
+#include "DataProvider.h"
+#include "ExceptionHandler.h"
+#include "Sequence.h"
+#include "Sequencer.h"
+#include "WorkHandler.h"
+#include "WorkProcessor.h"
+#include "dsl/ThreadFactory.h"
+#include "util/ExceptionSupport.h"
+#include "util/ThreadHints.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <latch>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace disruptor {
+
+// A pool of WorkProcessors sharing one work sequence: each event published to
+// the ring is handled by exactly one WorkHandler. Gate the ring on
+// getWorkerSequences() (the workers' sequences plus the work sequence).
+//
+// Java: start(Executor) hands the processors to the executor. Here start()
+// creates one thread per worker through a dsl::ThreadFactory, and join()
+// waits for them after halt().
+template <typename T, typename BarrierT>
+class WorkerPool final {
+public:
+  using ProcessorT = WorkProcessor<T, BarrierT>;
+
+  template <typename RingBufferT>
+  WorkerPool(RingBufferT& ringBuffer,
+             BarrierT& sequenceBarrier,
+             ExceptionHandler<T>& exceptionHandler,
+             WorkHandler<T>* const* workHandlers,
+             int count,
+             int claimBatchSize = 1)
+    : cursor_(&ringBuffer) {
+    if (count < 1) {
+      util::raise(std::invalid_argument("a WorkerPool needs at least one WorkHandler"));
+    }
+    workProcessors_.reserve(static_cast<std::size_t>(count));
+    for (int i = 0; i < count; ++i) {
+      workProcessors_.push_back(std::make_unique<ProcessorT>(
+        static_cast<DataProvider<T>&>(ringBuffer), sequenceBarrier,
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        *workHandlers[i], exceptionHandler, workSequence_, claimBatchSize));
+    }
+  }
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  // Only halts if started threads were never joined: the barrier may already
+  // be gone once the owner has halted and joined the pool.
+  ~WorkerPool() {
+    if (!threads_.empty()) {
+      halt();
+      join();
+    }
+  }
+
+  // The workers' sequences followed by the work sequence.
+  std::vector<Sequence*> getWorkerSequences() {
+    std::vector<Sequence*> sequences;
+    sequences.reserve(workProcessors_.size() + 1);
+    for (auto& processor : workProcessors_) {
+      sequences.push_back(&processor->getSequence());
+    }
+    sequences.push_back(&workSequence_);
+    return sequences;
+  }
+
+  int getWorkerCount() const {
+    return static_cast<int>(workProcessors_.size());
+  }
+
+  ProcessorT& getWorkProcessor(int index) {
+    return *workProcessors_[static_cast<std::size_t>(index)];
+  }
+
+  // Starts every worker from the current cursor.
+  void start(dsl::ThreadFactory& threadFactory, std::latch* startupLatch = nullptr) {
+    if (started_.exchange(true, std::memory_order_acq_rel)) {
+      util::raise(std::runtime_error(
+        "WorkerPool has already been started and cannot be restarted until halted."));
+    }
+    const int64_t cursor = cursor_->getCursor();
+    workSequence_.set(cursor);
+    for (auto& processor : workProcessors_) {
+      processor->getSequence().set(cursor);
+    }
+    for (auto& processor : workProcessors_) {
+      ProcessorT* worker = processor.get();
+      threads_.push_back(threadFactory.newThread([worker, startupLatch] {
+        if (startupLatch != nullptr) {
+          startupLatch->count_down();
+        }
+        worker->run();
+      }));
+    }
+  }
+
+  // Waits until every published event has been handled, then halts.
+  void drainAndHalt() {
+    while (cursor_->getCursor() > minimumWorkerSequence()) {
+      util::ThreadHints::onSpinWait();
+    }
+    halt();
+  }
+
+  void halt() {
+    for (auto& processor : workProcessors_) {
+      processor->halt();
+    }
+    started_.store(false, std::memory_order_release);
+  }
+
+  void join() {
+    for (auto& thread : threads_) {
+      if (thread.joinable()) {
+        thread.join();
+      }
+    }
+    threads_.clear();
+  }
+
+  bool isRunning() {
+    for (auto& processor : workProcessors_) {
+      if (processor->isRunning()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+private:
+  Cursored* cursor_;
+  Sequence workSequence_{SEQUENCER_INITIAL_CURSOR_VALUE};
+  std::vector<std::unique_ptr<ProcessorT>> workProcessors_;
+  std::vector<std::thread> threads_;
+  std::atomic<bool> started_{false};
+
+  int64_t minimumWorkerSequence() {
+    int64_t minimum = workSequence_.get();
+    for (auto& processor : workProcessors_) {
+      minimum = (std::min)(minimum, processor->getSequence().get());
+    }
+    return minimum;
+  }
+};
+
+}  // namespace disruptor
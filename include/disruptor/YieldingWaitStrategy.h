@@ -15,16 +15,27 @@ class YieldingWaitStrategy final {
 public:
   static constexpr bool kIsBlockingStrategy = false;
 
-  template <typename Barrier>
+  template <typename DependentSequenceT, typename Barrier>
   int64_t waitFor(int64_t sequence,
-                  const Sequence& /*cursor*/,
-                  const Sequence& dependentSequence,
+                  const Sequence& cursor,
+                  const DependentSequenceT& dependentSequence,
                   Barrier& barrier) {
+    return waitResultOrThrow(tryWaitFor(sequence, cursor, dependentSequence, barrier));
+  }
+
+  template <typename DependentSequenceT, typename Barrier>
+  WaitResult tryWaitFor(int64_t sequence,
+                        const Sequence& /*cursor*/,
+                        const DependentSequenceT& dependentSequence,
+                        Barrier& barrier) {
     int64_t availableSequence;
     int counter = SPIN_TRIES;
 
     while ((availableSequence = dependentSequence.get()) < sequence) {
-      counter = applyWaitMethod(barrier, counter);
+      if (barrier.isAlerted()) {
+        return std::unexpected(ErrorCode::Alerted);
+      }
+      counter = applyWaitMethod(counter);
     }
     return availableSequence;
   }
@@ -34,9 +45,7 @@ public:
 private:
   static constexpr int SPIN_TRIES = 100;
 
-  template <typename Barrier>
-  static int applyWaitMethod(Barrier& barrier, int counter) {
-    barrier.checkAlert();
+  static int applyWaitMethod(int counter) {
     if (counter == 0) {
       std::this_thread::yield();
       return counter;
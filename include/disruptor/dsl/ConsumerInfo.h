@@ -4,6 +4,7 @@
 // reference/disruptor/src/main/java/com/lmax/disruptor/dsl/ConsumerInfo.java
 
 #include "../Sequence.h"
+#include "../WorkStealingExecutor.h"
 #include "ThreadFactory.h"
 
 #include <latch>
@@ -22,6 +23,14 @@ public:
   virtual bool isEndOfChain() = 0;
 
   virtual void start(ThreadFactory& threadFactory, std::latch* startupLatch) = 0;
+
+  // C++-only: starts the consumer as tasks on executor; false if it can only
+  // run on threads of its own.
+  virtual bool startOn(WorkStealingExecutor& /*executor*/,
+                       int /*maxEventsPerSlice*/,
+                       std::latch* /*startupLatch*/) {
+    return false;
+  }
   virtual void halt() = 0;
   virtual void join() = 0;
   virtual void markAsUsedInBarrier() = 0;
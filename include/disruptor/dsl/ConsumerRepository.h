@@ -6,8 +6,10 @@
 #include "../EventHandlerIdentity.h"
 #include "../EventProcessor.h"
 #include "../Sequence.h"
+#include "../WorkStealingExecutor.h"
 #include "ConsumerInfo.h"
 #include "EventProcessorInfo.h"
+#include "WorkerPoolInfo.h"
 #include "ThreadFactory.h"
 
 #include <latch>
@@ -22,9 +24,12 @@ namespace disruptor::dsl {
 template <typename BarrierPtrT>
 class ConsumerRepository final {
 public:
-  void
-  add(EventProcessor& eventprocessor, EventHandlerIdentity& handlerIdentity, BarrierPtrT barrier) {
-    auto consumerInfo = std::make_shared<EventProcessorInfo<BarrierPtrT>>(eventprocessor, barrier);
+  void add(EventProcessor& eventprocessor,
+           EventHandlerIdentity& handlerIdentity,
+           BarrierPtrT barrier,
+           std::unique_ptr<ExecutorConsumer> executorConsumer = nullptr) {
+    auto consumerInfo = std::make_shared<EventProcessorInfo<BarrierPtrT>>(
+      eventprocessor, barrier, std::move(executorConsumer));
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     eventProcessorInfoByEventHandler_[&handlerIdentity] = consumerInfo;
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
@@ -39,12 +44,49 @@ public:
     consumerInfos_.push_back(std::move(consumerInfo));
   }
 
+  // Java 3.x: add(WorkerPool, SequenceBarrier). Every worker sequence maps to
+  // the pool, so a later stage marks it as used in a barrier.
+  template <typename WorkerPoolT>
+  void add(WorkerPoolT& workerPool, BarrierPtrT barrier) {
+    auto consumerInfo =
+      std::make_shared<WorkerPoolInfo<BarrierPtrT, WorkerPoolT>>(workerPool, barrier);
+    Sequence* const* sequences = consumerInfo->getSequences();
+    for (int i = 0; i < consumerInfo->getSequenceCount(); ++i) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      eventProcessorInfoBySequence_[sequences[i]] = consumerInfo;
+    }
+    consumerInfos_.push_back(std::move(consumerInfo));
+  }
+
+  // C++-only: alias finds the consumer added for registered, e.g. a user
+  // handler behind a PartitionedEventHandler adapter.
+  void addAlias(EventHandlerIdentity& registered, EventHandlerIdentity& alias) {
+    auto it = eventProcessorInfoByEventHandler_.find(&registered);
+    if (it == eventProcessorInfoByEventHandler_.end()) {
+      throw std::invalid_argument("The event handler is not processing events.");
+    }
+    eventProcessorInfoByEventHandler_[&alias] = it->second;
+  }
+
   void startAll(ThreadFactory& threadFactory, std::latch* startupLatch = nullptr) {
     for (auto& c : consumerInfos_) {
       c->start(threadFactory, startupLatch);
     }
   }
 
+  // C++-only: consumers that support it run on executor, the others on
+  // threads from threadFactory.
+  void startAll(ThreadFactory& threadFactory,
+                WorkStealingExecutor& executor,
+                int maxEventsPerSlice,
+                std::latch* startupLatch = nullptr) {
+    for (auto& c : consumerInfos_) {
+      if (!c->startOn(executor, maxEventsPerSlice, startupLatch)) {
+        c->start(threadFactory, startupLatch);
+      }
+    }
+  }
+
   int getProcessorCount() const {
     return static_cast<int>(consumerInfos_.size());
   }
@@ -68,7 +110,7 @@ public:
         const int count = consumerInfo->getSequenceCount();
         for (int i = 0; i < count; ++i) {
           // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-          if (cursor > sequences[i]->get()) {
+          if (cursor > sequences[i]->gatingTarget()->get()) {
             return true;
           }
         }
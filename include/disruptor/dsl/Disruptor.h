@@ -7,17 +7,26 @@
 // overload surface (varargs, generics wildcards, Thread lifecycle) is adapted
 // to C++ idioms while keeping semantics.
 
+#include "../AsyncWaitStrategy.h"
 #include "../BatchEventProcessor.h"
+#include "../BatchEventProcessorTask.h"
 #include "../EventFactory.h"
 #include "../EventHandlerIdentity.h"
 #include "../EventProcessor.h"
 #include "../EventTranslator.h"
 #include "../EventTranslatorOneArg.h"
 #include "../ExceptionHandler.h"
+#include "../GatingTree.h"
+#include "../PartitionedEventHandler.h"
 #include "../RingBuffer.h"
 #include "../Sequence.h"
+#include "../SequenceArray.h"
 #include "../TimeoutException.h"
 #include "../WaitStrategy.h"
+#include "../WorkHandler.h"
+#include "../WorkStealingExecutor.h"
+#include "../WorkerPool.h"
+#include "../util/MappedAllocator.h"
 #include "../util/ThreadHints.h"
 #include "../util/Util.h"
 
@@ -29,7 +38,10 @@
 #include "ProducerType.h"
 #include "ThreadFactory.h"
 
+#include <array>
 #include <atomic>
+#include <concepts>
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <memory>
@@ -61,19 +73,24 @@ public:
     }
   }
 
-  using SequencerT = std::conditional_t<Producer == ProducerType::SINGLE,
-                                        ::disruptor::SingleProducerSequencer<WaitStrategyT>,
-                                        ::disruptor::MultiProducerSequencer<WaitStrategyT>>;
+  using SequencerT = std::conditional_t<
+    Producer == ProducerType::SINGLE,
+    ::disruptor::SingleProducerSequencer<WaitStrategyT>,
+    std::conditional_t<Producer == ProducerType::MULTI_COMBINING,
+                       ::disruptor::CombiningMultiProducerSequencer<WaitStrategyT>,
+                       ::disruptor::MultiProducerSequencer<WaitStrategyT>>>;
   using RingBufferT = ::disruptor::RingBuffer<T, SequencerT>;
   using BarrierPtr =
     decltype(std::declval<RingBufferT&>().newBarrier(static_cast<Sequence* const*>(nullptr), 0));
   using BarrierT = typename BarrierPtr::element_type;
+  using WorkerPoolT = ::disruptor::WorkerPool<T, BarrierT>;
 
   Disruptor(std::shared_ptr<EventFactory<T>> eventFactory,
             int ringBufferSize,
             ThreadFactory& threadFactory)
     : ownedWaitStrategy_(std::in_place)
-    , ringBuffer_(makeRingBuffer_(std::move(eventFactory), ringBufferSize, *ownedWaitStrategy_))
+    , ringBuffer_(
+        makeRingBuffer_(std::move(eventFactory), ringBufferSize, *ownedWaitStrategy_, {}))
     , threadFactory_(threadFactory)
     , consumerRepository_()
     , started_(false)
@@ -84,28 +101,117 @@ public:
             ThreadFactory& threadFactory,
             WaitStrategyT& waitStrategy)
     : ownedWaitStrategy_(std::nullopt)
-    , ringBuffer_(makeRingBuffer_(std::move(eventFactory), ringBufferSize, waitStrategy))
+    , ringBuffer_(makeRingBuffer_(std::move(eventFactory), ringBufferSize, waitStrategy, {}))
     , threadFactory_(threadFactory)
     , consumerRepository_()
     , started_(false)
     , exceptionHandler_(std::make_unique<ExceptionHandlerWrapper<T>>()) {}
 
+  // C++-only: ring slots and sequencer metadata allocated per memoryPolicy
+  // (huge pages, NUMA node, pre-fault, mlock). With a NUMA node the
+  // BatchEventProcessors, and so their Sequences, are bound to it as well;
+  // pair with util::NumaThreadFactory to run the consumers there.
+  Disruptor(std::shared_ptr<EventFactory<T>> eventFactory,
+            int ringBufferSize,
+            ThreadFactory& threadFactory,
+            WaitStrategyT& waitStrategy,
+            const util::MemoryPolicy& memoryPolicy)
+    : ownedWaitStrategy_(std::nullopt)
+    , ringBuffer_(
+        makeRingBuffer_(std::move(eventFactory), ringBufferSize, waitStrategy, memoryPolicy))
+    , threadFactory_(threadFactory)
+    , consumerRepository_()
+    , started_(false)
+    , exceptionHandler_(std::make_unique<ExceptionHandlerWrapper<T>>()) {
+    consumerMemoryPolicy_.numaNode = memoryPolicy.numaNode;
+  }
+
 private:
   static std::shared_ptr<RingBufferT> makeRingBuffer_(std::shared_ptr<EventFactory<T>> factory,
                                                       int ringBufferSize,
-                                                      WaitStrategyT& waitStrategy) {
+                                                      WaitStrategyT& waitStrategy,
+                                                      const util::MemoryPolicy& memoryPolicy) {
     // Construct SequencerT in-place in RingBuffer to avoid move/copy
-    return std::shared_ptr<RingBufferT>(
-      new RingBufferT(std::move(factory), std::in_place, ringBufferSize, waitStrategy));
+    return std::shared_ptr<RingBufferT>(new RingBufferT(std::move(factory), memoryPolicy,
+                                                        std::in_place, ringBufferSize,
+                                                        waitStrategy, memoryPolicy));
   }
 
+  // The BatchEventProcessor the DSL creates for a handler of type Handler.
+  template <typename Handler>
+  struct ProcessorFor {
+    using type = BatchEventProcessor<T, BarrierT>;
+  };
+
+  template <StaticDispatchHandler<T> Handler>
+  struct ProcessorFor<Handler> {
+    using type = StaticBatchEventProcessor<T, Handler, BarrierT, RingBufferT>;
+  };
+
 public:
+  // C++-only: handler groups of more than fanIn BatchEventProcessors, created
+  // after this call, gate the ring through a GatingTree with that fan-in
+  // instead of one gating Sequence per processor. 0 (the default) disables.
+  void setGatingTreeFanIn(int fanIn) {
+    checkNotStarted();
+    if (fanIn != 0 && fanIn < 2) {
+      throw std::invalid_argument("gating tree fanIn must be 0 or at least 2");
+    }
+    gatingTreeFanIn_ = fanIn;
+  }
+
+  // C++-only: start() runs the BatchEventProcessors as tasks on executor, in
+  // slices of at most maxEventsPerSlice events, instead of on a thread each
+  // (see BatchEventProcessorTask). Other consumers still get threads. The
+  // executor must outlive the Disruptor.
+  void runConsumersOn(WorkStealingExecutor& executor, int maxEventsPerSlice = 1024)
+    requires std::same_as<WaitStrategyT, AsyncWaitStrategy>
+  {
+    checkNotStarted();
+    if (maxEventsPerSlice < 1) {
+      throw std::invalid_argument("maxEventsPerSlice must be greater than 0");
+    }
+    executor_ = &executor;
+    maxEventsPerSlice_ = maxEventsPerSlice;
+  }
+
   // Set up event handlers (start of chain)
   template <typename... Handlers>
   EventHandlerGroup<T, Producer, WaitStrategyT> handleEventsWith(Handlers&... handlers) {
     return createEventProcessors(static_cast<Sequence* const*>(nullptr), 0, handlers...);
   }
 
+  // C++-only: one BatchEventProcessor per handler on this ring, handler i
+  // getting only the events its producers tagged with partition i in tags
+  // (see PartitionTags). A key always maps to one partition, so per-key order
+  // is kept while the keys spread over threads. The returned group gates and
+  // feeds later stages like any handleEventsWith group.
+  template <typename... Handlers>
+  EventHandlerGroup<T, Producer, WaitStrategyT>
+  handleEventsWithPartitioned(const PartitionTags& tags, Handlers&... handlers) {
+    return createPartitionedProcessors(static_cast<Sequence* const*>(nullptr), 0, tags,
+                                       handlers...);
+  }
+
+  // C++-only: worker pools created after this call claim up to claimBatchSize
+  // available sequences per compareAndSet on their work sequence (see
+  // WorkProcessor). 1 (the default) is Java's one sequence per claim.
+  void setWorkClaimBatchSize(int claimBatchSize) {
+    checkNotStarted();
+    if (claimBatchSize < 1) {
+      throw std::invalid_argument("claimBatchSize must be greater than 0");
+    }
+    workClaimBatchSize_ = claimBatchSize;
+  }
+
+  // Java 3.x: handleEventsWithWorkerPool(WorkHandler<T>... workHandlers).
+  // Each event is handled by exactly one of the handlers, one thread each.
+  template <typename... WorkHandlers>
+  EventHandlerGroup<T, Producer, WaitStrategyT>
+  handleEventsWithWorkerPool(WorkHandlers&... workHandlers) {
+    return createWorkerPool(static_cast<Sequence* const*>(nullptr), 0, workHandlers...);
+  }
+
   // Set up custom processors (start of chain)
   EventHandlerGroup<T, Producer, WaitStrategyT> handleEventsWith(EventProcessor* const* processors,
                                                                  int count) {
@@ -140,9 +246,8 @@ public:
     wrapper->switchTo(exceptionHandler);
   }
 
-  ExceptionHandlerSetting<T, BarrierPtr, BarrierT>
-  handleExceptionsFor(EventHandlerIdentity& eventHandler) {
-    return ExceptionHandlerSetting<T, BarrierPtr, BarrierT>(eventHandler, consumerRepository_);
+  ExceptionHandlerSetting<T, BarrierPtr> handleExceptionsFor(EventHandlerIdentity& eventHandler) {
+    return ExceptionHandlerSetting<T, BarrierPtr>(eventHandler, consumerRepository_);
   }
 
   // Dependency setup
@@ -179,7 +284,11 @@ public:
   // Start/stop lifecycle
   std::shared_ptr<RingBufferT> start(std::latch* startupLatch = nullptr) {
     checkOnlyStartedOnce();
-    consumerRepository_.startAll(threadFactory_, startupLatch);
+    if (executor_ != nullptr) {
+      consumerRepository_.startAll(threadFactory_, *executor_, maxEventsPerSlice_, startupLatch);
+    } else {
+      consumerRepository_.startAll(threadFactory_, startupLatch);
+    }
     return ringBuffer_;
   }
 
@@ -263,12 +372,41 @@ public:
     // Mark previous end-of-chain processors as used-in-barrier.
     consumerRepository_.unMarkEventProcessorsAsEndOfChain(barrierSequences, barrierCount);
 
+    // C++-only: the BatchEventProcessors of one group keep their Sequences in
+    // one SequenceArray, so the ring's gating check and the next stage's
+    // barrier scan them as a single contiguous run. Past gatingTreeFanIn_
+    // they are the members of a GatingTree and the ring gates on its root.
+    constexpr int kGroupSequences =
+      (0 + ... + (std::is_base_of_v<EventHandlerBase<T>, Handlers> ? 1 : 0));
+    GroupSlots groupSlots;
+    if (gatingTreeFanIn_ > 0 && kGroupSequences > gatingTreeFanIn_) {
+      ownedGatingTrees_.push_back(
+        std::make_unique<GatingTree>(kGroupSequences, gatingTreeFanIn_, consumerMemoryPolicy_));
+      groupSlots.tree = ownedGatingTrees_.back().get();
+    } else if (kGroupSequences > 1) {
+      ownedSequenceArrays_.push_back(
+        std::make_unique<SequenceArray>(kGroupSequences, consumerMemoryPolicy_));
+      groupSlots.array = ownedSequenceArrays_.back().get();
+    }
+
     std::vector<Sequence*> processorSequences;
-    createEventProcessorsImpl(barrierSequences, barrierCount, processorSequences, handlers...);
+    createEventProcessorsImpl(
+      barrierSequences, barrierCount, processorSequences, groupSlots, handlers...);
 
     // New processors gate the ring buffer.
-    ringBuffer_->addGatingSequences(processorSequences.data(),
-                                    static_cast<int>(processorSequences.size()));
+    if (groupSlots.tree != nullptr) {
+      std::vector<Sequence*> others;
+      for (Sequence* sequence : processorSequences) {
+        if (!groupSlots.tree->contains(*sequence)) {
+          others.push_back(sequence);
+        }
+      }
+      ringBuffer_->addGatingSequences(*groupSlots.tree);
+      ringBuffer_->addGatingSequences(others.data(), static_cast<int>(others.size()));
+    } else {
+      ringBuffer_->addGatingSequences(processorSequences.data(),
+                                      static_cast<int>(processorSequences.size()));
+    }
 
     // Remove old gating sequences for next-in-chain.
     updateGatingSequencesForNextInChain(barrierSequences, barrierCount, processorSequences);
@@ -278,6 +416,62 @@ public:
       static_cast<int>(processorSequences.size()));
   }
 
+  template <typename... Handlers>
+  EventHandlerGroup<T, Producer, WaitStrategyT>
+  createPartitionedProcessors(Sequence* const* barrierSequences,
+                              int barrierCount,
+                              const PartitionTags& tags,
+                              Handlers&... handlers) {
+    checkNotStarted();
+    constexpr int kPartitions = static_cast<int>(sizeof...(Handlers));
+    if (tags.partitions() != kPartitions) {
+      throw std::invalid_argument("need one handler per partition");
+    }
+    if (tags.bufferSize() != ringBuffer_->getBufferSize()) {
+      throw std::invalid_argument("PartitionTags must have the ring buffer's size");
+    }
+    int partition = 0;
+    std::array<PartitionedEventHandler<T>*, sizeof...(Handlers)> adapters = {
+      ownPartitionAdapter(handlers, tags, partition++)...};
+    auto group = [&]<std::size_t... I>(std::index_sequence<I...>) {
+      return createEventProcessors(barrierSequences, barrierCount, *adapters[I]...);
+    }(std::make_index_sequence<sizeof...(Handlers)>{});
+    for (PartitionedEventHandler<T>* adapter : adapters) {
+      // The adapter finds where each batch starts from its processor's Sequence.
+      adapter->setSequenceCallback(consumerRepository_.getSequenceFor(*adapter));
+      consumerRepository_.addAlias(*adapter, adapter->handler());
+    }
+    return group;
+  }
+
+  // Java 3.x: createWorkerPool(Sequence[] barrierSequences, WorkHandler<T>[])
+  template <typename... WorkHandlers>
+  EventHandlerGroup<T, Producer, WaitStrategyT> createWorkerPool(Sequence* const* barrierSequences,
+                                                                 int barrierCount,
+                                                                 WorkHandlers&... workHandlers) {
+    checkNotStarted();
+    consumerRepository_.unMarkEventProcessorsAsEndOfChain(barrierSequences, barrierCount);
+
+    auto barrier = ringBuffer_->newBarrier(barrierSequences, barrierCount);
+    ownedBarriers_.push_back(barrier);
+    std::array<WorkHandler<T>*, sizeof...(WorkHandlers)> handlers = {&workHandlers...};
+    auto workerPool = std::make_unique<WorkerPoolT>(*ringBuffer_, *barrier, getExceptionHandler(),
+                                                    handlers.data(),
+                                                    static_cast<int>(handlers.size()),
+                                                    workClaimBatchSize_);
+    consumerRepository_.add(*workerPool, barrier);
+
+    std::vector<Sequence*> workerSequences = workerPool->getWorkerSequences();
+    ownedWorkerPools_.push_back(std::move(workerPool));
+    ringBuffer_->addGatingSequences(workerSequences.data(),
+                                    static_cast<int>(workerSequences.size()));
+    updateGatingSequencesForNextInChain(barrierSequences, barrierCount, workerSequences);
+
+    return EventHandlerGroup<T, Producer, WaitStrategyT>(
+      *this, consumerRepository_, workerSequences.data(),
+      static_cast<int>(workerSequences.size()));
+  }
+
 private:
   friend class EventHandlerGroup<T, Producer, WaitStrategyT>;
 
@@ -295,7 +489,13 @@ private:
   // Own BatchEventProcessors created by DSL so their lifetime spans the
   // disruptor. Must be declared before consumerRepository_ so processors are
   // destroyed after EventProcessorInfo (which holds raw pointers to them).
+  // Sequences of grouped processors (see createEventProcessors); declared
+  // first so they outlive the processors and the repository keys.
+  std::vector<std::unique_ptr<SequenceArray>> ownedSequenceArrays_;
+  std::vector<std::unique_ptr<GatingTree>> ownedGatingTrees_;
   std::vector<std::shared_ptr<EventProcessor>> ownedProcessors_;
+  std::vector<std::unique_ptr<WorkerPoolT>> ownedWorkerPools_;
+  std::vector<std::unique_ptr<PartitionedEventHandler<T>>> ownedPartitionAdapters_;
   ConsumerRepository<BarrierPtr> consumerRepository_;
   std::atomic<bool> started_;
   bool halted_ =
@@ -306,6 +506,28 @@ private:
   // Hold SequenceBarriers created by the DSL to ensure they outlive processors
   // that reference them.
   std::vector<BarrierPtr> ownedBarriers_;
+  // Only the NUMA node of the constructor's MemoryPolicy: a processor is far
+  // smaller than a huge page.
+  util::MemoryPolicy consumerMemoryPolicy_{};
+  int gatingTreeFanIn_{0};
+  int workClaimBatchSize_{1};
+  WorkStealingExecutor* executor_{nullptr};
+  int maxEventsPerSlice_{0};
+
+  // Where the next BatchEventProcessor of a group keeps its Sequence: a
+  // SequenceArray slot, a GatingTree member, or (neither) its own.
+  struct GroupSlots {
+    SequenceArray* array{nullptr};
+    GatingTree* tree{nullptr};
+    int next{0};
+  };
+
+  PartitionedEventHandler<T>*
+  ownPartitionAdapter(EventHandler<T>& handler, const PartitionTags& tags, int partition) {
+    ownedPartitionAdapters_.push_back(
+      std::make_unique<PartitionedEventHandler<T>>(handler, tags, partition));
+    return ownedPartitionAdapters_.back().get();
+  }
 
   // Helper to get the current exception handler (either owned or external)
   ExceptionHandler<T>& getExceptionHandler() {
@@ -332,38 +554,86 @@ private:
   // sufficient for current port.
   void createEventProcessorsImpl(Sequence* const* barrierSequences,
                                  int barrierCount,
-                                 std::vector<Sequence*>& outSequences) {
+                                 std::vector<Sequence*>& outSequences,
+                                 GroupSlots& groupSlots) {
     (void)barrierSequences;
     (void)barrierCount;
     (void)outSequences;
+    (void)groupSlots;
   }
 
   template <typename Handler, typename... Rest>
   void createEventProcessorsImpl(Sequence* const* barrierSequences,
                                  int barrierCount,
                                  std::vector<Sequence*>& outSequences,
+                                 GroupSlots& groupSlots,
                                  Handler& handler,
                                  Rest&... rest) {
-    createOne(barrierSequences, barrierCount, outSequences, handler);
-    createEventProcessorsImpl(barrierSequences, barrierCount, outSequences, rest...);
+    createOne(barrierSequences, barrierCount, outSequences, groupSlots, handler);
+    createEventProcessorsImpl(barrierSequences, barrierCount, outSequences, groupSlots, rest...);
   }
 
-  // Create for EventHandler<T> and RewindableEventHandler<T>
+  // Create for EventHandler<T> and RewindableEventHandler<T>.
   void createOne(Sequence* const* barrierSequences,
                  int barrierCount,
                  std::vector<Sequence*>& outSequences,
+                 GroupSlots& groupSlots,
                  ::disruptor::EventHandlerBase<T>& handler) {
+    createBatchProcessor<BatchEventProcessor<T, BarrierT>>(barrierSequences, barrierCount,
+                                                           outSequences, groupSlots, handler);
+  }
+
+  // C++-only: a final handler class gets a StaticBatchEventProcessor, whose
+  // onEvent and ring accesses are direct calls.
+  template <StaticDispatchHandler<T> Handler>
+  void createOne(Sequence* const* barrierSequences,
+                 int barrierCount,
+                 std::vector<Sequence*>& outSequences,
+                 GroupSlots& groupSlots,
+                 Handler& handler) {
+    createBatchProcessor<typename ProcessorFor<Handler>::type>(barrierSequences, barrierCount,
+                                                               outSequences, groupSlots, handler);
+  }
+
+  template <typename ProcessorT, typename Handler>
+  void createBatchProcessor(Sequence* const* barrierSequences,
+                            int barrierCount,
+                            std::vector<Sequence*>& outSequences,
+                            GroupSlots& groupSlots,
+                            Handler& handler) {
     auto barrier = ringBuffer_->newBarrier(barrierSequences, barrierCount);
     ownedBarriers_.push_back(barrier);
     // Java uses BatchEventProcessorBuilder to configure max batch size; we use
     // default max here. (If/when DSL exposes builder configuration, wire it
     // through.)
-    auto processor = std::make_shared<BatchEventProcessor<T, BarrierT>>(
-      *ringBuffer_, *barrier, handler, std::numeric_limits<int>::max(), nullptr);
+    auto makeProcessor = [&](auto&&... sequence) {
+      return consumerMemoryPolicy_.usesMapping()
+               ? std::allocate_shared<ProcessorT>(
+                   util::MappedAllocator<ProcessorT>(consumerMemoryPolicy_), *ringBuffer_,
+                   *barrier, handler, std::numeric_limits<int>::max(), nullptr, sequence...)
+               : std::make_shared<ProcessorT>(*ringBuffer_, *barrier, handler,
+                                              std::numeric_limits<int>::max(), nullptr,
+                                              sequence...);
+    };
+    std::shared_ptr<ProcessorT> processor;
+    if (groupSlots.tree != nullptr) {
+      processor = makeProcessor(*groupSlots.tree, groupSlots.next++);
+    } else if (groupSlots.array != nullptr) {
+      processor = makeProcessor((*groupSlots.array)[groupSlots.next++]);
+    } else {
+      processor = makeProcessor();
+    }
     // Apply default exception handler if it is wrapper or concrete.
     processor->setExceptionHandler(getExceptionHandler());
     auto& seq = processor->getSequence();
-    consumerRepository_.add(*processor, handler, barrier);
+    if constexpr (std::is_same_v<WaitStrategyT, AsyncWaitStrategy>) {
+      consumerRepository_.add(
+        *processor, handler, barrier,
+        std::make_unique<BatchEventProcessorTask<ProcessorT, BarrierT>>(
+          *processor, *barrier, ringBuffer_->getSequencer().getWaitStrategy()));
+    } else {
+      consumerRepository_.add(*processor, handler, barrier);
+    }
     ownedProcessors_.push_back(processor);
     outSequences.push_back(&seq);
   }
@@ -372,6 +642,7 @@ private:
   void createOne(Sequence* const* barrierSequences,
                  int barrierCount,
                  std::vector<Sequence*>& outSequences,
+                 GroupSlots& /*groupSlots*/,
                  ::disruptor::dsl::EventProcessorFactory<T, RingBufferT>& factory) {
     // Create processor via factory and wire it into repository.
     auto processor = factory.createEventProcessor(*ringBuffer_, barrierSequences, barrierCount);
@@ -389,10 +660,20 @@ private:
     // sequences.
     for (int i = 0; i < barrierCount; ++i) {
       // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-      ringBuffer_->removeGatingSequence(*barrierSequences[i]);
+      ringBuffer_->removeGatingSequence(gatingSequenceFor(*barrierSequences[i]));
     }
     (void)processorSequences;
   }
+
+  // A GatingTree member gates the ring through the tree's root.
+  Sequence& gatingSequenceFor(Sequence& sequence) {
+    for (const auto& tree : ownedGatingTrees_) {
+      if (tree->contains(sequence)) {
+        return tree->root();
+      }
+    }
+    return sequence;
+  }
 };
 
 }  // namespace disruptor::dsl
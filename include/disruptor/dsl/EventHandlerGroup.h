@@ -7,6 +7,7 @@
 // `&&`), so we expose it as `and_` while keeping behavior 1:1.
 
 #include "../EventProcessor.h"
+#include "../PartitionedEventHandler.h"
 #include "../Sequence.h"
 #include "ConsumerRepository.h"
 #include "ProducerType.h"
@@ -80,6 +81,35 @@ public:
                                              factories...);
   }
 
+  // C++-only: see Disruptor::handleEventsWithPartitioned.
+  template <typename... Handlers>
+  EventHandlerGroup<T, Producer, WaitStrategyT> thenPartitioned(const PartitionTags& tags,
+                                                                Handlers&... handlers) {
+    return handleEventsWithPartitioned(tags, handlers...);
+  }
+
+  template <typename... Handlers>
+  EventHandlerGroup<T, Producer, WaitStrategyT>
+  handleEventsWithPartitioned(const PartitionTags& tags, Handlers&... handlers) {
+    return disruptor_->createPartitionedProcessors(sequences_.data(),
+                                                   static_cast<int>(sequences_.size()), tags,
+                                                   handlers...);
+  }
+
+  // Java 3.x: thenHandleEventsWithWorkerPool(WorkHandler<T>... handlers)
+  template <typename... WorkHandlers>
+  EventHandlerGroup<T, Producer, WaitStrategyT>
+  thenHandleEventsWithWorkerPool(WorkHandlers&... workHandlers) {
+    return handleEventsWithWorkerPool(workHandlers...);
+  }
+
+  template <typename... WorkHandlers>
+  EventHandlerGroup<T, Producer, WaitStrategyT>
+  handleEventsWithWorkerPool(WorkHandlers&... workHandlers) {
+    return disruptor_->createWorkerPool(sequences_.data(), static_cast<int>(sequences_.size()),
+                                        workHandlers...);
+  }
+
   BarrierPtr asSequenceBarrier() {
     auto barrier = disruptor_->getRingBuffer().newBarrier(sequences_.data(),
                                                           static_cast<int>(sequences_.size()));
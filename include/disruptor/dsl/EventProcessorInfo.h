@@ -3,14 +3,18 @@
 // Source:
 // reference/disruptor/src/main/java/com/lmax/disruptor/dsl/EventProcessorInfo.java
 
+#include "../BatchEventProcessorTask.h"
 #include "../EventProcessor.h"
 #include "../Sequence.h"
+#include "../WorkStealingExecutor.h"
 #include "ConsumerInfo.h"
 #include "ThreadFactory.h"
 
 #include <array>
 #include <latch>
+#include <memory>
 #include <thread>
+#include <utility>
 
 namespace disruptor::dsl {
 
@@ -20,6 +24,15 @@ public:
   EventProcessorInfo(EventProcessor& eventprocessor, BarrierPtrT barrier)
     : eventprocessor_(&eventprocessor), barrier_(barrier) {}
 
+  // C++-only: executorConsumer runs eventprocessor when the DSL starts its
+  // consumers on a WorkStealingExecutor.
+  EventProcessorInfo(EventProcessor& eventprocessor,
+                     BarrierPtrT barrier,
+                     std::unique_ptr<ExecutorConsumer> executorConsumer)
+    : eventprocessor_(&eventprocessor)
+    , barrier_(barrier)
+    , executorConsumer_(std::move(executorConsumer)) {}
+
   EventProcessor& getEventProcessor() {
     return *eventprocessor_;
   }
@@ -70,6 +83,19 @@ public:
     }
   }
 
+  bool startOn(WorkStealingExecutor& executor,
+               int maxEventsPerSlice,
+               std::latch* startupLatch) override {
+    if (!executorConsumer_) {
+      return false;
+    }
+    executorConsumer_->start(executor, maxEventsPerSlice);
+    if (startupLatch) {
+      startupLatch->count_down();
+    }
+    return true;
+  }
+
   void halt() override {
     eventprocessor_->halt();
   }
@@ -77,6 +103,8 @@ public:
   void join() override {
     if (thread_.joinable()) {
       thread_.join();
+    } else if (executorConsumer_) {
+      executorConsumer_->join();
     }
   }
 
@@ -93,6 +121,7 @@ private:
   BarrierPtrT barrier_;
   bool endOfChain_{true};
   std::thread thread_;
+  std::unique_ptr<ExecutorConsumer> executorConsumer_;
 };
 
 }  // namespace disruptor::dsl
@@ -2,31 +2,31 @@
 // 1:1 port of com.lmax.disruptor.dsl.ExceptionHandlerSetting
 // Source: reference/disruptor/src/main/java/com/lmax/disruptor/dsl/ExceptionHandlerSetting.java
 
-#include "../BatchEventProcessor.h"
 #include "../EventHandlerIdentity.h"
 #include "../EventProcessor.h"
 #include "../ExceptionHandler.h"
+#include "../ExceptionHandlingEventProcessor.h"
 #include "ConsumerRepository.h"
 
 #include <stdexcept>
 
 namespace disruptor::dsl {
 
-template <typename T, typename BarrierPtrT, typename BarrierT>
+template <typename T, typename BarrierPtrT>
 class ExceptionHandlerSetting final {
 public:
   ExceptionHandlerSetting(EventHandlerIdentity& handlerIdentity,
                           ConsumerRepository<BarrierPtrT>& consumerRepository)
     : handlerIdentity_(&handlerIdentity), consumerRepository_(&consumerRepository) {}
 
+  // Java casts to BatchEventProcessor; any processor the DSL built for the
+  // handler (including a StaticBatchEventProcessor) takes exception handlers.
   void with(ExceptionHandler<T>& exceptionHandler) {
     EventProcessor& eventProcessor = consumerRepository_->getEventProcessorFor(*handlerIdentity_);
-    auto* batch = dynamic_cast<BatchEventProcessor<T, BarrierT>*>(&eventProcessor);
-    if (batch != nullptr) {
-      batch->setExceptionHandler(exceptionHandler);
-      auto barrier = consumerRepository_->getBarrierFor(*handlerIdentity_);
-      if (barrier)
-        barrier->alert();
+    auto* processor = dynamic_cast<ExceptionHandlingEventProcessor<T>*>(&eventProcessor);
+    if (processor != nullptr) {
+      processor->setExceptionHandler(exceptionHandler);
+      alertBarrier();
     } else {
       throw std::runtime_error(
         "EventProcessor is not a BatchEventProcessor and does not support exception handlers");
@@ -34,6 +34,12 @@ public:
   }
 
 private:
+  void alertBarrier() {
+    auto barrier = consumerRepository_->getBarrierFor(*handlerIdentity_);
+    if (barrier)
+      barrier->alert();
+  }
+
   EventHandlerIdentity* handlerIdentity_;
   ConsumerRepository<BarrierPtrT>* consumerRepository_;
 };
@@ -0,0 +1,291 @@
+#pragma once
+// C++-only: the Disruptor DSL over a MultiLaneRingBuffer (no Java
+// equivalent).
+
+#include "../EventFactory.h"
+#include "../EventHandlerBase.h"
+#include "../EventHandlerIdentity.h"
+#include "../ExceptionHandler.h"
+#include "../MultiLaneEventProcessor.h"
+#include "../MultiLaneRingBuffer.h"
+#include "../SequenceArray.h"
+#include "../TimeoutException.h"
+#include "../util/ExceptionSupport.h"
+#include "../util/ThreadHints.h"
+#include "../util/Util.h"
+
+#include "ExceptionHandlerWrapper.h"
+#include "ThreadFactory.h"
+
+#include <atomic>
+#include <cstdint>
+#include <latch>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace disruptor::dsl {
+
+template <typename T, typename WaitStrategyT>
+class MultiLaneDisruptor;
+
+// Counterpart of EventHandlerGroup: the processors of one stage, which a
+// later stage waits for lane by lane.
+template <typename T, typename WaitStrategyT>
+class MultiLaneEventHandlerGroup final {
+public:
+  using DisruptorT = MultiLaneDisruptor<T, WaitStrategyT>;
+
+  MultiLaneEventHandlerGroup(DisruptorT& disruptor, std::vector<SequenceArray*> sequences)
+    : disruptor_(&disruptor), sequences_(std::move(sequences)) {}
+
+  MultiLaneEventHandlerGroup and_(const MultiLaneEventHandlerGroup& otherHandlerGroup) const {
+    std::vector<SequenceArray*> combined = sequences_;
+    combined.insert(combined.end(), otherHandlerGroup.sequences_.begin(),
+                    otherHandlerGroup.sequences_.end());
+    return MultiLaneEventHandlerGroup(*disruptor_, std::move(combined));
+  }
+
+  template <typename... Handlers>
+  MultiLaneEventHandlerGroup then(Handlers&... handlers) {
+    return handleEventsWith(handlers...);
+  }
+
+  template <typename... Handlers>
+  MultiLaneEventHandlerGroup handleEventsWith(Handlers&... handlers) {
+    return disruptor_->createEventProcessors(sequences_, handlers...);
+  }
+
+private:
+  DisruptorT* disruptor_;
+  std::vector<SequenceArray*> sequences_;
+};
+
+// A Disruptor whose ring is a MultiLaneRingBuffer. Each producer thread takes
+// its own lane with registerProducer() and publishes through it; handlers are
+// wired as on a Disruptor (handleEventsWith, then, after, and_). Every handler
+// runs on a MultiLaneEventProcessor on its own thread, whose per-lane
+// Sequences gate the lanes and feed the barriers of the next stage. Worker
+// pools, partitioned groups and custom processors are not offered.
+template <typename T, typename WaitStrategyT>
+class MultiLaneDisruptor final {
+public:
+  using RingBufferT = MultiLaneRingBuffer<T, WaitStrategyT>;
+  using LaneT = typename RingBufferT::LaneT;
+  using ProcessorT = MultiLaneEventProcessor<T, WaitStrategyT>;
+  using EventHandlerGroupT = MultiLaneEventHandlerGroup<T, WaitStrategyT>;
+
+  MultiLaneDisruptor(std::shared_ptr<EventFactory<T>> eventFactory,
+                     int laneCount,
+                     int laneSize,
+                     ThreadFactory& threadFactory)
+    : ownedWaitStrategy_(std::in_place)
+    , ringBuffer_(
+        RingBufferT::create(std::move(eventFactory), laneCount, laneSize, *ownedWaitStrategy_))
+    , threadFactory_(threadFactory) {}
+
+  MultiLaneDisruptor(std::shared_ptr<EventFactory<T>> eventFactory,
+                     int laneCount,
+                     int laneSize,
+                     ThreadFactory& threadFactory,
+                     WaitStrategyT& waitStrategy)
+    : ringBuffer_(RingBufferT::create(std::move(eventFactory), laneCount, laneSize, waitStrategy))
+    , threadFactory_(threadFactory) {}
+
+  // As with Disruptor, the consumer threads are always joined.
+  ~MultiLaneDisruptor() {
+    try {
+      halt();
+      join();
+    } catch (...) {
+      // Best-effort teardown; never throw from destructor.
+    }
+  }
+
+  MultiLaneDisruptor(const MultiLaneDisruptor&) = delete;
+  MultiLaneDisruptor& operator=(const MultiLaneDisruptor&) = delete;
+
+  template <typename... Handlers>
+  EventHandlerGroupT handleEventsWith(Handlers&... handlers) {
+    return createEventProcessors({}, handlers...);
+  }
+
+  template <typename... Handlers>
+  EventHandlerGroupT after(Handlers&... handlers) {
+    return EventHandlerGroupT(*this, {&getSequencesFor(handlers)...});
+  }
+
+  // Used by the processors created after this call.
+  void setDefaultExceptionHandler(ExceptionHandler<T>& exceptionHandler) {
+    checkNotStarted();
+    exceptionHandler_.switchTo(exceptionHandler);
+  }
+
+  // Each producer thread calls this once and publishes only through its lane.
+  LaneT& registerProducer() {
+    return ringBuffer_->registerProducer();
+  }
+
+  RingBufferT& getRingBuffer() {
+    return *ringBuffer_;
+  }
+
+  // For currentLane() inside a handler, or a per-handler exception handler.
+  ProcessorT& getProcessorFor(EventHandlerIdentity& handler) {
+    return *consumerFor(handler).processor;
+  }
+
+  SequenceArray& getSequencesFor(EventHandlerIdentity& handler) {
+    return consumerFor(handler).processor->getSequences();
+  }
+
+  int getProcessorCount() const {
+    return static_cast<int>(consumers_.size());
+  }
+
+  void start(std::latch* startupLatch = nullptr) {
+    bool expected = false;
+    if (!started_.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+      util::raise(std::runtime_error("Disruptor.start() must only be called once."));
+    }
+    for (const auto& consumer : consumers_) {
+      ProcessorT* processor = consumer->processor.get();
+      consumer->thread = threadFactory_.newThread([processor, startupLatch] {
+        if (startupLatch != nullptr) {
+          startupLatch->count_down();
+        }
+        processor->run();
+      });
+    }
+  }
+
+  void halt() {
+    for (const auto& consumer : consumers_) {
+      consumer->processor->halt();
+    }
+  }
+
+  void join() {
+    for (const auto& consumer : consumers_) {
+      if (consumer->thread.joinable()) {
+        consumer->thread.join();
+      }
+    }
+  }
+
+  void shutdown() {
+    shutdown(-1);
+  }
+
+  // Waits for the end-of-chain handlers to catch up with every lane, then
+  // halts; TimeoutException if they have not by the deadline.
+  void shutdown(int64_t timeoutMillis) {
+    const int64_t deadline =
+      timeoutMillis < 0 ? -1 : (util::Util::currentTimeMillis() + timeoutMillis);
+    while (hasBacklog()) {
+      if (deadline >= 0 && util::Util::currentTimeMillis() >= deadline) {
+        util::raise(TimeoutException::INSTANCE());
+      }
+      util::ThreadHints::onSpinWait();
+    }
+    halt();
+  }
+
+  // True if a running end-of-chain handler is behind the cursor of any lane.
+  bool hasBacklog() {
+    for (const auto& consumer : consumers_) {
+      if (!consumer->endOfChain || !consumer->processor->isRunning()) {
+        continue;
+      }
+      SequenceArray& sequences = consumer->processor->getSequences();
+      for (int lane = 0; lane < ringBuffer_->laneCount(); ++lane) {
+        if (ringBuffer_->lane(lane).getCursor() > sequences[lane].get()) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+private:
+  friend class MultiLaneEventHandlerGroup<T, WaitStrategyT>;
+
+  // The barrier is declared first so that it outlives its processor.
+  struct Consumer {
+    EventHandlerIdentity* handler;
+    std::shared_ptr<typename RingBufferT::BarrierT> barrier;
+    std::unique_ptr<ProcessorT> processor;
+    bool endOfChain{true};
+    std::thread thread;
+  };
+
+  // Declared before ringBuffer_, which holds a reference to it.
+  std::optional<WaitStrategyT> ownedWaitStrategy_;
+  std::shared_ptr<RingBufferT> ringBuffer_;
+  ThreadFactory& threadFactory_;
+  ExceptionHandlerWrapper<T> exceptionHandler_;
+  std::vector<std::unique_ptr<Consumer>> consumers_;
+  std::atomic<bool> started_{false};
+
+  void checkNotStarted() const {
+    if (started_.load(std::memory_order_acquire)) {
+      util::raise(std::runtime_error("All event handlers must be added before calling start."));
+    }
+  }
+
+  Consumer& consumerFor(EventHandlerIdentity& handler) {
+    for (const auto& consumer : consumers_) {
+      if (consumer->handler == &handler) {
+        return *consumer;
+      }
+    }
+    util::raise(std::invalid_argument("The event handler is not processing events."));
+  }
+
+  Consumer& consumerFor(const SequenceArray& sequences) {
+    for (const auto& consumer : consumers_) {
+      if (&consumer->processor->getSequences() == &sequences) {
+        return *consumer;
+      }
+    }
+    util::raise(std::invalid_argument("The sequences do not belong to a processor."));
+  }
+
+  // As Disruptor::createEventProcessors: the new processors gate every lane
+  // in place of the stage they wait for.
+  template <typename... Handlers>
+  EventHandlerGroupT createEventProcessors(const std::vector<SequenceArray*>& dependencies,
+                                           Handlers&... handlers) {
+    static_assert((std::is_base_of_v<EventHandlerBase<T>, Handlers> && ...),
+                  "MultiLaneDisruptor runs EventHandlers only");
+    checkNotStarted();
+    for (SequenceArray* dependency : dependencies) {
+      consumerFor(*dependency).endOfChain = false;
+    }
+    std::vector<SequenceArray*> sequences = {&createProcessor(dependencies, handlers)...};
+    for (SequenceArray* dependency : dependencies) {
+      ringBuffer_->removeGatingSequences(*dependency);
+    }
+    return EventHandlerGroupT(*this, std::move(sequences));
+  }
+
+  SequenceArray& createProcessor(const std::vector<SequenceArray*>& dependencies,
+                                 EventHandlerBase<T>& handler) {
+    auto consumer = std::make_unique<Consumer>();
+    consumer->handler = &handler;
+    consumer->barrier =
+      ringBuffer_->newBarrier(dependencies.data(), static_cast<int>(dependencies.size()));
+    consumer->processor = std::make_unique<ProcessorT>(*ringBuffer_, *consumer->barrier, handler);
+    consumer->processor->setExceptionHandler(exceptionHandler_);
+    SequenceArray& sequences = consumer->processor->getSequences();
+    ringBuffer_->addGatingSequences(sequences);
+    consumers_.push_back(std::move(consumer));
+    return sequences;
+  }
+};
+
+}  // namespace disruptor::dsl
@@ -10,7 +10,9 @@ enum class ProducerType {
   // Create a RingBuffer with a single event publisher to the RingBuffer
   SINGLE,
   // Create a RingBuffer supporting multiple event publishers to the one RingBuffer
-  MULTI
+  MULTI,
+  // C++-only: as MULTI, claiming through CombiningMultiProducerSequencer
+  MULTI_COMBINING
 };
 
 }  // namespace disruptor::dsl
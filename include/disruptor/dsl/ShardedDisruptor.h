@@ -0,0 +1,261 @@
+#pragma once
+// C++-only: key-sharded set of independent Disruptors behind one publish API
+// (no Java equivalent).
+
+#include "../EventFactory.h"
+#include "../EventTranslator.h"
+#include "../EventTranslatorOneArg.h"
+#include "../util/Util.h"
+
+#include "Disruptor.h"
+#include "ProducerType.h"
+#include "ThreadFactory.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <latch>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace disruptor::dsl {
+
+// Default key extractor: std::hash of the publish argument.
+struct HashKeyExtractor {
+  template <typename A>
+  std::uint64_t operator()(const A& arg) const {
+    return static_cast<std::uint64_t>(std::hash<A>{}(arg));
+  }
+};
+
+// Point-in-time view of one shard, read without stopping it.
+struct ShardMetrics {
+  int64_t cursor;                 // highest claimed sequence
+  int64_t minimumGatingSequence;  // slowest end-of-chain consumer
+  int64_t backlog;                // cursor - minimumGatingSequence
+  int64_t remainingCapacity;
+};
+
+// K Disruptors, each with its own ring, sequencer and consumers, behind one
+// publish API. publishEvent routes an argument to shard
+// keyExtractor(arg) % shardCount(), so one key always lands on one ring and
+// keeps its order there, while producers of different keys never touch the
+// same cursor. Consumers are wired per shard through shard(i), with the full
+// Disruptor DSL; start, halt, join, shutdown and hasBacklog act on every shard.
+template <typename T,
+          ProducerType Producer,
+          typename WaitStrategyT,
+          typename KeyExtractor = HashKeyExtractor>
+class ShardedDisruptor final {
+public:
+  using DisruptorT = Disruptor<T, Producer, WaitStrategyT>;
+  using RingBufferT = typename DisruptorT::RingBufferT;
+
+  // Each shard owns a default-constructed WaitStrategyT, so a blocking
+  // strategy only wakes the consumers of the shard that was published to.
+  ShardedDisruptor(const std::shared_ptr<EventFactory<T>>& eventFactory,
+                   int shardCount,
+                   int ringBufferSize,
+                   ThreadFactory& threadFactory,
+                   KeyExtractor keyExtractor = KeyExtractor())
+    : keyExtractor_(std::move(keyExtractor)) {
+    checkShardCount(shardCount);
+    shards_.reserve(static_cast<std::size_t>(shardCount));
+    for (int i = 0; i < shardCount; ++i) {
+      shards_.push_back(std::make_unique<DisruptorT>(eventFactory, ringBufferSize, threadFactory));
+    }
+  }
+
+  // All shards share waitStrategy.
+  ShardedDisruptor(const std::shared_ptr<EventFactory<T>>& eventFactory,
+                   int shardCount,
+                   int ringBufferSize,
+                   ThreadFactory& threadFactory,
+                   WaitStrategyT& waitStrategy,
+                   KeyExtractor keyExtractor = KeyExtractor())
+    : keyExtractor_(std::move(keyExtractor)) {
+    checkShardCount(shardCount);
+    shards_.reserve(static_cast<std::size_t>(shardCount));
+    for (int i = 0; i < shardCount; ++i) {
+      shards_.push_back(
+        std::make_unique<DisruptorT>(eventFactory, ringBufferSize, threadFactory, waitStrategy));
+    }
+  }
+
+  int shardCount() const {
+    return static_cast<int>(shards_.size());
+  }
+
+  DisruptorT& shard(int index) {
+    return *shards_[static_cast<std::size_t>(index)];
+  }
+
+  int shardFor(std::uint64_t keyHash) const {
+    return static_cast<int>(keyHash % static_cast<std::uint64_t>(shards_.size()));
+  }
+
+  template <typename A>
+  int shardOf(const A& arg) const {
+    return shardFor(static_cast<std::uint64_t>(keyExtractor_(arg)));
+  }
+
+  // Publishing
+
+  template <typename A>
+  void publishEvent(EventTranslatorOneArg<T, A>& translator, A arg0) {
+    shard(shardOf(arg0)).getRingBuffer().publishEvent(translator, arg0);
+  }
+
+  template <typename A>
+  bool tryPublishEvent(EventTranslatorOneArg<T, A>& translator, A arg0) {
+    return shard(shardOf(arg0)).getRingBuffer().tryPublishEvent(translator, arg0);
+  }
+
+  // For events whose key is not an argument: the caller supplies its hash.
+  void publishEvent(std::uint64_t keyHash, EventTranslator<T>& translator) {
+    shard(shardFor(keyHash)).getRingBuffer().publishEvent(translator);
+  }
+
+  // Publishes one event per element of args, split across shards: every
+  // shard hit by a chunk of up to kRouteChunk arguments gets one next(n) and
+  // one publish(lo, hi) for its share of the chunk, in argument order.
+  // Arguments of one shard must fit its ring. If translator throws, the
+  // claimed range of the shard being filled is still published (like
+  // RingBuffer::publishEvents) and later arguments are not.
+  template <typename A>
+  void publishEvents(EventTranslatorOneArg<T, A>& translator, std::span<const A> args) {
+    std::array<int, kRouteChunk> shardOfArg;
+    for (std::size_t chunkStart = 0; chunkStart < args.size(); chunkStart += kRouteChunk) {
+      const std::size_t chunkSize = (std::min)(kRouteChunk, args.size() - chunkStart);
+      const std::span<const A> chunk = args.subspan(chunkStart, chunkSize);
+      for (std::size_t i = 0; i < chunkSize; ++i) {
+        shardOfArg[i] = shardOf(chunk[i]);
+      }
+      for (std::size_t first = 0; first < chunkSize; ++first) {
+        const int target = shardOfArg[first];
+        if (target < 0) {
+          continue;
+        }
+        int count = 0;
+        for (std::size_t i = first; i < chunkSize; ++i) {
+          count += shardOfArg[i] == target ? 1 : 0;
+        }
+        publishShare(translator, chunk, shardOfArg, first, target, count);
+      }
+    }
+  }
+
+  // Lifecycle, applied to every shard. As with Disruptor, shutdown() and
+  // hasBacklog() only see consumers that are running: pass a startupLatch
+  // counting getProcessorCount() and wait on it before relying on them.
+
+  void start(std::latch* startupLatch = nullptr) {
+    for (const auto& s : shards_) {
+      s->start(startupLatch);
+    }
+  }
+
+  void halt() {
+    for (const auto& s : shards_) {
+      s->halt();
+    }
+  }
+
+  void join() {
+    for (const auto& s : shards_) {
+      s->join();
+    }
+  }
+
+  void shutdown() {
+    for (const auto& s : shards_) {
+      s->shutdown();
+    }
+  }
+
+  // One deadline for all shards; TimeoutException if any shard still has a
+  // backlog at the deadline (the shards drained before it are halted).
+  void shutdown(int64_t timeoutMillis) {
+    const int64_t deadline =
+      timeoutMillis < 0 ? -1 : (util::Util::currentTimeMillis() + timeoutMillis);
+    for (const auto& s : shards_) {
+      int64_t remaining = -1;
+      if (deadline >= 0) {
+        remaining = (std::max)(int64_t{0}, deadline - util::Util::currentTimeMillis());
+      }
+      s->shutdown(remaining);
+    }
+  }
+
+  bool hasBacklog() {
+    for (const auto& s : shards_) {
+      if (s->hasBacklog()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  int getProcessorCount() const {
+    int count = 0;
+    for (const auto& s : shards_) {
+      count += s->getProcessorCount();
+    }
+    return count;
+  }
+
+  ShardMetrics metrics(int index) {
+    RingBufferT& ringBuffer = shard(index).getRingBuffer();
+    const int64_t minimumGatingSequence = ringBuffer.getMinimumGatingSequence();
+    const int64_t cursor = ringBuffer.getCursor();
+    return ShardMetrics{cursor, minimumGatingSequence, cursor - minimumGatingSequence,
+                        ringBuffer.remainingCapacity()};
+  }
+
+private:
+  static constexpr std::size_t kRouteChunk = 256;
+
+  std::vector<std::unique_ptr<DisruptorT>> shards_;
+  KeyExtractor keyExtractor_;
+
+  static void checkShardCount(int shardCount) {
+    if (shardCount < 1) {
+      throw std::invalid_argument("shardCount must be at least 1");
+    }
+  }
+
+  // Claims count sequences on target and translates the arguments routed to
+  // it from first onwards, marking them done (-1).
+  template <typename A>
+  void publishShare(EventTranslatorOneArg<T, A>& translator,
+                    std::span<const A> chunk,
+                    std::array<int, kRouteChunk>& shardOfArg,
+                    std::size_t first,
+                    int target,
+                    int count) {
+    RingBufferT& ringBuffer = shard(target).getRingBuffer();
+    const int64_t hi = ringBuffer.next(count);
+    const int64_t lo = hi - (count - 1);
+    try {
+      int64_t sequence = lo;
+      for (std::size_t i = first; sequence <= hi; ++i) {
+        if (shardOfArg[i] == target) {
+          shardOfArg[i] = -1;
+          translator.translateTo(ringBuffer.get(sequence), sequence, chunk[i]);
+          ++sequence;
+        }
+      }
+    } catch (...) {
+      ringBuffer.publish(lo, hi);
+      throw;
+    }
+    ringBuffer.publish(lo, hi);
+  }
+};
+
+}  // namespace disruptor::dsl
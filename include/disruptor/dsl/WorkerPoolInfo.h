@@ -0,0 +1,63 @@
+#pragma once
+// Port of com.lmax.disruptor.dsl.WorkerPoolInfo from Disruptor 3.x (removed
+// in 4.0, so there is no source under reference/).
+
+#include "../Sequence.h"
+#include "ConsumerInfo.h"
+#include "ThreadFactory.h"
+
+#include <latch>
+#include <vector>
+
+namespace disruptor::dsl {
+
+template <typename BarrierPtrT, typename WorkerPoolT>
+class WorkerPoolInfo final : public ConsumerInfo<BarrierPtrT> {
+public:
+  WorkerPoolInfo(WorkerPoolT& workerPool, BarrierPtrT barrier)
+    : workerPool_(&workerPool), barrier_(barrier), sequences_(workerPool.getWorkerSequences()) {}
+
+  Sequence* const* getSequences() override {
+    return sequences_.data();
+  }
+
+  int getSequenceCount() const override {
+    return static_cast<int>(sequences_.size());
+  }
+
+  BarrierPtrT getBarrier() override {
+    return barrier_;
+  }
+
+  bool isEndOfChain() override {
+    return endOfChain_;
+  }
+
+  void start(ThreadFactory& threadFactory, std::latch* startupLatch) override {
+    workerPool_->start(threadFactory, startupLatch);
+  }
+
+  void halt() override {
+    workerPool_->halt();
+  }
+
+  void join() override {
+    workerPool_->join();
+  }
+
+  void markAsUsedInBarrier() override {
+    endOfChain_ = false;
+  }
+
+  bool isRunning() override {
+    return workerPool_->isRunning();
+  }
+
+private:
+  WorkerPoolT* workerPool_;
+  BarrierPtrT barrier_;
+  std::vector<Sequence*> sequences_;
+  bool endOfChain_{true};
+};
+
+}  // namespace disruptor::dsl
@@ -0,0 +1,40 @@
+#pragma once
+// C++-only: lets the ring and consumer headers build with and without C++
+// exceptions (-fno-exceptions), like libstdc++'s __try/__catch.
+
+#include <cstdio>
+#include <cstdlib>
+
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#  define DISRUPTOR_EXCEPTIONS 1
+#else
+#  define DISRUPTOR_EXCEPTIONS 0
+#endif
+
+// Cleanup-and-rethrow blocks: without exceptions the try body always runs and
+// the handler is dead code.
+#if DISRUPTOR_EXCEPTIONS
+#  define DISRUPTOR_TRY try
+#  define DISRUPTOR_CATCH_ALL catch (...)
+#  define DISRUPTOR_RETHROW throw
+#else
+#  define DISRUPTOR_TRY if (true)
+#  define DISRUPTOR_CATCH_ALL if (false)
+#  define DISRUPTOR_RETHROW ((void)0)
+#endif
+
+namespace disruptor::util {
+
+// Throws exception; without exceptions, reports its what() and aborts, as an
+// uncaught exception would.
+template <typename E>
+[[noreturn]] void raise(const E& exception) {
+#if DISRUPTOR_EXCEPTIONS
+  throw exception;
+#else
+  std::fprintf(stderr, "disruptor: %s\n", exception.what());
+  std::abort();
+#endif
+}
+
+}  // namespace disruptor::util
@@ -0,0 +1,249 @@
+#pragma once
+// C++-only: allocator for ring slots and sequencer metadata with optional huge
+// pages, NUMA binding, pre-faulting and mlock (no Java equivalent; the JVM
+// controls this via -XX:+UseLargePages / -XX:+UseNUMA / -XX:+AlwaysPreTouch).
+
+#include "ExceptionSupport.h"
+#include "Numa.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <system_error>
+#include <unordered_map>
+
+#if defined(__linux__)
+#  include <sys/mman.h>
+#  include <unistd.h>
+
+#  include <cerrno>
+#endif
+
+namespace disruptor::util {
+
+enum class PageSize {
+  // Regular heap allocation (std::allocator); the other settings still apply
+  // to mmap-backed memory when prefault or lock is requested.
+  DEFAULT,
+  // MAP_HUGETLB 2 MB pages, falling back to transparent huge pages
+  // (madvise(MADV_HUGEPAGE) on a 2 MB aligned mapping) if none are reserved.
+  HUGE_2MB,
+  // MAP_HUGETLB 1 GB pages, same fallback.
+  HUGE_1GB,
+};
+
+// Where and how a large, long-lived buffer is backed. The default is a plain
+// heap allocation, i.e. what std::vector would do.
+struct MemoryPolicy {
+  PageSize pageSize = PageSize::DEFAULT;
+  // Touch every page at allocation so the first lap of the ring takes no
+  // page faults.
+  bool prefault = false;
+  // mlock the buffer so it is never paged out. Throws std::system_error from
+  // allocate() if the memlock limit is too low.
+  bool lock = false;
+  // mbind the buffer to this NUMA node (kAnyNumaNode: first touch). Throws
+  // std::system_error from allocate() if the node cannot be bound.
+  int numaNode = kAnyNumaNode;
+
+  bool usesMapping() const noexcept {
+    return pageSize != PageSize::DEFAULT || prefault || lock || numaNode != kAnyNumaNode;
+  }
+
+  friend bool operator==(const MemoryPolicy&, const MemoryPolicy&) = default;
+};
+
+namespace detail {
+
+#if defined(__linux__)
+inline std::size_t hugePageBytes(PageSize pageSize) {
+  return pageSize == PageSize::HUGE_1GB ? std::size_t{1} << 30 : std::size_t{2} << 20;
+}
+
+inline std::size_t roundToPages(std::size_t bytes, std::size_t page) {
+  return (bytes + page - 1) / page * page;
+}
+
+// Length of each live mapping, by address. It depends on which page size the
+// mapping actually got (a HUGE_1GB request that falls back to transparent huge
+// pages is rounded to 2 MB, not 1 GB), so deallocate() cannot recompute it.
+class MappingSizes {
+public:
+  static void add(void* memory, std::size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex());
+    sizes().emplace(memory, bytes);
+  }
+
+  static std::size_t find(const void* memory) {
+    std::lock_guard<std::mutex> lock(mutex());
+    const auto it = sizes().find(memory);
+    return it == sizes().end() ? 0 : it->second;
+  }
+
+  static std::size_t take(void* memory) {
+    std::lock_guard<std::mutex> lock(mutex());
+    const auto it = sizes().find(memory);
+    const std::size_t bytes = it->second;
+    sizes().erase(it);
+    return bytes;
+  }
+
+private:
+  static std::mutex& mutex() {
+    static std::mutex instance;
+    return instance;
+  }
+
+  static std::unordered_map<const void*, std::size_t>& sizes() {
+    static std::unordered_map<const void*, std::size_t> instance;
+    return instance;
+  }
+};
+
+inline void prefault(void* memory, std::size_t bytes) {
+  const auto page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+  auto* p = static_cast<volatile std::byte*>(memory);
+  for (std::size_t offset = 0; offset < bytes; offset += page) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    p[offset] = std::byte{0};
+  }
+}
+
+// Anonymous mapping of `bytes` (a multiple of the page size) aligned to
+// `alignment`: over-map and trim both ends, so transparent huge pages can
+// back it.
+inline void* mapAligned(std::size_t bytes, std::size_t alignment) {
+  void* raw = ::mmap(nullptr, bytes + alignment, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (raw == MAP_FAILED) {
+    util::raise(std::bad_alloc());
+  }
+  const auto start = reinterpret_cast<std::uintptr_t>(raw);
+  const auto aligned = (start + alignment - 1) / alignment * alignment;
+  const std::size_t head = aligned - start;
+  if (head != 0) {
+    ::munmap(raw, head);
+  }
+  const std::size_t tail = alignment - head;
+  if (tail != 0) {
+    ::munmap(reinterpret_cast<void*>(aligned + bytes), tail);
+  }
+  return reinterpret_cast<void*>(aligned);
+}
+
+// Maps at least `requested` bytes, rounded to the page size the mapping
+// actually uses, and records that length in MappingSizes.
+inline void* mapMemory(std::size_t requested, const MemoryPolicy& policy) {
+  // With a NUMA node the pages must be bound before they are touched, so
+  // MAP_POPULATE is replaced by a manual pre-fault after mbind.
+  const bool populate = policy.prefault && policy.numaNode == kAnyNumaNode;
+  bool populated = false;
+  void* memory = MAP_FAILED;
+  std::size_t bytes;
+  if (policy.pageSize != PageSize::DEFAULT) {
+    const int sizeFlag = policy.pageSize == PageSize::HUGE_1GB ? (30 << MAP_HUGE_SHIFT)
+                                                                : (21 << MAP_HUGE_SHIFT);
+    bytes = roundToPages(requested, hugePageBytes(policy.pageSize));
+    memory = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | sizeFlag
+                      | (populate ? MAP_POPULATE : 0),
+                    -1, 0);
+    populated = populate;
+    if (memory == MAP_FAILED) {
+      // No reserved hugetlb pages of that size: ask for THP instead, which
+      // come in 2 MB whatever was asked for. Populate only after madvise, or
+      // the range is faulted in with 4 KB pages.
+      const std::size_t thpBytes = hugePageBytes(PageSize::HUGE_2MB);
+      bytes = roundToPages(requested, thpBytes);
+      memory = mapAligned(bytes, thpBytes);
+      ::madvise(memory, bytes, MADV_HUGEPAGE);
+      populated = false;
+    }
+  } else {
+    bytes = roundToPages(requested, static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)));
+    memory = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | (populate ? MAP_POPULATE : 0), -1, 0);
+    if (memory == MAP_FAILED) {
+      util::raise(std::bad_alloc());
+    }
+    populated = populate;
+  }
+
+  if (policy.numaNode != kAnyNumaNode) {
+    DISRUPTOR_TRY {
+      Numa::bindMemory(memory, bytes, policy.numaNode);
+    }
+    DISRUPTOR_CATCH_ALL {
+      ::munmap(memory, bytes);
+      DISRUPTOR_RETHROW;
+    }
+  }
+  if (policy.prefault && !populated) {
+    prefault(memory, bytes);
+  }
+  if (policy.lock && ::mlock(memory, bytes) != 0) {
+    const int error = errno;
+    ::munmap(memory, bytes);
+    util::raise(std::system_error(error, std::generic_category(), "mlock of ring storage failed"));
+  }
+  MappingSizes::add(memory, bytes);
+  return memory;
+}
+#endif
+
+}  // namespace detail
+
+// Stateful std::allocator replacement carrying a MemoryPolicy. With the
+// default policy it forwards to std::allocator, so containers using it by
+// default behave exactly as before. Otherwise each allocation is its own
+// anonymous mapping; meant for a few large buffers allocated once, not for
+// general use. On non-Linux platforms the policy is ignored.
+template <typename T>
+class MappedAllocator {
+public:
+  using value_type = T;
+
+  MappedAllocator() noexcept = default;
+
+  explicit MappedAllocator(const MemoryPolicy& policy) noexcept : policy_(policy) {}
+
+  template <typename U>
+  MappedAllocator(const MappedAllocator<U>& other) noexcept  // NOLINT(google-explicit-constructor)
+    : policy_(other.policy()) {}
+
+  T* allocate(std::size_t n) {
+#if defined(__linux__)
+    if (policy_.usesMapping()) {
+      static_assert(alignof(T) <= 4096, "MappedAllocator supports alignment up to a page");
+      return static_cast<T*>(detail::mapMemory(n * sizeof(T), policy_));
+    }
+#endif
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T* p, std::size_t n) noexcept {
+#if defined(__linux__)
+    if (policy_.usesMapping()) {
+      ::munmap(p, detail::MappingSizes::take(p));
+      return;
+    }
+#endif
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  const MemoryPolicy& policy() const noexcept {
+    return policy_;
+  }
+
+  template <typename U>
+  bool operator==(const MappedAllocator<U>& other) const noexcept {
+    return policy_ == other.policy();
+  }
+
+private:
+  MemoryPolicy policy_;
+};
+
+}  // namespace disruptor::util
@@ -0,0 +1,128 @@
+#pragma once
+// C++-only: NUMA node discovery, memory binding and thread pinning used by
+// MappedAllocator and NumaThreadFactory (no Java equivalent; the JVM only has
+// -XX:+UseNUMA). Talks to sysfs and the mbind syscall directly so there is no
+// libnuma dependency. On non-Linux platforms every call is a no-op.
+
+#include "ExceptionSupport.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#  include <sched.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+
+#  include <cerrno>
+#  include <fstream>
+#  include <system_error>
+#endif
+
+namespace disruptor::util {
+
+// MemoryPolicy::numaNode value meaning "wherever the kernel puts it"
+// (first touch).
+inline constexpr int kAnyNumaNode = -1;
+
+class Numa {
+public:
+  // Number of configured nodes; 1 when the topology is not visible.
+  static int nodeCount() {
+    int count = 0;
+#if defined(__linux__)
+    while (std::ifstream(nodePath(count) + "/cpulist").good()) {
+      ++count;
+    }
+#endif
+    return count == 0 ? 1 : count;
+  }
+
+  // CPUs of `node` from /sys/devices/system/node/node<N>/cpulist
+  // ("0-3,8-11"); empty if the node does not exist or sysfs is unavailable.
+  static std::vector<int> cpusOfNode(int node) {
+    std::vector<int> cpus;
+#if defined(__linux__)
+    std::ifstream in(nodePath(node) + "/cpulist");
+    std::string list;
+    if (!std::getline(in, list)) {
+      return cpus;
+    }
+    std::size_t pos = 0;
+    while (pos < list.size()) {
+      std::size_t end = list.find(',', pos);
+      if (end == std::string::npos) {
+        end = list.size();
+      }
+      const std::string range = list.substr(pos, end - pos);
+      const std::size_t dash = range.find('-');
+      if (!range.empty()) {
+        const int first = std::stoi(range.substr(0, dash));
+        const int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+        for (int cpu = first; cpu <= last; ++cpu) {
+          cpus.push_back(cpu);
+        }
+      }
+      pos = end + 1;
+    }
+#else
+    (void)node;
+#endif
+    return cpus;
+  }
+
+  // mbind(MPOL_BIND) a page-aligned range to `node`, migrating pages that are
+  // already resident. Throws std::system_error if the kernel rejects it
+  // (unknown node, no memory on the node, or mbind blocked by seccomp).
+  static void bindMemory(void* memory, std::size_t bytes, int node) {
+#if defined(__linux__)
+    constexpr int kMpolBind = 2;
+    constexpr unsigned kMpolMfMove = 1U << 1;
+    constexpr std::size_t kBitsPerWord = sizeof(unsigned long) * 8;
+    const auto bit = static_cast<std::size_t>(node);
+    std::vector<unsigned long> nodeMask(bit / kBitsPerWord + 1, 0);
+    nodeMask[bit / kBitsPerWord] = 1UL << (bit % kBitsPerWord);
+    // The kernel reads maxnode - 1 bits.
+    const unsigned long maxNode = nodeMask.size() * kBitsPerWord + 1;
+    if (::syscall(SYS_mbind, memory, bytes, kMpolBind, nodeMask.data(), maxNode, kMpolMfMove)
+        != 0) {
+      util::raise(std::system_error(errno, std::generic_category(), "mbind to NUMA node failed"));
+    }
+#else
+    (void)memory;
+    (void)bytes;
+    (void)node;
+#endif
+  }
+
+  // Restrict the calling thread to the CPUs of `node`. Returns false (and
+  // leaves the affinity alone) if the node's CPUs are unknown or the call is
+  // refused.
+  static bool pinCurrentThreadToNode(int node) {
+#if defined(__linux__)
+    const std::vector<int> cpus = cpusOfNode(node);
+    if (cpus.empty()) {
+      return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus) {
+      CPU_SET(cpu, &set);
+    }
+    return ::sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    (void)node;
+    return false;
+#endif
+  }
+
+private:
+#if defined(__linux__)
+  static std::string nodePath(int node) {
+    return "/sys/devices/system/node/node" + std::to_string(node);
+  }
+#endif
+};
+
+}  // namespace disruptor::util
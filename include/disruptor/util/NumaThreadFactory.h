@@ -0,0 +1,36 @@
+#pragma once
+// C++-only: ThreadFactory that runs every thread on the CPUs of one NUMA node
+// (no Java equivalent).
+
+#include "../dsl/ThreadFactory.h"
+#include "Numa.h"
+
+#include <functional>
+#include <thread>
+#include <utility>
+
+namespace disruptor::util {
+
+// Pass to dsl::Disruptor together with a MemoryPolicy on the same node so the
+// consumers run next to the ring and their sequences. A thread that cannot be
+// pinned (unknown node, affinity refused) runs unpinned.
+class NumaThreadFactory final : public disruptor::dsl::ThreadFactory {
+public:
+  explicit NumaThreadFactory(int numaNode) : numaNode_(numaNode) {}
+
+  std::thread newThread(std::function<void()> r) override {
+    return std::thread([numaNode = numaNode_, r = std::move(r)] {
+      Numa::pinCurrentThreadToNode(numaNode);
+      r();
+    });
+  }
+
+  int numaNode() const {
+    return numaNode_;
+  }
+
+private:
+  int numaNode_;
+};
+
+}  // namespace disruptor::util
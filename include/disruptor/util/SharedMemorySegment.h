@@ -0,0 +1,188 @@
+#pragma once
+// C++-only: owning handle to a MAP_SHARED memory segment, either an anonymous
+// memfd or a named POSIX shared memory object under /dev/shm (no Java
+// equivalent; used by SharedMemoryRingBuffer).
+
+#include "ExceptionSupport.h"
+
+#include <cstddef>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#if defined(__linux__)
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+
+#  include <cerrno>
+#endif
+
+namespace disruptor::util {
+
+// Move-only. The destructor unmaps and closes the descriptor; it does not
+// unlink a named object (see unlink()), so other processes can keep
+// attaching. Throws std::system_error on any failing call and on platforms
+// without memfd / POSIX shared memory.
+class SharedMemorySegment {
+public:
+  // Anonymous segment, shared by handing fd() to another process (inherited
+  // across fork/exec, or sent over a Unix socket with SCM_RIGHTS).
+  static SharedMemorySegment createAnonymous(std::size_t bytes,
+                                             const char* debugName = "disruptor") {
+#if defined(__linux__)
+    const int fd = ::memfd_create(debugName, MFD_CLOEXEC);
+    if (fd < 0) {
+      throwLastError("memfd_create");
+    }
+    return sized(fd, bytes);
+#else
+    (void)bytes;
+    (void)debugName;
+    throwUnsupported();
+#endif
+  }
+
+  // Named segment /dev/shm/<name> (name without the leading slash). Fails if
+  // it already exists.
+  static SharedMemorySegment create(const std::string& name, std::size_t bytes) {
+#if defined(__linux__)
+    const int fd = ::shm_open(("/" + name).c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+    if (fd < 0) {
+      throwLastError("shm_open");
+    }
+    return sized(fd, bytes);
+#else
+    (void)name;
+    (void)bytes;
+    throwUnsupported();
+#endif
+  }
+
+  static SharedMemorySegment open(const std::string& name) {
+#if defined(__linux__)
+    const int fd = ::shm_open(("/" + name).c_str(), O_RDWR | O_CLOEXEC, 0);
+    if (fd < 0) {
+      throwLastError("shm_open");
+    }
+    return mapped(fd);
+#else
+    (void)name;
+    throwUnsupported();
+#endif
+  }
+
+  // Maps a segment received as a descriptor. Takes ownership of fd.
+  static SharedMemorySegment fromFd(int fd) {
+#if defined(__linux__)
+    return mapped(fd);
+#else
+    (void)fd;
+    throwUnsupported();
+#endif
+  }
+
+  static void unlink(const std::string& name) {
+#if defined(__linux__)
+    ::shm_unlink(("/" + name).c_str());
+#else
+    (void)name;
+#endif
+  }
+
+  SharedMemorySegment(SharedMemorySegment&& other) noexcept
+    : fd_(std::exchange(other.fd_, -1))
+    , data_(std::exchange(other.data_, nullptr))
+    , size_(std::exchange(other.size_, 0)) {}
+
+  SharedMemorySegment& operator=(SharedMemorySegment&& other) noexcept {
+    if (this != &other) {
+      release();
+      fd_ = std::exchange(other.fd_, -1);
+      data_ = std::exchange(other.data_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+  }
+
+  SharedMemorySegment(const SharedMemorySegment&) = delete;
+  SharedMemorySegment& operator=(const SharedMemorySegment&) = delete;
+
+  ~SharedMemorySegment() {
+    release();
+  }
+
+  void* data() const noexcept {
+    return data_;
+  }
+
+  std::size_t size() const noexcept {
+    return size_;
+  }
+
+  int fd() const noexcept {
+    return fd_;
+  }
+
+private:
+  int fd_;
+  void* data_;
+  std::size_t size_;
+
+  SharedMemorySegment(int fd, void* data, std::size_t size) noexcept
+    : fd_(fd), data_(data), size_(size) {}
+
+  void release() noexcept {
+#if defined(__linux__)
+    if (data_ != nullptr) {
+      ::munmap(data_, size_);
+    }
+    if (fd_ >= 0) {
+      ::close(fd_);
+    }
+#endif
+    fd_ = -1;
+    data_ = nullptr;
+    size_ = 0;
+  }
+
+#if defined(__linux__)
+  [[noreturn]] static void throwLastError(const char* what) {
+    util::raise(std::system_error(errno, std::generic_category(), what));
+  }
+
+  static SharedMemorySegment sized(int fd, std::size_t bytes) {
+    if (::ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+      const int error = errno;
+      ::close(fd);
+      util::raise(std::system_error(error, std::generic_category(), "ftruncate"));
+    }
+    return mapped(fd);
+  }
+
+  static SharedMemorySegment mapped(int fd) {
+    struct stat st {};
+    if (::fstat(fd, &st) != 0) {
+      const int error = errno;
+      ::close(fd);
+      util::raise(std::system_error(error, std::generic_category(), "fstat"));
+    }
+    const auto size = static_cast<std::size_t>(st.st_size);
+    void* data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED) {
+      const int error = errno;
+      ::close(fd);
+      util::raise(std::system_error(error, std::generic_category(), "mmap"));
+    }
+    return SharedMemorySegment(fd, data, size);
+  }
+#else
+  [[noreturn]] static void throwUnsupported() {
+    util::raise(std::system_error(std::make_error_code(std::errc::function_not_supported),
+                                  "shared memory segments are only implemented on Linux"));
+  }
+#endif
+};
+
+}  // namespace disruptor::util
@@ -4,6 +4,7 @@
 
 #include "../EventProcessor.h"
 #include "../Sequence.h"
+#include "ExceptionSupport.h"
 
 #include <algorithm>
 #include <bit>
@@ -26,7 +27,7 @@ public:
   static int ceilingNextPowerOfTwo(int x) {
     // Java: 1 << (Integer.SIZE - Integer.numberOfLeadingZeros(x - 1))
     if (x <= 0) {
-      throw std::invalid_argument("x must be a positive number");
+      util::raise(std::invalid_argument("x must be a positive number"));
     }
     uint32_t v = static_cast<uint32_t>(x - 1);
     // C++20: use std::countl_zero to count leading zeros
@@ -46,7 +47,8 @@ public:
       if (!seq) {
         continue;
       }
-      int64_t value = seq->get();
+      // A follower (Sequence::follow) reads as the Sequence it follows.
+      int64_t value = seq->gatingTarget()->get();
       // Guard against Windows macro min()
       minimumSequence = (std::min)(minimumSequence, value);
     }
@@ -82,7 +84,7 @@ public:
 
   static int log2(int value) {
     if (value < 1) {
-      throw std::invalid_argument("value must be a positive number");
+      util::raise(std::invalid_argument("value must be a positive number"));
     }
     // Java: Integer.SIZE - Integer.numberOfLeadingZeros(value) - 1
     // C++20: use std::bit_width to get the number of bits needed, then subtract 1
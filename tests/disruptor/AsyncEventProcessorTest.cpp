@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/AsyncEventProcessor.h"
+#include "disruptor/AsyncWaitStrategy.h"
+#include "disruptor/CoroutineScheduler.h"
+#include "disruptor/EventHandler.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/Sequence.h"
+#include "tests/disruptor/support/LongEvent.h"
+
+#include <cstdint>
+#include <functional>
+#include <latch>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+using Event = disruptor::support::LongEvent;
+using WS = disruptor::AsyncWaitStrategy;
+using RB = disruptor::SingleProducerRingBuffer<Event, WS>;
+using Barrier = std::remove_reference_t<decltype(*std::declval<RB&>().newBarrier())>;
+using Processor = disruptor::AsyncEventProcessor<Event, Barrier, RB>;
+
+class RecordingHandler final : public disruptor::EventHandler<Event> {
+public:
+  void onEvent(Event& event, int64_t sequence, bool /*endOfBatch*/) override {
+    values_.push_back(event.get());
+    if (sequence == lastSequence_ && onLast_) {
+      onLast_();
+    }
+  }
+
+  void onStart() override {
+    started_ = true;
+  }
+
+  void onShutdown() override {
+    shutdown_ = true;
+  }
+
+  std::vector<int64_t> values_;
+  int64_t lastSequence_{-1};
+  std::function<void()> onLast_;
+  bool started_{false};
+  bool shutdown_{false};
+};
+
+disruptor::ScheduledTask produce(RB& ringBuffer, int count, int batchSize) {
+  for (int published = 0; published < count; published += batchSize) {
+    const int64_t hi = co_await ringBuffer.nextAsync(batchSize);
+    for (int64_t sequence = hi - batchSize + 1; sequence <= hi; ++sequence) {
+      ringBuffer.get(sequence).set(sequence * 10);
+    }
+    ringBuffer.publish(hi - batchSize + 1, hi);
+  }
+}
+
+disruptor::ScheduledTask awaitSequence(Barrier& barrier,
+                                       int64_t sequence,
+                                       disruptor::WaitResult& result) {
+  do {
+    result = co_await barrier.waitForAsync(sequence);
+  } while (result && *result < sequence);
+}
+}  // namespace
+
+TEST(AsyncEventProcessorTest, shouldSuspendProducerOnFullRingOnOneThread) {
+  WS ws;
+  auto ringBuffer = RB::createSingleProducer(Event::FACTORY, 4, ws);
+  auto barrier = ringBuffer->newBarrier();
+  RecordingHandler handler;
+  Processor processor(*ringBuffer, *barrier, ws, handler);
+  ringBuffer->addGatingSequences(processor.getSequence());
+  handler.lastSequence_ = 99;
+  handler.onLast_ = [&] { processor.halt(); };
+
+  disruptor::CoroutineScheduler scheduler;
+  scheduler.spawn(produce(*ringBuffer, 100, 2));
+  scheduler.spawn(processor.run());
+  scheduler.run();
+
+  ASSERT_EQ(100U, handler.values_.size());
+  for (std::size_t i = 0; i < handler.values_.size(); ++i) {
+    ASSERT_EQ(static_cast<int64_t>(i) * 10, handler.values_[i]);
+  }
+  EXPECT_TRUE(handler.started_);
+  EXPECT_TRUE(handler.shutdown_);
+  EXPECT_EQ(99, processor.getSequence().get());
+}
+
+TEST(AsyncEventProcessorTest, shouldRunDependentConsumersOnOneScheduler) {
+  WS ws;
+  auto ringBuffer = RB::createSingleProducer(Event::FACTORY, 8, ws);
+  auto firstBarrier = ringBuffer->newBarrier();
+  RecordingHandler first;
+  Processor firstProcessor(*ringBuffer, *firstBarrier, ws, first);
+
+  disruptor::Sequence* dependency = &firstProcessor.getSequence();
+  auto secondBarrier = ringBuffer->newBarrier(&dependency, 1);
+  RecordingHandler second;
+  Processor secondProcessor(*ringBuffer, *secondBarrier, ws, second, 3);
+  ringBuffer->addGatingSequences(secondProcessor.getSequence());
+
+  second.lastSequence_ = 49;
+  second.onLast_ = [&] {
+    firstProcessor.halt();
+    secondProcessor.halt();
+  };
+
+  disruptor::CoroutineScheduler scheduler;
+  scheduler.spawn(secondProcessor.run());
+  scheduler.spawn(firstProcessor.run());
+  scheduler.spawn(produce(*ringBuffer, 50, 1));
+  scheduler.run();
+
+  EXPECT_EQ(first.values_, second.values_);
+  ASSERT_EQ(50U, second.values_.size());
+  EXPECT_EQ(490, second.values_.back());
+}
+
+TEST(AsyncEventProcessorTest, shouldResumeConsumerOnPublishFromAnotherThread) {
+  WS ws;
+  auto ringBuffer = RB::createSingleProducer(Event::FACTORY, 16, ws);
+  auto barrier = ringBuffer->newBarrier();
+  RecordingHandler handler;
+  Processor processor(*ringBuffer, *barrier, ws, handler, 4);
+  ringBuffer->addGatingSequences(processor.getSequence());
+  handler.lastSequence_ = 999;
+  handler.onLast_ = [&] { processor.halt(); };
+
+  disruptor::CoroutineScheduler scheduler;
+  scheduler.spawn(processor.run());
+  std::latch started(1);
+  std::thread consumer([&] {
+    started.count_down();
+    scheduler.run();
+  });
+  started.wait();
+
+  for (int i = 0; i < 1000; ++i) {
+    const int64_t sequence = ringBuffer->next();
+    ringBuffer->get(sequence).set(sequence);
+    ringBuffer->publish(sequence);
+  }
+  consumer.join();
+
+  ASSERT_EQ(1000U, handler.values_.size());
+  EXPECT_EQ(999, handler.values_.back());
+}
+
+TEST(AsyncEventProcessorTest, shouldReturnAlertedToASuspendedWaiterOnHalt) {
+  WS ws;
+  auto ringBuffer = RB::createSingleProducer(Event::FACTORY, 16, ws);
+  auto barrier = ringBuffer->newBarrier();
+  disruptor::WaitResult result{0};
+
+  disruptor::CoroutineScheduler scheduler;
+  scheduler.spawn(awaitSequence(*barrier, 5, result));
+  std::thread consumer([&] { scheduler.run(); });
+  barrier->alert();
+  consumer.join();
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(disruptor::ErrorCode::Alerted, result.error());
+}
+
+TEST(AsyncEventProcessorTest, shouldStepOverSequencesAClaimChunkSkipped) {
+  using MultiProducerRB = disruptor::MultiProducerRingBuffer<Event, WS>;
+  using MultiProducerBarrier =
+    std::remove_reference_t<decltype(*std::declval<MultiProducerRB&>().newBarrier())>;
+  WS ws;
+  auto ringBuffer = MultiProducerRB::createMultiProducer(Event::FACTORY, 16, ws);
+  auto barrier = ringBuffer->newBarrier();
+  RecordingHandler handler;
+  disruptor::AsyncEventProcessor<Event, MultiProducerBarrier, MultiProducerRB> processor(
+    *ringBuffer, *barrier, ws, handler);
+  ringBuffer->addGatingSequences(processor.getSequence());
+  handler.lastSequence_ = 4;
+  handler.onLast_ = [&] { processor.halt(); };
+
+  {
+    auto chunk = ringBuffer->newClaimChunk(4);
+    for (int i = 0; i < 2; ++i) {
+      const int64_t sequence = chunk.next();
+      ringBuffer->get(sequence).set(sequence * 10);
+      chunk.publish(sequence);
+    }
+  }
+  const int64_t sequence = ringBuffer->next();
+  ringBuffer->get(sequence).set(sequence * 10);
+  ringBuffer->publish(sequence);
+
+  disruptor::CoroutineScheduler scheduler;
+  scheduler.spawn(processor.run());
+  scheduler.run();
+
+  EXPECT_EQ((std::vector<int64_t>{0, 10, 40}), handler.values_);
+}
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/AtomicWaitStrategy.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/WaitStrategy.h"
+#include "tests/disruptor/support/LongEvent.h"
+#include "tests/disruptor/support/WaitStrategyTestUtil.h"
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+namespace {
+using Event = disruptor::support::LongEvent;
+using WS = disruptor::AtomicWaitStrategy;
+using RB = disruptor::SingleProducerRingBuffer<Event, WS>;
+}  // namespace
+
+TEST(AtomicWaitStrategyTest, shouldWaitForValue) {
+  WS waitStrategy;
+  EXPECT_NO_THROW(
+    disruptor::support::WaitStrategyTestUtil::assertWaitForWithDelayOf(50, waitStrategy));
+}
+
+TEST(AtomicWaitStrategyTest, shouldWakeSleepingConsumerOnEachPublish) {
+  constexpr int64_t kEvents = 20;
+
+  WS waitStrategy;
+  auto ringBuffer = RB::createSingleProducer(Event::FACTORY, 16, waitStrategy);
+  auto barrier = ringBuffer->newBarrier();
+  disruptor::Sequence consumed;
+  ringBuffer->addGatingSequences(consumed);
+
+  int64_t sum = 0;
+  std::thread consumer([&] {
+    int64_t next = 0;
+    while (next < kEvents) {
+      const int64_t available = barrier->waitFor(next);
+      for (; next <= available; ++next) {
+        sum += ringBuffer->get(next).get();
+      }
+      consumed.set(available);
+    }
+  });
+
+  // Slow enough for the consumer to fall asleep before most publishes.
+  for (int64_t i = 0; i < kEvents; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    const int64_t sequence = ringBuffer->next();
+    ringBuffer->get(sequence).set(i);
+    ringBuffer->publish(sequence);
+  }
+  consumer.join();
+
+  EXPECT_EQ(kEvents * (kEvents - 1) / 2, sum);
+}
+
+TEST(AtomicWaitStrategyTest, shouldReturnAlertedToSleepingConsumer) {
+  WS waitStrategy;
+  auto ringBuffer = RB::createSingleProducer(Event::FACTORY, 16, waitStrategy);
+  auto barrier = ringBuffer->newBarrier();
+
+  disruptor::WaitResult result = -1;
+  std::thread consumer([&] { result = barrier->tryWaitFor(0); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  barrier->alert();
+  consumer.join();
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(disruptor::ErrorCode::Alerted, result.error());
+}
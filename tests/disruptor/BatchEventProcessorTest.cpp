@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include "disruptor/BatchEventProcessor.h"
 #include "disruptor/BatchEventProcessorBuilder.h"
 #include "disruptor/BusySpinWaitStrategy.h"
 #include "disruptor/EventHandler.h"
@@ -10,6 +11,7 @@
 
 #include <stdexcept>
 #include <thread>
+#include <utility>
 
 namespace {
 class LatchEventHandler final : public disruptor::EventHandler<disruptor::support::StubEvent> {
@@ -100,3 +102,26 @@ TEST(BatchEventProcessorTest, shouldCallExceptionHandlerOnUncaughtException) {
   processor->halt();
   t.join();
 }
+
+TEST(BatchEventProcessorTest, shouldResetOrKeepAnExternalSequence) {
+  using Event = disruptor::support::StubEvent;
+  using WS = disruptor::BusySpinWaitStrategy;
+  using RB = disruptor::MultiProducerRingBuffer<Event, WS>;
+  using Barrier = decltype(std::declval<RB&>().newBarrier(nullptr, 0))::element_type;
+  using Processor = disruptor::BatchEventProcessor<Event, Barrier>;
+  WS ws;
+  auto ringBuffer = RB::createMultiProducer(disruptor::support::StubEvent::EVENT_FACTORY, 16, ws);
+  auto barrier = ringBuffer->newBarrier(nullptr, 0);
+  disruptor::test_support::CountDownLatch latch(0);
+  LatchEventHandler handler(latch);
+
+  disruptor::Sequence reset(41);
+  Processor resetting(*ringBuffer, *barrier, handler, 1, nullptr, reset);
+  EXPECT_EQ(disruptor::Sequence::INITIAL_VALUE, reset.get());
+
+  disruptor::Sequence kept(41);
+  Processor keeping(
+    *ringBuffer, *barrier, handler, 1, nullptr, kept, disruptor::ExternalSequence::Keep);
+  EXPECT_EQ(41, kept.get());
+  EXPECT_EQ(&kept, &keeping.getSequence());
+}
@@ -0,0 +1,217 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/BatchEventProcessorBuilder.h"
+#include "disruptor/BatchSpanEventHandler.h"
+#include "disruptor/ExceptionHandler.h"
+#include "disruptor/RewindableException.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/SimpleBatchRewindStrategy.h"
+#include "disruptor/YieldingWaitStrategy.h"
+#include "disruptor/dsl/Disruptor.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+#include "tests/disruptor/support/LongEvent.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+using Event = disruptor::support::LongEvent;
+using WS = disruptor::YieldingWaitStrategy;
+using RB = disruptor::SingleProducerRingBuffer<Event, WS>;
+
+struct Batch {
+  int64_t startSequence;
+  std::size_t firstSize;
+  std::size_t secondSize;
+  int64_t queueDepth;
+};
+
+class RecordingSpanHandler : public disruptor::BatchSpanEventHandler<Event> {
+public:
+  void onBatch(std::span<Event> first,
+               std::span<Event> second,
+               int64_t startSequence,
+               int64_t queueDepth) override {
+    batches_.push_back(Batch{startSequence, first.size(), second.size(), queueDepth});
+    for (const Event& event : first) {
+      values_.push_back(event.get());
+    }
+    for (const Event& event : second) {
+      values_.push_back(event.get());
+    }
+  }
+
+  std::vector<Batch> batches_;
+  std::vector<int64_t> values_;
+};
+
+class RecordingExceptionHandler final : public disruptor::ExceptionHandler<Event> {
+public:
+  void handleEventException(const std::exception&, int64_t sequence, Event* event) override {
+    sequences_.push_back(sequence);
+    values_.push_back(event != nullptr ? event->get() : -1);
+  }
+
+  void handleOnStartException(const std::exception&) override {}
+
+  void handleOnShutdownException(const std::exception&) override {}
+
+  std::vector<int64_t> sequences_;
+  std::vector<int64_t> values_;
+};
+
+void publishRange(RB& ringBuffer, int count) {
+  const int64_t hi = ringBuffer.next(count);
+  for (int64_t sequence = hi - count + 1; sequence <= hi; ++sequence) {
+    ringBuffer.get(sequence).set(sequence * 10);
+  }
+  ringBuffer.publish(hi - count + 1, hi);
+}
+
+template <typename Processor>
+void waitForSequence(Processor& processor, int64_t sequence) {
+  while (processor.getSequence().get() < sequence) {
+    std::this_thread::yield();
+  }
+}
+}  // namespace
+
+TEST(BatchSpanEventHandlerTest, shouldDeliverBatchesAsRingSpansSplitAtTheWrap) {
+  WS ws;
+  auto ringBuffer = RB::createSingleProducer(Event::FACTORY, 8, ws);
+  auto barrier = ringBuffer->newBarrier();
+  RecordingSpanHandler handler;
+  disruptor::BatchEventProcessorBuilder builder;
+  auto processor = builder.setMaxBatchSize(4).build(*ringBuffer, *barrier, handler);
+  ringBuffer->addGatingSequences(processor->getSequence());
+
+  publishRange(*ringBuffer, 6);
+  std::thread thread([&] { processor->run(); });
+  waitForSequence(*processor, 5);
+  publishRange(*ringBuffer, 6);
+  waitForSequence(*processor, 11);
+  processor->halt();
+  thread.join();
+
+  ASSERT_EQ(4U, handler.batches_.size());
+  EXPECT_EQ(0, handler.batches_[0].startSequence);
+  EXPECT_EQ(4U, handler.batches_[0].firstSize);
+  EXPECT_EQ(6, handler.batches_[0].queueDepth);
+  EXPECT_EQ(4, handler.batches_[1].startSequence);
+  EXPECT_EQ(2U, handler.batches_[1].firstSize);
+  // Sequences 6..9 sit in slots 6, 7, 0, 1.
+  EXPECT_EQ(6, handler.batches_[2].startSequence);
+  EXPECT_EQ(2U, handler.batches_[2].firstSize);
+  EXPECT_EQ(2U, handler.batches_[2].secondSize);
+  EXPECT_EQ(6, handler.batches_[2].queueDepth);
+  EXPECT_EQ(10, handler.batches_[3].startSequence);
+  ASSERT_EQ(12U, handler.values_.size());
+  for (std::size_t i = 0; i < handler.values_.size(); ++i) {
+    EXPECT_EQ(static_cast<int64_t>(i) * 10, handler.values_[i]);
+  }
+}
+
+TEST(BatchSpanEventHandlerTest, shouldRedeliverABatchOnRewind) {
+  class RewindOnceHandler final : public RecordingSpanHandler {
+  public:
+    void onBatch(std::span<Event> first,
+                 std::span<Event> second,
+                 int64_t startSequence,
+                 int64_t queueDepth) override {
+      if (!rewound_) {
+        rewound_ = true;
+        throw disruptor::RewindableException("retry");
+      }
+      RecordingSpanHandler::onBatch(first, second, startSequence, queueDepth);
+    }
+
+  private:
+    bool rewound_{false};
+  };
+
+  WS ws;
+  auto ringBuffer = RB::createSingleProducer(Event::FACTORY, 16, ws);
+  auto barrier = ringBuffer->newBarrier();
+  RewindOnceHandler handler;
+  disruptor::SimpleBatchRewindStrategy strategy;
+  auto processor = disruptor::BatchEventProcessorBuilder().build(*ringBuffer, *barrier,
+                                                                 handler, strategy);
+  ringBuffer->addGatingSequences(processor->getSequence());
+
+  publishRange(*ringBuffer, 5);
+  std::thread thread([&] { processor->run(); });
+  waitForSequence(*processor, 4);
+  processor->halt();
+  thread.join();
+
+  ASSERT_EQ(1U, handler.batches_.size());
+  EXPECT_EQ(0, handler.batches_[0].startSequence);
+  EXPECT_EQ((std::vector<int64_t>{0, 10, 20, 30, 40}), handler.values_);
+}
+
+TEST(BatchSpanEventHandlerTest, shouldSkipTheWholeBatchWhenTheHandlerThrows) {
+  class ThrowOnFirstBatchHandler final : public RecordingSpanHandler {
+  public:
+    void onBatch(std::span<Event> first,
+                 std::span<Event> second,
+                 int64_t startSequence,
+                 int64_t queueDepth) override {
+      if (startSequence == 0) {
+        throw std::runtime_error("bad batch");
+      }
+      RecordingSpanHandler::onBatch(first, second, startSequence, queueDepth);
+    }
+  };
+
+  WS ws;
+  auto ringBuffer = RB::createSingleProducer(Event::FACTORY, 16, ws);
+  auto barrier = ringBuffer->newBarrier();
+  ThrowOnFirstBatchHandler handler;
+  RecordingExceptionHandler exceptionHandler;
+  disruptor::BatchEventProcessorBuilder builder;
+  auto processor = builder.setMaxBatchSize(3).build(*ringBuffer, *barrier, handler);
+  processor->setExceptionHandler(exceptionHandler);
+  ringBuffer->addGatingSequences(processor->getSequence());
+
+  publishRange(*ringBuffer, 5);
+  std::thread thread([&] { processor->run(); });
+  waitForSequence(*processor, 4);
+  processor->halt();
+  thread.join();
+
+  EXPECT_EQ((std::vector<int64_t>{2}), exceptionHandler.sequences_);
+  EXPECT_EQ((std::vector<int64_t>{20}), exceptionHandler.values_);
+  EXPECT_EQ((std::vector<int64_t>{30, 40}), handler.values_);
+}
+
+TEST(BatchSpanEventHandlerTest, shouldRunAsADslStage) {
+  using DisruptorT = disruptor::dsl::Disruptor<Event, disruptor::dsl::ProducerType::SINGLE, WS>;
+  constexpr int kEvents = 5000;
+  WS ws;
+  DisruptorT d(Event::FACTORY, 64, disruptor::util::DaemonThreadFactory::INSTANCE(), ws);
+  RecordingSpanHandler handler;
+  d.handleEventsWith(handler);
+  d.start();
+
+  auto& ringBuffer = d.getRingBuffer();
+  for (int i = 0; i < kEvents; ++i) {
+    const int64_t sequence = ringBuffer.next();
+    ringBuffer.get(sequence).set(sequence * 10);
+    ringBuffer.publish(sequence);
+  }
+  while (d.getSequenceValueFor(handler) < kEvents - 1) {
+    std::this_thread::yield();
+  }
+  d.halt();
+  d.join();
+
+  ASSERT_EQ(static_cast<std::size_t>(kEvents), handler.values_.size());
+  for (std::size_t i = 0; i < handler.values_.size(); ++i) {
+    ASSERT_EQ(static_cast<int64_t>(i) * 10, handler.values_[i]);
+  }
+}
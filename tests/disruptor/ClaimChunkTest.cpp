@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/BatchEventProcessorBuilder.h"
+#include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/ClaimChunk.h"
+#include "disruptor/EventHandler.h"
+#include "disruptor/MultiProducerSequencer.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/YieldingWaitStrategy.h"
+#include "tests/disruptor/support/StubEvent.h"
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+class SummingHandler final : public disruptor::EventHandler<disruptor::support::StubEvent> {
+public:
+  void onEvent(disruptor::support::StubEvent& event, int64_t, bool endOfBatch) override {
+    ++count_;
+    sum_ += event.value;
+    endOfBatches_ += endOfBatch ? 1 : 0;
+  }
+
+  int64_t count_{0};
+  int64_t sum_{0};
+  int64_t endOfBatches_{0};
+};
+}  // namespace
+
+TEST(ClaimChunkTest, shouldHandOutAChunkClaimedWithOneCursorUpdate) {
+  using WS = disruptor::BusySpinWaitStrategy;
+  WS ws;
+  disruptor::MultiProducerSequencer<WS> sequencer(16, ws);
+  auto chunk = sequencer.newClaimChunk(4);
+
+  EXPECT_EQ(0, chunk.next());
+  EXPECT_EQ(3, sequencer.getCursor());
+  EXPECT_EQ(1, chunk.next());
+  EXPECT_EQ(2, chunk.next());
+  EXPECT_EQ(1, chunk.remaining());
+  chunk.publish(0);
+  chunk.publish(1);
+  chunk.publish(2);
+  EXPECT_EQ(2, sequencer.getHighestPublishedSequence(0, 3));
+
+  chunk.flush();
+  EXPECT_EQ(0, chunk.remaining());
+  EXPECT_EQ(3, sequencer.getHighestPublishedSequence(0, 3));
+  EXPECT_FALSE(sequencer.isSkipped(2));
+  EXPECT_TRUE(sequencer.isSkipped(3));
+  EXPECT_EQ(2, sequencer.lastUnskippedSequence(0, 3));
+
+  EXPECT_EQ(4, chunk.next());
+  EXPECT_EQ(7, sequencer.getCursor());
+  EXPECT_THROW(sequencer.newClaimChunk(17), std::invalid_argument);
+}
+
+TEST(ClaimChunkTest, shouldOnlyReportSkipsForTheLapTheyWerePublishedIn) {
+  using WS = disruptor::BusySpinWaitStrategy;
+  WS ws;
+  disruptor::MultiProducerSequencer<WS> sequencer(4, ws);
+  disruptor::Sequence consumer;
+  std::array<disruptor::Sequence*, 1> gating = {&consumer};
+  sequencer.addGatingSequences(gating.data(), 1);
+  auto chunk = sequencer.newClaimChunk(4);
+
+  chunk.publish(chunk.next());
+  chunk.flush();
+  EXPECT_TRUE(sequencer.isSkipped(1));
+  consumer.set(3);
+
+  for (int i = 0; i < 4; ++i) {
+    chunk.publish(chunk.next());
+  }
+  EXPECT_EQ(7, sequencer.getHighestPublishedSequence(4, 7));
+  EXPECT_FALSE(sequencer.isSkipped(5));
+  EXPECT_EQ(7, sequencer.lastUnskippedSequence(4, 7));
+}
+
+TEST(ClaimChunkTest, shouldFallBackToASingleSequenceWhenAChunkDoesNotFit) {
+  using WS = disruptor::BusySpinWaitStrategy;
+  WS ws;
+  disruptor::MultiProducerSequencer<WS> sequencer(8, ws);
+  disruptor::Sequence consumer;
+  std::array<disruptor::Sequence*, 1> gating = {&consumer};
+  sequencer.addGatingSequences(gating.data(), 1);
+  sequencer.next(6);
+  auto chunk = sequencer.newClaimChunk(4);
+
+  EXPECT_EQ(6, chunk.tryNext().value());
+  EXPECT_EQ(7, chunk.tryNext().value());
+  EXPECT_FALSE(chunk.tryNext().has_value());
+
+  consumer.set(7);
+  EXPECT_EQ(8, chunk.tryNext().value());
+  EXPECT_EQ(11, sequencer.getCursor());
+}
+
+TEST(ClaimChunkTest, shouldStepOverSkippedSequencesInPoller) {
+  using Event = disruptor::support::StubEvent;
+  using WS = disruptor::BusySpinWaitStrategy;
+  using RB = disruptor::MultiProducerRingBuffer<Event, WS>;
+  WS ws;
+  auto ringBuffer = RB::createMultiProducer(Event::EVENT_FACTORY, 16, ws);
+  auto poller = ringBuffer->newPoller();
+  ringBuffer->addGatingSequences(poller->getSequence());
+
+  struct Handler final : public decltype(poller)::element_type::Handler {
+    bool onEvent(Event& event, int64_t sequence, bool endOfBatch) override {
+      values.push_back(event.value);
+      lastEndOfBatch = endOfBatch ? sequence : lastEndOfBatch;
+      return true;
+    }
+    std::vector<int> values;
+    int64_t lastEndOfBatch{-1};
+  } handler;
+
+  {
+    auto first = ringBuffer->newClaimChunk(4);
+    auto second = ringBuffer->newClaimChunk(4);
+    const int64_t a = first.next();
+    const int64_t b = second.next();
+    ringBuffer->get(a).value = 10;
+    ringBuffer->get(b).value = 20;
+    first.publish(a);
+    second.publish(b);
+  }  // both chunks flush their unused tails
+
+  poller->poll(handler);
+  EXPECT_EQ((std::vector<int>{10, 20}), handler.values);
+  EXPECT_EQ(4, handler.lastEndOfBatch);
+  EXPECT_EQ(7, poller->getSequence().get());
+}
+
+TEST(ClaimChunkTest, shouldDeliverEveryEventOnceFromConcurrentChunkedProducers) {
+  using Event = disruptor::support::StubEvent;
+  using WS = disruptor::YieldingWaitStrategy;
+  using RB = disruptor::MultiProducerRingBuffer<Event, WS>;
+  constexpr int kProducers = 4;
+  constexpr int kEventsPerProducer = 5000;
+  WS ws;
+  auto ringBuffer = RB::createMultiProducer(Event::EVENT_FACTORY, 64, ws);
+  auto barrier = ringBuffer->newBarrier();
+  SummingHandler handler;
+  disruptor::BatchEventProcessorBuilder builder;
+  auto processor = builder.build(*ringBuffer, *barrier, handler);
+  ringBuffer->addGatingSequences(processor->getSequence());
+  std::thread consumer([&] { processor->run(); });
+
+  std::vector<std::thread> producers;
+  int64_t expectedSum = 0;
+  for (int p = 0; p < kProducers; ++p) {
+    for (int i = 0; i < kEventsPerProducer; ++i) {
+      expectedSum += p * kEventsPerProducer + i;
+    }
+    producers.emplace_back([&ringBuffer, p] {
+      // Chunk sizes that do not divide the event count leave tails to skip.
+      auto chunk = ringBuffer->newClaimChunk(3 + 2 * p);
+      for (int i = 0; i < kEventsPerProducer; ++i) {
+        const int64_t sequence = chunk.next();
+        ringBuffer->get(sequence).value = p * kEventsPerProducer + i;
+        chunk.publish(sequence);
+        if (i % 1000 == 999) {
+          chunk.flush();
+        }
+      }
+    });
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  while (processor->getSequence().get() < ringBuffer->getCursor()) {
+    std::this_thread::yield();
+  }
+  processor->halt();
+  consumer.join();
+
+  EXPECT_EQ(kProducers * kEventsPerProducer, handler.count_);
+  EXPECT_EQ(expectedSum, handler.sum_);
+  EXPECT_GT(handler.endOfBatches_, 0);
+}
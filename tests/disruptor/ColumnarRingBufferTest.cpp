@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/ColumnarBatchEventProcessor.h"
+#include "disruptor/ColumnarRingBuffer.h"
+#include "tests/disruptor/test_support/CountDownLatch.h"
+
+#include <cstdint>
+#include <numeric>
+#include <thread>
+#include <type_traits>
+
+namespace {
+using WS = disruptor::BusySpinWaitStrategy;
+using RB = disruptor::SingleProducerColumnarRingBuffer<WS, int64_t, double, int32_t>;
+}  // namespace
+
+TEST(ColumnarRingBufferTest, shouldClaimAndGetColumns) {
+  WS ws;
+  auto ringBuffer = RB::create(16, ws);
+
+  int64_t sequence = ringBuffer->next();
+  auto [id, price, quantity] = ringBuffer->get(sequence);
+  id = 7;
+  price = 101.5;
+  quantity = 3;
+  ringBuffer->publish(sequence);
+
+  EXPECT_EQ(0, ringBuffer->getCursor());
+  EXPECT_EQ(7, ringBuffer->get<0>(sequence));
+  EXPECT_DOUBLE_EQ(101.5, ringBuffer->get<1>(sequence));
+  EXPECT_EQ(3, ringBuffer->get<2>(sequence));
+  EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(&ringBuffer->get<1>(0)) % 128);
+}
+
+TEST(ColumnarRingBufferTest, shouldSplitColumnSpanWhenRangeWraps) {
+  WS ws;
+  auto ringBuffer = RB::create(8, ws);
+  for (int64_t s = 4; s < 12; ++s) {
+    ringBuffer->get<0>(s) = s;
+  }
+
+  auto whole = ringBuffer->column<0>(8, 11);
+  EXPECT_EQ(4u, whole.first.size());
+  EXPECT_TRUE(whole.second.empty());
+  EXPECT_EQ(8, whole.first.front());
+
+  auto wrapped = ringBuffer->column<0>(6, 11);
+  ASSERT_EQ(2u, wrapped.first.size());
+  ASSERT_EQ(4u, wrapped.second.size());
+  EXPECT_EQ(6, wrapped.first[0]);
+  EXPECT_EQ(7, wrapped.first[1]);
+  EXPECT_EQ(8, wrapped.second[0]);
+  EXPECT_EQ(11, wrapped.second[3]);
+  EXPECT_EQ(6u, wrapped.size());
+}
+
+namespace {
+class SumHandler final : public disruptor::ColumnarBatchEventHandler<int64_t, double, int32_t> {
+public:
+  explicit SumHandler(disruptor::test_support::CountDownLatch& latch, int64_t lastSequence)
+    : latch_(&latch), lastSequence_(lastSequence) {}
+
+  void onBatch(const disruptor::ColumnarBatch<int64_t, double, int32_t>& batch,
+               int64_t /*queueDepth*/) override {
+    auto quantities = batch.column<2>();
+    sum += std::accumulate(quantities.first.begin(), quantities.first.end(), int64_t{0});
+    sum += std::accumulate(quantities.second.begin(), quantities.second.end(), int64_t{0});
+    ++batches;
+    if (batch.lastSequence() == lastSequence_) {
+      latch_->countDown();
+    }
+  }
+
+  int64_t sum = 0;
+  int batches = 0;
+
+private:
+  disruptor::test_support::CountDownLatch* latch_;
+  int64_t lastSequence_;
+};
+}  // namespace
+
+TEST(ColumnarRingBufferTest, shouldDeliverBatchesToColumnarProcessor) {
+  WS ws;
+  auto ringBuffer = RB::create(16, ws);
+  auto barrier = ringBuffer->newBarrier();
+
+  constexpr int64_t kEvents = 100;
+  disruptor::test_support::CountDownLatch latch(1);
+  SumHandler handler(latch, kEvents - 1);
+  disruptor::ColumnarBatchEventProcessor<RB, std::remove_reference_t<decltype(*barrier)>>
+    processor(*ringBuffer, *barrier, handler, 4);
+  ringBuffer->addGatingSequences(processor.getSequence());
+
+  std::thread consumer([&processor] { processor.run(); });
+  for (int64_t i = 0; i < kEvents; ++i) {
+    int64_t sequence = ringBuffer->next();
+    ringBuffer->get<2>(sequence) = static_cast<int32_t>(i);
+    ringBuffer->publish(sequence);
+  }
+
+  latch.await();
+  processor.halt();
+  consumer.join();
+
+  EXPECT_EQ(kEvents * (kEvents - 1) / 2, handler.sum);
+  EXPECT_GE(handler.batches, static_cast<int>(kEvents / 4));
+  EXPECT_EQ(kEvents - 1, processor.getSequence().get());
+}
+
+TEST(ColumnarRingBufferTest, shouldSplitBatchesAtSkippedSequences) {
+  using MultiRB = disruptor::MultiProducerColumnarRingBuffer<WS, int64_t, double, int32_t>;
+  WS ws;
+  auto ringBuffer = MultiRB::create(16, ws);
+  auto barrier = ringBuffer->newBarrier();
+
+  disruptor::test_support::CountDownLatch latch(1);
+  SumHandler handler(latch, 4);
+  disruptor::ColumnarBatchEventProcessor<MultiRB, std::remove_reference_t<decltype(*barrier)>>
+    processor(*ringBuffer, *barrier, handler, 16);
+  ringBuffer->addGatingSequences(processor.getSequence());
+
+  // Sequences 2 and 3 are the flushed tail of a chunk; 4 is an ordinary claim.
+  {
+    auto chunk = ringBuffer->getSequencer().newClaimChunk(4);
+    for (int32_t quantity = 1; quantity <= 2; ++quantity) {
+      const int64_t sequence = chunk.next();
+      ringBuffer->get<2>(sequence) = quantity;
+      chunk.publish(sequence);
+    }
+  }
+  const int64_t last = ringBuffer->next();
+  ringBuffer->get<2>(last) = 3;
+  ringBuffer->publish(last);
+
+  std::thread consumer([&processor] { processor.run(); });
+  latch.await();
+  processor.halt();
+  consumer.join();
+
+  EXPECT_EQ(6, handler.sum);
+  EXPECT_EQ(2, handler.batches);
+  EXPECT_EQ(4, processor.getSequence().get());
+}
@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/CombiningMultiProducerSequencer.h"
+#include "disruptor/EventHandler.h"
+#include "disruptor/EventTranslator.h"
+#include "disruptor/YieldingWaitStrategy.h"
+#include "disruptor/dsl/Disruptor.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+#include "tests/disruptor/support/StubEvent.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+using WS = disruptor::BusySpinWaitStrategy;
+using SequencerT = disruptor::CombiningMultiProducerSequencer<WS>;
+
+class CountingHandler final : public disruptor::EventHandler<disruptor::support::StubEvent> {
+public:
+  void onEvent(disruptor::support::StubEvent& event, int64_t, bool) override {
+    ++count_;
+    sum_ += event.value;
+  }
+
+  int64_t count_{0};
+  int64_t sum_{0};
+};
+
+class ValueTranslator final : public disruptor::EventTranslator<disruptor::support::StubEvent> {
+public:
+  explicit ValueTranslator(int value) : value_(value) {}
+
+  void translateTo(disruptor::support::StubEvent& event, int64_t) override {
+    event.value = value_;
+  }
+
+private:
+  int value_;
+};
+}  // namespace
+
+TEST(CombiningMultiProducerSequencerTest, shouldClaimSingleAndBatchSequences) {
+  WS ws;
+  SequencerT sequencer(16, ws);
+
+  EXPECT_EQ(0, sequencer.next());
+  EXPECT_EQ(4, sequencer.next(4));
+  EXPECT_EQ(4, sequencer.getCursor());
+  EXPECT_EQ(6, sequencer.tryNext(2).value());
+
+  sequencer.publish(0);
+  sequencer.publish(1, 4);
+  EXPECT_EQ(4, sequencer.getHighestPublishedSequence(0, 6));
+  EXPECT_FALSE(sequencer.isAvailable(5));
+}
+
+TEST(CombiningMultiProducerSequencerTest, shouldFailTryNextOnlyWhenTheRingIsFull) {
+  WS ws;
+  SequencerT sequencer(4, ws);
+  disruptor::Sequence consumer;
+  std::array<disruptor::Sequence*, 1> gating = {&consumer};
+  sequencer.addGatingSequences(gating.data(), 1);
+
+  EXPECT_EQ(3, sequencer.next(4));
+  EXPECT_FALSE(sequencer.hasAvailableCapacity(1));
+  EXPECT_EQ(0, sequencer.remainingCapacity());
+  EXPECT_FALSE(sequencer.tryNext().has_value());
+
+  consumer.set(1);
+  EXPECT_TRUE(sequencer.hasAvailableCapacity(2));
+  EXPECT_FALSE(sequencer.tryNext(3).has_value());
+  EXPECT_EQ(5, sequencer.tryNext(2).value());
+}
+
+TEST(CombiningMultiProducerSequencerTest, shouldWaitForCapacityInNext) {
+  WS ws;
+  SequencerT sequencer(4, ws);
+  disruptor::Sequence consumer;
+  std::array<disruptor::Sequence*, 1> gating = {&consumer};
+  sequencer.addGatingSequences(gating.data(), 1);
+  sequencer.next(4);
+
+  std::atomic<int64_t> claimed{-1};
+  std::thread producer([&] { claimed.store(sequencer.next(), std::memory_order_release); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_EQ(-1, claimed.load(std::memory_order_acquire));
+
+  consumer.set(0);
+  producer.join();
+  EXPECT_EQ(4, claimed.load());
+}
+
+TEST(CombiningMultiProducerSequencerTest, shouldHandOutDisjointRangesToConcurrentProducers) {
+  constexpr int kProducers = 8;
+  constexpr int kClaimsPerProducer = 5000;
+  WS ws;
+  SequencerT sequencer(1 << 16, ws);
+
+  std::vector<std::vector<int64_t>> claimedBy(kProducers);
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kProducers; ++p) {
+    producers.emplace_back([&sequencer, &claimedBy, p] {
+      for (int i = 0; i < kClaimsPerProducer; ++i) {
+        const int n = 1 + (i + p) % 3;
+        const int64_t hi = sequencer.next(n);
+        for (int64_t s = hi - n + 1; s <= hi; ++s) {
+          claimedBy[static_cast<std::size_t>(p)].push_back(s);
+        }
+      }
+    });
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+
+  std::vector<int64_t> all;
+  for (const auto& claimed : claimedBy) {
+    all.insert(all.end(), claimed.begin(), claimed.end());
+  }
+  std::sort(all.begin(), all.end());
+  ASSERT_EQ(static_cast<std::size_t>(sequencer.getCursor() + 1), all.size());
+  for (std::size_t i = 0; i < all.size(); ++i) {
+    ASSERT_EQ(static_cast<int64_t>(i), all[i]);
+  }
+}
+
+TEST(CombiningMultiProducerSequencerTest, shouldRunDisruptorWithCombiningProducers) {
+  using Event = disruptor::support::StubEvent;
+  using YWS = disruptor::YieldingWaitStrategy;
+  using DisruptorT =
+    disruptor::dsl::Disruptor<Event, disruptor::dsl::ProducerType::MULTI_COMBINING, YWS>;
+  constexpr int kProducers = 4;
+  constexpr int kEventsPerProducer = 2000;
+  auto& tf = disruptor::util::DaemonThreadFactory::INSTANCE();
+  YWS ws;
+  CountingHandler handler;
+  DisruptorT d(Event::EVENT_FACTORY, 1024, tf, ws);
+  d.handleEventsWith(handler);
+  d.start();
+
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kProducers; ++p) {
+    producers.emplace_back([&d, p] {
+      ValueTranslator translator(p + 1);
+      for (int i = 0; i < kEventsPerProducer; ++i) {
+        d.publishEvent(translator);
+      }
+    });
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  while (d.getRingBuffer().getMinimumGatingSequence() < d.getRingBuffer().getCursor()) {
+    std::this_thread::yield();
+  }
+  d.halt();
+  d.join();
+
+  EXPECT_EQ(kProducers * kEventsPerProducer, handler.count_);
+  EXPECT_EQ(kEventsPerProducer * (1 + 2 + 3 + 4), handler.sum_);
+}
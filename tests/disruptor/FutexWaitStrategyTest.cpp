@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/FutexWaitStrategy.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/WaitStrategy.h"
+#include "tests/disruptor/support/LongEvent.h"
+#include "tests/disruptor/support/WaitStrategyTestUtil.h"
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+using Event = disruptor::support::LongEvent;
+using WS = disruptor::FutexWaitStrategy;
+using RB = disruptor::MultiProducerRingBuffer<Event, WS>;
+}  // namespace
+
+TEST(FutexWaitStrategyTest, shouldWaitForValue) {
+  WS waitStrategy;
+  EXPECT_NO_THROW(
+    disruptor::support::WaitStrategyTestUtil::assertWaitForWithDelayOf(50, waitStrategy));
+}
+
+TEST(FutexWaitStrategyTest, shouldWakeSleepingConsumerOnPublish) {
+  WS waitStrategy;
+  auto ringBuffer = RB::createMultiProducer(Event::FACTORY, 16, waitStrategy);
+  auto barrier = ringBuffer->newBarrier();
+
+  disruptor::WaitResult result = -1;
+  std::thread consumer([&] { result = barrier->tryWaitFor(0); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+  const int64_t sequence = ringBuffer->next();
+  ringBuffer->get(sequence).set(7);
+  ringBuffer->publish(sequence);
+  consumer.join();
+
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(0, *result);
+}
+
+TEST(FutexWaitStrategyTest, shouldReturnAlertedToSleepingConsumer) {
+  WS waitStrategy;
+  auto ringBuffer = RB::createMultiProducer(Event::FACTORY, 16, waitStrategy);
+  auto barrier = ringBuffer->newBarrier();
+
+  disruptor::WaitResult result = -1;
+  std::thread consumer([&] { result = barrier->tryWaitFor(0); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  barrier->alert();
+  consumer.join();
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(disruptor::ErrorCode::Alerted, result.error());
+}
+
+TEST(FutexWaitStrategyTest, shouldSeeEveryEventFromManyProducers) {
+  constexpr int kProducers = 3;
+  constexpr int kEventsPerProducer = 2000;
+  constexpr int64_t kLast = kProducers * kEventsPerProducer - 1;
+
+  WS waitStrategy;
+  auto ringBuffer = RB::createMultiProducer(Event::FACTORY, 64, waitStrategy);
+  auto barrier = ringBuffer->newBarrier();
+  disruptor::Sequence consumed;
+  ringBuffer->addGatingSequences(consumed);
+
+  int64_t sum = 0;
+  std::thread consumer([&] {
+    int64_t next = 0;
+    while (next <= kLast) {
+      const int64_t available = barrier->waitFor(next);
+      for (; next <= available; ++next) {
+        sum += ringBuffer->get(next).get();
+      }
+      consumed.set(available);
+    }
+  });
+
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kProducers; ++p) {
+    producers.emplace_back([&] {
+      for (int i = 0; i < kEventsPerProducer; ++i) {
+        const int64_t sequence = ringBuffer->next();
+        ringBuffer->get(sequence).set(1);
+        ringBuffer->publish(sequence);
+        if (i % 100 == 0) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  consumer.join();
+
+  EXPECT_EQ(kLast + 1, sum);
+}
@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/GatingSequenceRegistry.h"
+#include "disruptor/MultiProducerSequencer.h"
+#include "disruptor/Sequence.h"
+#include "disruptor/SequenceArray.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+// Every other element of storage, so no two sequences form a run.
+std::vector<disruptor::Sequence*> spreadOut(std::vector<disruptor::Sequence>& storage) {
+  std::vector<disruptor::Sequence*> sequences;
+  for (std::size_t i = 0; i < storage.size(); i += 2) {
+    sequences.push_back(&storage[i]);
+  }
+  return sequences;
+}
+}  // namespace
+
+TEST(GatingSequenceRegistryTest, shouldReportMinimumOfRegisteredSequences) {
+  disruptor::GatingSequenceRegistry registry;
+  EXPECT_EQ(42, registry.minimumSequence(42));
+
+  disruptor::Sequence three(3);
+  disruptor::Sequence seven(7);
+  std::array<disruptor::Sequence*, 2> sequences = {&seven, &three};
+  registry.add(sequences.data(), 2);
+  EXPECT_EQ(3, registry.minimumSequence(std::numeric_limits<int64_t>::max()));
+  EXPECT_EQ(1, registry.minimumSequence(1));
+  EXPECT_EQ(2, registry.size());
+
+  EXPECT_TRUE(registry.remove(three));
+  EXPECT_FALSE(registry.remove(three));
+  EXPECT_EQ(7, registry.minimumSequence(std::numeric_limits<int64_t>::max()));
+}
+
+TEST(GatingSequenceRegistryTest, shouldRemoveEveryOccurrenceAndReuseFreedSlots) {
+  disruptor::GatingSequenceRegistry registry;
+  std::vector<disruptor::Sequence> storage(6);
+  const auto abc = spreadOut(storage);
+  disruptor::Sequence* a = abc[0];
+  disruptor::Sequence* b = abc[1];
+  disruptor::Sequence* c = abc[2];
+  std::array<disruptor::Sequence*, 4> sequences = {a, b, a, c};
+  registry.add(sequences.data(), 4);
+  EXPECT_EQ(4, registry.size());
+
+  EXPECT_TRUE(registry.remove(*a));
+  EXPECT_EQ((std::vector<disruptor::Sequence*>{b, c}), registry.snapshot());
+
+  // The lowest free slot is reused, the others keep their position.
+  registry.add(sequences.data(), 1);
+  EXPECT_EQ((std::vector<disruptor::Sequence*>{a, b, c}), registry.snapshot());
+}
+
+TEST(GatingSequenceRegistryTest, shouldRejectAdditionsBeyondCapacity) {
+  constexpr int kCapacity = disruptor::GatingSequenceRegistry::kCapacity;
+  disruptor::GatingSequenceRegistry registry;
+  std::vector<disruptor::Sequence> storage(2 * (kCapacity + 1));
+  const auto pointers = spreadOut(storage);
+
+  registry.add(pointers.data(), kCapacity - 1);
+  // All or nothing.
+  EXPECT_THROW(registry.add(&pointers[kCapacity - 1], 2), std::length_error);
+  EXPECT_EQ(kCapacity - 1, registry.size());
+
+  EXPECT_TRUE(registry.remove(*pointers[0]));
+  registry.add(&pointers[kCapacity - 1], 2);
+  EXPECT_EQ(kCapacity, registry.size());
+}
+
+TEST(GatingSequenceRegistryTest, shouldKeepAdjacentSequencesInOneEntry) {
+  constexpr int kCapacity = disruptor::GatingSequenceRegistry::kCapacity;
+  disruptor::GatingSequenceRegistry registry;
+  disruptor::SequenceArray group(100);
+  std::vector<disruptor::Sequence*> pointers;
+  for (int i = 0; i < group.capacity(); ++i) {
+    group[i].set(1000 + i);
+    pointers.push_back(&group[i]);
+  }
+  registry.add(pointers.data(), group.capacity());
+  EXPECT_EQ(100, registry.size());
+  EXPECT_EQ(1000, registry.minimumSequence(std::numeric_limits<int64_t>::max()));
+
+  // Removing from the middle splits the run; the rest still gates.
+  EXPECT_TRUE(registry.remove(group[0]));
+  EXPECT_TRUE(registry.remove(group[50]));
+  EXPECT_TRUE(registry.remove(group[99]));
+  EXPECT_EQ(97, registry.size());
+  EXPECT_EQ(1001, registry.minimumSequence(std::numeric_limits<int64_t>::max()));
+  group[70].set(5);
+  EXPECT_EQ(5, registry.minimumSequence(std::numeric_limits<int64_t>::max()));
+
+  // The group took two entries; fill the rest.
+  std::vector<disruptor::Sequence> storage(2 * (kCapacity - 2));
+  const auto singles = spreadOut(storage);
+  registry.add(singles.data(), kCapacity - 2);
+  EXPECT_THROW(registry.remove(group[20]), std::length_error);
+  EXPECT_TRUE(registry.remove(group[1]));
+}
+
+TEST(GatingSequenceRegistryTest, shouldNeverSkipAStableSequenceWhileOthersChange) {
+  disruptor::GatingSequenceRegistry registry;
+  disruptor::Sequence stable(10);
+  std::array<disruptor::Sequence, 8> churn;
+  for (auto& sequence : churn) {
+    sequence.set(100);
+  }
+  std::array<disruptor::Sequence*, 1> stableOnly = {&stable};
+  registry.add(stableOnly.data(), 1);
+
+  std::atomic<bool> done{false};
+  std::thread writer([&] {
+    for (int i = 0; i < 2000; ++i) {
+      disruptor::Sequence* sequence = &churn[static_cast<std::size_t>(i) % churn.size()];
+      registry.add(&sequence, 1);
+      if (i % 3 != 0) {
+        registry.remove(*sequence);
+      }
+    }
+    done.store(true, std::memory_order_release);
+  });
+
+  int64_t reads = 0;
+  while (!done.load(std::memory_order_acquire)) {
+    ASSERT_EQ(10, registry.minimumSequence(std::numeric_limits<int64_t>::max()));
+    const uint64_t before = registry.version();
+    const auto snapshot = registry.snapshot();
+    EXPECT_NE(snapshot.end(), std::find(snapshot.begin(), snapshot.end(), &stable));
+    EXPECT_GE(registry.version(), before);
+    ++reads;
+  }
+  writer.join();
+  EXPECT_GT(reads, 0);
+  EXPECT_EQ(0U, registry.version() % 2);
+}
+
+TEST(GatingSequenceRegistryTest, shouldGateSequencerOnConsumersAddedAndRemovedAtRuntime) {
+  using WS = disruptor::BusySpinWaitStrategy;
+  WS ws;
+  disruptor::MultiProducerSequencer<WS> sequencer(4, ws);
+  disruptor::Sequence slow;
+  disruptor::Sequence fast;
+  std::array<disruptor::Sequence*, 1> gating = {&slow};
+  sequencer.addGatingSequences(gating.data(), 1);
+
+  sequencer.publish(sequencer.next(4));
+  EXPECT_FALSE(sequencer.hasAvailableCapacity(1));
+
+  // A consumer joining late starts at the cursor, so it does not gate.
+  gating[0] = &fast;
+  sequencer.addGatingSequences(gating.data(), 1);
+  EXPECT_EQ(sequencer.getCursor(), fast.get());
+  EXPECT_EQ(-1, sequencer.getMinimumSequence());
+
+  EXPECT_TRUE(sequencer.removeGatingSequence(slow));
+  EXPECT_TRUE(sequencer.hasAvailableCapacity(4));
+  EXPECT_EQ(3, sequencer.getMinimumSequence());
+}
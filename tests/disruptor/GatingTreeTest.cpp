@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/EventHandler.h"
+#include "disruptor/EventTranslator.h"
+#include "disruptor/GatingTree.h"
+#include "disruptor/MultiProducerSequencer.h"
+#include "disruptor/Sequence.h"
+#include "disruptor/dsl/Disruptor.h"
+#include "disruptor/dsl/ProducerType.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+#include "tests/disruptor/support/LongEvent.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+int64_t minimumOfMembers(disruptor::GatingTree& tree) {
+  int64_t minimum = (std::numeric_limits<int64_t>::max)();
+  for (int i = 0; i < tree.size(); ++i) {
+    minimum = (std::min)(minimum, tree.member(i).get());
+  }
+  return minimum;
+}
+
+class SummingHandler final : public disruptor::EventHandler<disruptor::support::LongEvent> {
+public:
+  void onEvent(disruptor::support::LongEvent& event, int64_t, bool) override {
+    sum_ += event.get();
+    ++count_;
+  }
+
+  int64_t sum_{0};
+  int count_{0};
+};
+
+class ValueTranslator final : public disruptor::EventTranslator<disruptor::support::LongEvent> {
+public:
+  void translateTo(disruptor::support::LongEvent& event, int64_t sequence) override {
+    event.set(sequence);
+  }
+};
+}  // namespace
+
+TEST(GatingTreeTest, shouldBuildLevelsForFanIn) {
+  EXPECT_EQ(3, disruptor::GatingTree(64, 8).depth());
+  EXPECT_EQ(4, disruptor::GatingTree(65, 8).depth());
+  EXPECT_EQ(1, disruptor::GatingTree(1, 4).depth());
+  EXPECT_THROW(disruptor::GatingTree(8, 1), std::invalid_argument);
+
+  disruptor::GatingTree single(1, 4);
+  EXPECT_EQ(&single.member(0), &single.root());
+}
+
+TEST(GatingTreeTest, shouldKeepRootAtMinimumOfMembers) {
+  disruptor::GatingTree tree(37, 4);
+  tree.reset(-1);
+  std::mt19937 random(7);
+  std::vector<int64_t> values(37, -1);
+  for (int step = 0; step < 5000; ++step) {
+    const int member = static_cast<int>(random() % 37);
+    values[static_cast<std::size_t>(member)] += 1 + static_cast<int64_t>(random() % 3);
+    tree.publish(member, values[static_cast<std::size_t>(member)]);
+    ASSERT_EQ(*std::min_element(values.begin(), values.end()), tree.root().get()) << step;
+  }
+}
+
+TEST(GatingTreeTest, shouldCatchUpWithConcurrentMembers) {
+  constexpr int kThreads = 4;
+  constexpr int kMembersPerThread = 4;
+  constexpr int64_t kTarget = 20000;
+  disruptor::GatingTree tree(kThreads * kMembersPerThread, 2);
+  tree.reset(-1);
+
+  std::atomic<bool> lowerBoundHeld{true};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&tree, &lowerBoundHeld, t] {
+      for (int64_t value = 0; value <= kTarget; ++value) {
+        for (int m = 0; m < kMembersPerThread; ++m) {
+          tree.publish(t * kMembersPerThread + m, value);
+        }
+        if (tree.root().get() > minimumOfMembers(tree)) {
+          lowerBoundHeld.store(false);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_TRUE(lowerBoundHeld.load());
+  EXPECT_EQ(kTarget, tree.root().get());
+}
+
+TEST(GatingTreeTest, shouldGateSequencerOnRoot) {
+  using WS = disruptor::BusySpinWaitStrategy;
+  WS ws;
+  disruptor::MultiProducerSequencer<WS> sequencer(8, ws);
+  disruptor::GatingTree tree(6, 2);
+  sequencer.addGatingSequences(tree);
+
+  sequencer.publish(0, sequencer.next(8));
+  EXPECT_FALSE(sequencer.hasAvailableCapacity(1));
+  for (int i = 0; i < 5; ++i) {
+    tree.publish(i, 3);
+  }
+  EXPECT_FALSE(sequencer.hasAvailableCapacity(1));
+  tree.publish(5, 1);
+  EXPECT_EQ(1, sequencer.getMinimumSequence());
+  EXPECT_TRUE(sequencer.hasAvailableCapacity(2));
+  EXPECT_FALSE(sequencer.hasAvailableCapacity(3));
+
+  EXPECT_TRUE(sequencer.removeGatingSequence(tree.root()));
+  EXPECT_TRUE(sequencer.hasAvailableCapacity(8));
+}
+
+TEST(GatingTreeTest, shouldGateWideHandlerGroupThroughTreeInDsl) {
+  using Event = disruptor::support::LongEvent;
+  using WS = disruptor::BusySpinWaitStrategy;
+  constexpr int kEvents = 1000;
+  WS ws;
+  disruptor::dsl::Disruptor<Event, disruptor::dsl::ProducerType::MULTI, WS> d(
+    Event::FACTORY, 16, disruptor::util::DaemonThreadFactory::INSTANCE(), ws);
+  d.setGatingTreeFanIn(2);
+  std::vector<SummingHandler> handlers(6);
+  SummingHandler last;
+  d.handleEventsWith(handlers[0], handlers[1], handlers[2], handlers[3], handlers[4],
+                     handlers[5])
+    .then(last);
+  d.start();
+
+  ValueTranslator translator;
+  for (int i = 0; i < kEvents; ++i) {
+    d.publishEvent(translator);
+  }
+  while (d.getSequenceValueFor(last) < kEvents - 1) {
+    std::this_thread::yield();
+  }
+  d.halt();
+  d.join();  // Wait for consumer threads to finish before handlers are destroyed
+
+  constexpr int64_t kSum = int64_t{kEvents - 1} * kEvents / 2;
+  for (const SummingHandler& handler : handlers) {
+    EXPECT_EQ(kEvents, handler.count_);
+    EXPECT_EQ(kSum, handler.sum_);
+  }
+  EXPECT_EQ(kSum, last.sum_);
+  // Only the last stage gates the ring now.
+  EXPECT_EQ(kEvents - 1, d.getRingBuffer().getMinimumGatingSequence());
+}
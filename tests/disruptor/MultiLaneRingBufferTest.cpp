@@ -0,0 +1,228 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/BlockingWaitStrategy.h"
+#include "disruptor/EventHandler.h"
+#include "disruptor/MultiLaneEventProcessor.h"
+#include "disruptor/MultiLaneRingBuffer.h"
+#include "disruptor/YieldingWaitStrategy.h"
+#include "tests/disruptor/support/StubEvent.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+using Event = disruptor::support::StubEvent;
+using WS = disruptor::YieldingWaitStrategy;
+using RingBufferT = disruptor::MultiLaneRingBuffer<Event, WS>;
+using ProcessorT = disruptor::MultiLaneEventProcessor<Event, WS>;
+
+// Records per-lane values so ordering within a lane can be checked.
+class LaneRecordingHandler final : public disruptor::EventHandler<Event> {
+public:
+  explicit LaneRecordingHandler(int laneCount) : values_(static_cast<std::size_t>(laneCount)) {}
+
+  void onEvent(Event& event, int64_t, bool endOfBatch) override {
+    values_[static_cast<std::size_t>(processor->currentLane())].push_back(event.value);
+    endOfBatches_ += endOfBatch ? 1 : 0;
+  }
+
+  const std::vector<int>& values(int lane) const {
+    return values_[static_cast<std::size_t>(lane)];
+  }
+
+  const ProcessorT* processor{nullptr};
+  int64_t endOfBatches_{0};
+
+private:
+  std::vector<std::vector<int>> values_;
+};
+
+// A BlockingWaitStrategy that counts the waits reaching it.
+class CountingBlockingWaitStrategy final {
+public:
+  static constexpr bool kIsBlockingStrategy = true;
+
+  template <typename DependentSequenceT, typename Barrier>
+  int64_t waitFor(int64_t sequence,
+                  const disruptor::Sequence& cursorSequence,
+                  const DependentSequenceT& dependentSequence,
+                  Barrier& barrier) {
+    return disruptor::waitResultOrThrow(
+      tryWaitFor(sequence, cursorSequence, dependentSequence, barrier));
+  }
+
+  template <typename DependentSequenceT, typename Barrier>
+  disruptor::WaitResult tryWaitFor(int64_t sequence,
+                                   const disruptor::Sequence& cursorSequence,
+                                   const DependentSequenceT& dependentSequence,
+                                   Barrier& barrier) {
+    waits.fetch_add(1, std::memory_order_relaxed);
+    return delegate_.tryWaitFor(sequence, cursorSequence, dependentSequence, barrier);
+  }
+
+  void signalAllWhenBlocking() {
+    delegate_.signalAllWhenBlocking();
+  }
+
+  std::atomic<int> waits{0};
+
+private:
+  disruptor::BlockingWaitStrategy delegate_;
+};
+
+template <typename LaneT>
+void publishFrom(LaneT& lane, int count) {
+  for (int i = 0; i < count; ++i) {
+    const int64_t sequence = lane.next();
+    lane.get(sequence).value = i;
+    lane.publish(sequence);
+  }
+}
+
+void awaitLanes(disruptor::SequenceArray& sequences, RingBufferT& ringBuffer) {
+  for (int i = 0; i < ringBuffer.laneCount(); ++i) {
+    while (sequences[i].get() < ringBuffer.lane(i).getCursor()) {
+      std::this_thread::yield();
+    }
+  }
+}
+}  // namespace
+
+TEST(MultiLaneRingBufferTest, shouldHandOutOneLanePerProducer) {
+  WS ws;
+  auto ringBuffer = RingBufferT::create(Event::EVENT_FACTORY, 2, 8, ws);
+
+  EXPECT_EQ(2, ringBuffer->laneCount());
+  EXPECT_EQ(8, ringBuffer->getLaneSize());
+  EXPECT_EQ(&ringBuffer->lane(0), &ringBuffer->registerProducer());
+  EXPECT_EQ(&ringBuffer->lane(1), &ringBuffer->registerProducer());
+  EXPECT_THROW(ringBuffer->registerProducer(), std::length_error);
+
+  disruptor::SequenceArray wrongWidth(3);
+  EXPECT_THROW(ringBuffer->addGatingSequences(wrongWidth), std::invalid_argument);
+  EXPECT_THROW(RingBufferT(Event::EVENT_FACTORY, 0, 8, ws), std::invalid_argument);
+}
+
+TEST(MultiLaneRingBufferTest, shouldMergeLanesKeepingPerProducerOrder) {
+  constexpr int kLanes = 4;
+  constexpr int kEventsPerProducer = 5000;
+  WS ws;
+  auto ringBuffer = RingBufferT::create(Event::EVENT_FACTORY, kLanes, 64, ws);
+  auto barrier = ringBuffer->newBarrier();
+  LaneRecordingHandler handler(kLanes);
+  ProcessorT processor(*ringBuffer, *barrier, handler, 16);
+  handler.processor = &processor;
+  ringBuffer->addGatingSequences(processor.getSequences());
+  std::thread consumer([&] { processor.run(); });
+
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kLanes; ++p) {
+    producers.emplace_back(
+      [&ringBuffer] { publishFrom(ringBuffer->registerProducer(), kEventsPerProducer); });
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  awaitLanes(processor.getSequences(), *ringBuffer);
+  processor.halt();
+  consumer.join();
+
+  for (int lane = 0; lane < kLanes; ++lane) {
+    const auto& values = handler.values(lane);
+    ASSERT_EQ(static_cast<std::size_t>(kEventsPerProducer), values.size());
+    for (int i = 0; i < kEventsPerProducer; ++i) {
+      ASSERT_EQ(i, values[static_cast<std::size_t>(i)]);
+    }
+  }
+  EXPECT_GE(handler.endOfBatches_, kLanes * kEventsPerProducer / 16);
+}
+
+TEST(MultiLaneRingBufferTest, shouldGateLaterStagePerLane) {
+  constexpr int kLanes = 2;
+  constexpr int kEventsPerProducer = 2000;
+  WS ws;
+  auto ringBuffer = RingBufferT::create(Event::EVENT_FACTORY, kLanes, 16, ws);
+
+  class Doubler final : public disruptor::EventHandler<Event> {
+  public:
+    void onEvent(Event& event, int64_t, bool) override {
+      event.value *= 2;
+    }
+  } doubler;
+  auto firstBarrier = ringBuffer->newBarrier();
+  ProcessorT first(*ringBuffer, *firstBarrier, doubler);
+
+  std::array<disruptor::SequenceArray*, 1> upstream = {&first.getSequences()};
+  auto secondBarrier = ringBuffer->newBarrier(upstream.data(), 1);
+  LaneRecordingHandler handler(kLanes);
+  ProcessorT second(*ringBuffer, *secondBarrier, handler);
+  handler.processor = &second;
+  ringBuffer->addGatingSequences(second.getSequences());
+
+  std::thread firstThread([&] { first.run(); });
+  std::thread secondThread([&] { second.run(); });
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kLanes; ++p) {
+    producers.emplace_back(
+      [&ringBuffer] { publishFrom(ringBuffer->registerProducer(), kEventsPerProducer); });
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  awaitLanes(second.getSequences(), *ringBuffer);
+  first.halt();
+  second.halt();
+  firstThread.join();
+  secondThread.join();
+
+  for (int lane = 0; lane < kLanes; ++lane) {
+    const auto& values = handler.values(lane);
+    ASSERT_EQ(static_cast<std::size_t>(kEventsPerProducer), values.size());
+    for (int i = 0; i < kEventsPerProducer; ++i) {
+      ASSERT_EQ(2 * i, values[static_cast<std::size_t>(i)]);
+    }
+  }
+}
+
+TEST(MultiLaneRingBufferTest, shouldParkOnABlockingStrategyUntilALanePublishes) {
+  using BlockingRingBufferT = disruptor::MultiLaneRingBuffer<Event, CountingBlockingWaitStrategy>;
+  CountingBlockingWaitStrategy ws;
+  auto ringBuffer = BlockingRingBufferT::create(Event::EVENT_FACTORY, 2, 16, ws);
+  auto barrier = ringBuffer->newBarrier();
+
+  class CountingHandler final : public disruptor::EventHandler<Event> {
+  public:
+    void onEvent(Event&, int64_t, bool) override {
+      count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::atomic<int> count{0};
+  } handler;
+  disruptor::MultiLaneEventProcessor<Event, CountingBlockingWaitStrategy> processor(
+    *ringBuffer, *barrier, handler);
+  ringBuffer->addGatingSequences(processor.getSequences());
+  std::thread consumer([&] { processor.run(); });
+
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (ws.waits.load(std::memory_order_relaxed) == 0
+         && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::yield();
+  }
+  EXPECT_GT(ws.waits.load(std::memory_order_relaxed), 0);
+
+  publishFrom(ringBuffer->lane(1), 10);
+  while (handler.count.load(std::memory_order_relaxed) < 10
+         && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::yield();
+  }
+  processor.halt();
+  consumer.join();
+
+  EXPECT_EQ(10, handler.count.load(std::memory_order_relaxed));
+  EXPECT_EQ(9, processor.getSequences()[1].get());
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/BlockingWaitStrategy.h"
+#include "disruptor/MultiProducerSequencer.h"
+#include "disruptor/ParityBitmapAvailableBuffer.h"
+
+TEST(ParityBitmapAvailableBufferTest, shouldOnlyAllowMessagesToBeAvailableIfSpecificallyPublished) {
+  using WS = disruptor::BlockingWaitStrategy;
+  WS ws;
+  disruptor::MultiProducerSequencer<WS, disruptor::ParityBitmapAvailableBuffer> publisher(1024, ws);
+
+  publisher.publish(3);
+  publisher.publish(5);
+
+  EXPECT_FALSE(publisher.isAvailable(0));
+  EXPECT_FALSE(publisher.isAvailable(1));
+  EXPECT_FALSE(publisher.isAvailable(2));
+  EXPECT_TRUE(publisher.isAvailable(3));
+  EXPECT_FALSE(publisher.isAvailable(4));
+  EXPECT_TRUE(publisher.isAvailable(5));
+  EXPECT_FALSE(publisher.isAvailable(6));
+}
+
+TEST(ParityBitmapAvailableBufferTest, shouldFindHighestPublishedSequenceAcrossWords) {
+  disruptor::ParityBitmapAvailableBuffer buffer(1024);
+
+  buffer.setAvailable(0, 199);
+  buffer.setAvailable(201, 300);
+
+  EXPECT_EQ(199, buffer.getHighestPublishedSequence(0, 300));
+  EXPECT_EQ(150, buffer.getHighestPublishedSequence(70, 150));
+  EXPECT_EQ(-1, buffer.getHighestPublishedSequence(0, -1));
+
+  buffer.setAvailable(200);
+  EXPECT_EQ(300, buffer.getHighestPublishedSequence(0, 400));
+}
+
+TEST(ParityBitmapAvailableBufferTest, shouldTrackParityAcrossLaps) {
+  disruptor::ParityBitmapAvailableBuffer buffer(128);
+
+  buffer.setAvailable(0, 127);
+  EXPECT_EQ(127, buffer.getHighestPublishedSequence(0, 127));
+  EXPECT_FALSE(buffer.isAvailable(128));
+
+  // Second lap, published out of order and spanning the ring's end.
+  buffer.setAvailable(128, 190);
+  buffer.setAvailable(192, 240);
+  EXPECT_EQ(190, buffer.getHighestPublishedSequence(120, 240));
+
+  buffer.setAvailable(191);
+  buffer.setAvailable(241, 300);
+  EXPECT_EQ(300, buffer.getHighestPublishedSequence(200, 320));
+  EXPECT_FALSE(buffer.isAvailable(301));
+  EXPECT_TRUE(buffer.isAvailable(300));
+}
+
+TEST(ParityBitmapAvailableBufferTest, shouldHandleRingsSmallerThanAWord) {
+  disruptor::ParityBitmapAvailableBuffer buffer(8);
+
+  buffer.setAvailable(0, 7);
+  buffer.setAvailable(8, 10);
+  EXPECT_EQ(10, buffer.getHighestPublishedSequence(3, 15));
+
+  buffer.setAvailable(11, 17);
+  EXPECT_EQ(17, buffer.getHighestPublishedSequence(10, 17));
+  EXPECT_FALSE(buffer.isAvailable(18));
+}
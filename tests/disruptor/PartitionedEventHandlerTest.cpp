@@ -0,0 +1,213 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/EventHandler.h"
+#include "disruptor/ExceptionHandler.h"
+#include "disruptor/PartitionedEventHandler.h"
+#include "disruptor/YieldingWaitStrategy.h"
+#include "disruptor/dsl/Disruptor.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+struct KeyedEvent {
+  int64_t key{0};
+  int64_t value{0};
+  int partitionSeen{-1};
+};
+
+struct KeyedEventFactory final : public disruptor::EventFactory<KeyedEvent> {
+  KeyedEvent newInstance() override {
+    return KeyedEvent();
+  }
+};
+
+// Records (key, value) pairs and which endOfBatch flags it saw.
+class RecordingHandler final : public disruptor::EventHandler<KeyedEvent> {
+public:
+  explicit RecordingHandler(int partition = 0) : partition_(partition) {}
+
+  void onEvent(KeyedEvent& event, int64_t sequence, bool endOfBatch) override {
+    event.partitionSeen = partition_;
+    seen_.emplace_back(event.key, event.value);
+    sequences_.push_back(sequence);
+    endOfBatches_.push_back(endOfBatch);
+  }
+
+  std::vector<std::pair<int64_t, int64_t>> seen_;
+  std::vector<int64_t> sequences_;
+  std::vector<bool> endOfBatches_;
+
+private:
+  int partition_;
+};
+
+class PartitionChecker final : public disruptor::EventHandler<KeyedEvent> {
+public:
+  explicit PartitionChecker(int partitions) : partitions_(partitions) {}
+
+  void onEvent(KeyedEvent& event, int64_t, bool) override {
+    wrong_ += event.partitionSeen == static_cast<int>(event.key % partitions_) ? 0 : 1;
+    event.partitionSeen = -1;
+    ++count_;
+  }
+
+  int64_t count_{0};
+  int64_t wrong_{0};
+
+private:
+  int partitions_;
+};
+
+class ThrowOnFirstEventHandler final : public disruptor::EventHandler<KeyedEvent> {
+public:
+  void onEvent(KeyedEvent&, int64_t sequence, bool endOfBatch) override {
+    sequences_.push_back(sequence);
+    endOfBatches_.push_back(endOfBatch);
+    if (sequence == 0) {
+      throw std::runtime_error("first event");
+    }
+  }
+
+  std::vector<int64_t> sequences_;
+  std::vector<bool> endOfBatches_;
+};
+
+class RecordingExceptionHandler final : public disruptor::ExceptionHandler<KeyedEvent> {
+public:
+  void handleEventException(const std::exception&, int64_t sequence, KeyedEvent* event) override {
+    sequences_.push_back(sequence);
+    keys_.push_back(event != nullptr ? event->key : -1);
+  }
+
+  void handleOnStartException(const std::exception&) override {}
+
+  void handleOnShutdownException(const std::exception&) override {}
+
+  std::vector<int64_t> sequences_;
+  std::vector<int64_t> keys_;
+};
+
+using WS = disruptor::YieldingWaitStrategy;
+using DisruptorT = disruptor::dsl::Disruptor<KeyedEvent, disruptor::dsl::ProducerType::SINGLE, WS>;
+}  // namespace
+
+TEST(PartitionedEventHandlerTest, shouldDeliverOnlyItsPartitionWithEndOfBatchOnItsLastEvent) {
+  disruptor::PartitionTags tags(8, 2);
+  RecordingHandler handler;
+  disruptor::PartitionedEventHandler<KeyedEvent> adapter(handler, tags, 1);
+  std::vector<KeyedEvent> events(8);
+  for (int64_t s = 0; s < 8; ++s) {
+    events[static_cast<std::size_t>(s)].key = s;
+    tags.tag(s, static_cast<std::uint64_t>(s < 4 ? 1 : 0));
+  }
+
+  adapter.onBatchStart(6, 6);
+  for (int64_t s = 0; s < 6; ++s) {
+    adapter.onEvent(events[static_cast<std::size_t>(s)], s, s == 5);
+  }
+
+  EXPECT_EQ((std::vector<int64_t>{0, 1, 2, 3}), handler.sequences_);
+  EXPECT_EQ((std::vector<bool>{false, false, false, true}), handler.endOfBatches_);
+  EXPECT_THROW(disruptor::PartitionedEventHandler<KeyedEvent>(handler, tags, 2),
+               std::invalid_argument);
+  EXPECT_THROW(disruptor::PartitionTags(8, 0), std::invalid_argument);
+}
+
+TEST(PartitionedEventHandlerTest, shouldSpreadKeysOverPartitionsKeepingPerKeyOrder) {
+  constexpr int kPartitions = 3;
+  constexpr int kKeys = 12;
+  constexpr int kEvents = 6000;
+  constexpr int kRingSize = 64;
+  WS ws;
+  DisruptorT d(std::make_shared<KeyedEventFactory>(), kRingSize,
+               disruptor::util::DaemonThreadFactory::INSTANCE(), ws);
+  disruptor::PartitionTags tags(kRingSize, kPartitions);
+  RecordingHandler p0(0);
+  RecordingHandler p1(1);
+  RecordingHandler p2(2);
+  PartitionChecker checker(kPartitions);
+  d.handleEventsWithPartitioned(tags, p0, p1, p2).then(checker);
+  d.start();
+
+  auto& ringBuffer = d.getRingBuffer();
+  for (int i = 0; i < kEvents; ++i) {
+    const int64_t sequence = ringBuffer.next();
+    auto& event = ringBuffer.get(sequence);
+    event.key = i % kKeys;
+    event.value = i;
+    tags.tag(sequence, static_cast<std::uint64_t>(event.key));
+    ringBuffer.publish(sequence);
+  }
+  while (d.getSequenceValueFor(checker) < ringBuffer.getCursor()) {
+    std::this_thread::yield();
+  }
+  EXPECT_EQ(ringBuffer.getCursor(), d.getSequenceValueFor(p1));
+  d.halt();
+  d.join();
+
+  EXPECT_EQ(kEvents, checker.count_);
+  EXPECT_EQ(0, checker.wrong_);
+  const RecordingHandler* partitions[] = {&p0, &p1, &p2};
+  int64_t total = 0;
+  for (int p = 0; p < kPartitions; ++p) {
+    std::vector<int64_t> lastValue(kKeys, -1);
+    for (const auto& [key, value] : partitions[p]->seen_) {
+      ASSERT_EQ(p, key % kPartitions);
+      ASSERT_LT(lastValue[static_cast<std::size_t>(key)], value);
+      lastValue[static_cast<std::size_t>(key)] = value;
+    }
+    total += static_cast<int64_t>(partitions[p]->seen_.size());
+  }
+  EXPECT_EQ(kEvents, total);
+}
+
+TEST(PartitionedEventHandlerTest, shouldRejectTagsThatDoNotMatchTheGroup) {
+  WS ws;
+  DisruptorT d(std::make_shared<KeyedEventFactory>(), 64,
+               disruptor::util::DaemonThreadFactory::INSTANCE(), ws);
+  RecordingHandler p0;
+  RecordingHandler p1;
+
+  disruptor::PartitionTags threePartitions(64, 3);
+  EXPECT_THROW(d.handleEventsWithPartitioned(threePartitions, p0, p1), std::invalid_argument);
+  disruptor::PartitionTags wrongSize(128, 2);
+  EXPECT_THROW(d.handleEventsWithPartitioned(wrongSize, p0, p1), std::invalid_argument);
+}
+
+TEST(PartitionedEventHandlerTest, shouldReportTheSequenceOfTheEventThatThrew) {
+  WS ws;
+  DisruptorT d(std::make_shared<KeyedEventFactory>(), 8,
+               disruptor::util::DaemonThreadFactory::INSTANCE(), ws);
+  disruptor::PartitionTags tags(8, 1);
+  ThrowOnFirstEventHandler handler;
+  RecordingExceptionHandler exceptionHandler;
+  d.handleExceptionsWith(exceptionHandler);
+  d.handleEventsWithPartitioned(tags, handler);
+
+  // Both events published before the processor starts: one batch.
+  auto& ringBuffer = d.getRingBuffer();
+  const int64_t hi = ringBuffer.next(2);
+  for (int64_t sequence = hi - 1; sequence <= hi; ++sequence) {
+    ringBuffer.get(sequence).key = sequence + 10;
+    tags.tag(sequence, 0);
+  }
+  ringBuffer.publish(hi - 1, hi);
+  d.start();
+  while (d.getSequenceValueFor(handler) < hi) {
+    std::this_thread::yield();
+  }
+  d.halt();
+  d.join();
+
+  EXPECT_EQ((std::vector<int64_t>{0}), exceptionHandler.sequences_);
+  EXPECT_EQ((std::vector<int64_t>{10}), exceptionHandler.keys_);
+  EXPECT_EQ((std::vector<int64_t>{0, 1}), handler.sequences_);
+  EXPECT_EQ((std::vector<bool>{false, true}), handler.endOfBatches_);
+}
@@ -6,8 +6,24 @@
 #include "disruptor/Sequence.h"
 #include "tests/disruptor/support/StubEvent.h"
 
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
 #include <string>
 
+namespace {
+struct ValueEvent {
+  int64_t value{0};
+};
+
+struct ValueEventFactory final : public disruptor::EventFactory<ValueEvent> {
+  ValueEvent newInstance() override {
+    return ValueEvent();
+  }
+};
+}  // namespace
+
 TEST(RingBufferTest, shouldClaimAndGet) {
   using Event = disruptor::support::StubEvent;
   using WS = disruptor::BusySpinWaitStrategy;
@@ -29,6 +45,30 @@ TEST(RingBufferTest, shouldClaimAndGet) {
   EXPECT_EQ(0, ringBuffer->getCursor());
 }
 
+TEST(RingBufferTest, shouldNotGateOnOrWriteCursorThroughNoOpProcessor) {
+  using Event = disruptor::support::StubEvent;
+  using WS = disruptor::BusySpinWaitStrategy;
+  WS ws;
+  auto ringBuffer = disruptor::SingleProducerRingBuffer<Event, WS>::createSingleProducer(
+    disruptor::support::StubEvent::EVENT_FACTORY, 4, ws);
+  for (int i = 0; i < 3; ++i) {
+    ringBuffer->publishEvent(disruptor::support::StubEvent::TRANSLATOR, i, std::string{});
+  }
+
+  using RB = std::remove_reference_t<decltype(*ringBuffer)>;
+  disruptor::NoOpEventProcessor<Event, RB> noop(*ringBuffer);
+  EXPECT_NE(&ringBuffer->getSequencer().cursorSequence(), &noop.getSequence());
+  ringBuffer->addGatingSequences(noop.getSequence());
+  EXPECT_EQ(2, ringBuffer->getCursor());
+
+  // Three laps past registration without a consumer: the follower never gates.
+  for (int i = 0; i < 12; ++i) {
+    ringBuffer->publishEvent(disruptor::support::StubEvent::TRANSLATOR, i, std::string{});
+  }
+  EXPECT_EQ(14, ringBuffer->getCursor());
+  EXPECT_TRUE(ringBuffer->hasAvailableCapacity(4));
+}
+
 TEST(RingBufferTest, shouldPreventWrapping) {
   using Event = disruptor::support::StubEvent;
   using WS = disruptor::BusySpinWaitStrategy;
@@ -67,3 +107,101 @@ TEST(RingBufferTest, shouldThrowExceptionIfBufferIsFull) {
   EXPECT_FALSE(result.has_value());
   EXPECT_EQ(result.error().code, disruptor::ErrorCode::InsufficientCapacity);
 }
+
+TEST(RingBufferTest, shouldClaimAndGetWithCompileTimeBufferSize) {
+  using Event = disruptor::support::StubEvent;
+  using WS = disruptor::BusySpinWaitStrategy;
+  using RB = disruptor::FixedSingleProducerRingBuffer<Event, WS, 4>;
+  WS ws;
+  auto ringBuffer = RB::create(disruptor::support::StubEvent::EVENT_FACTORY, ws);
+  disruptor::Sequence gating(disruptor::Sequencer::INITIAL_CURSOR_VALUE);
+  ringBuffer->addGatingSequences(gating);
+
+  EXPECT_EQ(4, ringBuffer->getBufferSize());
+  for (int i = 0; i < 4; ++i) {
+    ringBuffer->publishEvent(disruptor::support::StubEvent::TRANSLATOR, i, std::string{});
+  }
+  EXPECT_FALSE(ringBuffer->tryPublishEvent(disruptor::support::StubEvent::TRANSLATOR, 4,
+                                           std::string{}));
+
+  gating.set(1);
+  ringBuffer->publishEvent(disruptor::support::StubEvent::TRANSLATOR, 4, std::string{});
+  ringBuffer->publishEvent(disruptor::support::StubEvent::TRANSLATOR, 5, std::string{});
+  EXPECT_EQ(4, ringBuffer->get(4).getValue());
+  EXPECT_EQ(5, ringBuffer->get(1).getValue());
+  EXPECT_EQ(2, ringBuffer->get(2).getValue());
+}
+
+TEST(RingBufferTest, shouldPublishAndPollMultiProducerWithCompileTimeBufferSize) {
+  using Event = disruptor::support::StubEvent;
+  using WS = disruptor::BusySpinWaitStrategy;
+  using RB = disruptor::FixedMultiProducerRingBuffer<Event, WS, 32>;
+  WS ws;
+  auto ringBuffer = RB::create(disruptor::support::StubEvent::EVENT_FACTORY, ws);
+  auto barrier = ringBuffer->newBarrier();
+  disruptor::Sequence gating(disruptor::Sequencer::INITIAL_CURSOR_VALUE);
+  ringBuffer->addGatingSequences(gating);
+
+  int64_t hi = ringBuffer->next(3);
+  ringBuffer->publish(hi - 2, hi);
+  EXPECT_EQ(2, barrier->waitFor(0));
+  EXPECT_EQ(29, ringBuffer->remainingCapacity());
+}
+
+TEST(RingBufferTest, shouldRejectSequencerOfDifferentSizeForCompileTimeBufferSize) {
+  using Event = disruptor::support::StubEvent;
+  using WS = disruptor::BusySpinWaitStrategy;
+  using RB = disruptor::RingBuffer<Event, disruptor::SingleProducerSequencer<WS>, 16>;
+  WS ws;
+  EXPECT_THROW(RB::create(disruptor::support::StubEvent::EVENT_FACTORY, 8, ws),
+               std::invalid_argument);
+}
+
+TEST(RingBufferTest, shouldClaimSpanAcrossTheWrapAndPublishItInOneCall) {
+  using WS = disruptor::BusySpinWaitStrategy;
+  using RB = disruptor::FixedSingleProducerRingBuffer<ValueEvent, WS, 8>;
+  WS ws;
+  auto ringBuffer = RB::create(std::make_shared<ValueEventFactory>(), ws);
+  auto barrier = ringBuffer->newBarrier();
+  disruptor::Sequence gating(disruptor::Sequencer::INITIAL_CURSOR_VALUE);
+  ringBuffer->addGatingSequences(gating);
+  ringBuffer->publish(ringBuffer->claimSpan(5));
+  gating.set(4);
+
+  auto claim = ringBuffer->claimSpan(6);
+  ASSERT_EQ(5, claim.lo);
+  ASSERT_EQ(10, claim.hi);
+  ASSERT_EQ(3U, claim.first.size());
+  ASSERT_EQ(3U, claim.second.size());
+  const ValueEvent values[] = {{50}, {60}, {70}, {80}, {90}, {100}};
+  std::memcpy(claim.first.data(), values, claim.first.size_bytes());
+  std::memcpy(claim.second.data(), values + claim.first.size(), claim.second.size_bytes());
+  EXPECT_EQ(4, ringBuffer->getCursor());
+  ringBuffer->publish(claim);
+
+  EXPECT_EQ(10, barrier->waitFor(5));
+  for (int64_t sequence = 5; sequence <= 10; ++sequence) {
+    EXPECT_EQ(sequence * 10, ringBuffer->get(sequence).value);
+    EXPECT_EQ(&ringBuffer->get(sequence), &claim[static_cast<std::size_t>(sequence - 5)]);
+  }
+}
+
+TEST(RingBufferTest, shouldFailToTryClaimSpanWithoutCapacity) {
+  using WS = disruptor::BusySpinWaitStrategy;
+  WS ws;
+  auto ringBuffer = disruptor::MultiProducerRingBuffer<ValueEvent, WS>::createMultiProducer(
+    std::make_shared<ValueEventFactory>(), 8, ws);
+  disruptor::Sequence gating(disruptor::Sequencer::INITIAL_CURSOR_VALUE);
+  ringBuffer->addGatingSequences(gating);
+
+  EXPECT_FALSE(ringBuffer->tryClaimSpan(9).has_value());
+  auto claim = ringBuffer->tryClaimSpan(8);
+  ASSERT_TRUE(claim.has_value());
+  EXPECT_EQ(8U, claim->first.size());
+  EXPECT_TRUE(claim->second.empty());
+  ringBuffer->publish(*claim);
+
+  auto full = ringBuffer->tryClaimSpan(1);
+  ASSERT_FALSE(full.has_value());
+  EXPECT_EQ(disruptor::ErrorCode::InsufficientCapacity, full.error().code);
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/EventHandler.h"
+#include "disruptor/EventTranslator.h"
+#include "disruptor/FixedSequenceGroup.h"
+#include "disruptor/Sequence.h"
+#include "disruptor/SequenceArray.h"
+#include "disruptor/dsl/Disruptor.h"
+#include "disruptor/dsl/ProducerType.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+#include "tests/disruptor/support/LongEvent.h"
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+class SummingHandler final : public disruptor::EventHandler<disruptor::support::LongEvent> {
+public:
+  void onEvent(disruptor::support::LongEvent& event, int64_t, bool) override {
+    sum_ += event.get();
+    ++count_;
+  }
+
+  int64_t sum_{0};
+  int count_{0};
+};
+
+class ValueTranslator final : public disruptor::EventTranslator<disruptor::support::LongEvent> {
+public:
+  void translateTo(disruptor::support::LongEvent& event, int64_t sequence) override {
+    event.set(sequence);
+  }
+};
+}  // namespace
+
+TEST(SequenceArrayTest, shouldFindMinimumAtEveryPositionAndLength) {
+  constexpr int64_t kMax = (std::numeric_limits<int64_t>::max)();
+  for (int count = 1; count <= 20; ++count) {
+    disruptor::SequenceArray sequences(count);
+    for (int i = 0; i < count; ++i) {
+      sequences[i].set(100 + i);
+    }
+    for (int position = 0; position < count; ++position) {
+      const int64_t saved = sequences[position].get();
+      sequences[position].set(-7);
+      EXPECT_EQ(-7, sequences.minimum()) << count << "/" << position;
+      EXPECT_EQ(-7, disruptor::SequenceArray::minimumOf(&sequences[0], count, kMax));
+      sequences[position].set(saved);
+    }
+    EXPECT_EQ(100, sequences.minimum());
+    EXPECT_EQ(50, sequences.minimum(50));
+  }
+}
+
+TEST(SequenceArrayTest, shouldKeepSequencesContiguousAndPadded) {
+  disruptor::SequenceArray sequences(4);
+  EXPECT_EQ(4, sequences.capacity());
+  EXPECT_EQ(disruptor::Sequence::INITIAL_VALUE, sequences.minimum());
+  EXPECT_EQ(&sequences[0] + 3, &sequences[3]);
+  EXPECT_TRUE(sequences.contains(sequences[3]));
+
+  disruptor::Sequence outside;
+  EXPECT_FALSE(sequences.contains(outside));
+  EXPECT_THROW(disruptor::SequenceArray(0), std::invalid_argument);
+}
+
+TEST(SequenceArrayTest, shouldScanContiguousFixedSequenceGroup) {
+  disruptor::SequenceArray sequences(9);
+  std::vector<disruptor::Sequence*> pointers;
+  for (int i = 0; i < 9; ++i) {
+    sequences[i].set(20 - i);
+    pointers.push_back(&sequences[i]);
+  }
+  disruptor::FixedSequenceGroup group(pointers.data(), 9);
+  EXPECT_EQ(12, group.get());
+
+  std::swap(pointers[0], pointers[8]);
+  disruptor::FixedSequenceGroup shuffled(pointers.data(), 9);
+  EXPECT_EQ(12, shuffled.get());
+}
+
+TEST(SequenceArrayTest, shouldGateRingOnGroupedHandlersBuiltByDsl) {
+  using Event = disruptor::support::LongEvent;
+  using WS = disruptor::BusySpinWaitStrategy;
+  constexpr int kEvents = 1000;
+  WS ws;
+  disruptor::dsl::Disruptor<Event, disruptor::dsl::ProducerType::SINGLE, WS> d(
+    Event::FACTORY, 16, disruptor::util::DaemonThreadFactory::INSTANCE(), ws);
+  SummingHandler first;
+  SummingHandler second;
+  SummingHandler third;
+  SummingHandler last;
+  d.handleEventsWith(first, second, third).then(last);
+  d.start();
+
+  ValueTranslator translator;
+  for (int i = 0; i < kEvents; ++i) {
+    d.publishEvent(translator);
+  }
+  while (d.getSequenceValueFor(last) < kEvents - 1) {
+    std::this_thread::yield();
+  }
+  d.halt();
+  d.join();  // Wait for consumer threads to finish before handlers are destroyed
+
+  constexpr int64_t kSum = int64_t{kEvents - 1} * kEvents / 2;
+  for (const SummingHandler* handler : {&first, &second, &third, &last}) {
+    EXPECT_EQ(kEvents, handler->count_);
+    EXPECT_EQ(kSum, handler->sum_);
+  }
+}
@@ -1,12 +1,15 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
+#include <limits>
 #include <memory>
 #include <thread>
 
 #include "disruptor/AlertException.h"
 #include "disruptor/BusySpinWaitStrategy.h"
 #include "disruptor/NoOpEventProcessor.h"
+#include "disruptor/ProcessingSequenceBarrier.h"
 #include "disruptor/RingBuffer.h"
 #include "disruptor/Sequence.h"
 #include "tests/disruptor/support/DummyEventProcessor.h"
@@ -24,17 +27,25 @@ void fillRingBuffer(RB& ringBuffer, int64_t expectedNumberMessages) {
   }
 }
 
-class CountDownLatchSequence final : public disruptor::Sequence {
+// Java overrides Sequence.get() to count down on every read. Sequence is final
+// in C++, so the counting happens in a custom dependent-sequence type instead.
+class CountDownLatchSequenceGroup final {
 public:
-  CountDownLatchSequence(int64_t initialValue, disruptor::test_support::CountDownLatch& latch)
-    : disruptor::Sequence(initialValue), latch_(&latch) {}
-
-  int64_t get() const noexcept override {
-    latch_->countDown();
-    return disruptor::Sequence::get();
+  CountDownLatchSequenceGroup(const std::array<disruptor::Sequence*, 3>& sequences,
+                              disruptor::test_support::CountDownLatch& latch)
+    : sequences_(sequences), latch_(&latch) {}
+
+  int64_t get() const noexcept {
+    int64_t minimum = std::numeric_limits<int64_t>::max();
+    for (auto* sequence : sequences_) {
+      latch_->countDown();
+      minimum = std::min(minimum, sequence->get());
+    }
+    return minimum;
   }
 
 private:
+  std::array<disruptor::Sequence*, 3> sequences_;
   disruptor::test_support::CountDownLatch* latch_;
 };
 }  // namespace
@@ -112,12 +123,16 @@ TEST_F(SequenceBarrierTestFixture, shouldInterruptDuringBusySpin) {
   fillRingBuffer(*ringBuffer, expectedNumberMessages);
 
   disruptor::test_support::CountDownLatch latch(3);
-  CountDownLatchSequence sequence1(8, latch);
-  CountDownLatchSequence sequence2(8, latch);
-  CountDownLatchSequence sequence3(8, latch);
+  disruptor::Sequence sequence1(8);
+  disruptor::Sequence sequence2(8);
+  disruptor::Sequence sequence3(8);
 
   std::array<disruptor::Sequence*, 3> deps = {&sequence1, &sequence2, &sequence3};
-  auto sequenceBarrier = ringBuffer->newBarrier(deps.data(), 3);
+  using BarrierT =
+    disruptor::ProcessingSequenceBarrier<RB::SequencerType, WS, CountDownLatchSequenceGroup>;
+  auto& sequencer = ringBuffer->getSequencer();
+  auto sequenceBarrier = std::make_shared<BarrierT>(sequencer, ws, sequencer.cursorSequence(),
+                                                    CountDownLatchSequenceGroup(deps, latch));
 
   std::thread t([&] {
     EXPECT_THROW((void)sequenceBarrier->waitFor(expectedNumberMessages - 1),
@@ -167,3 +182,18 @@ TEST_F(SequenceBarrierTestFixture, shouldSetAndClearAlertStatus) {
   sequenceBarrier->clearAlert();
   EXPECT_FALSE(sequenceBarrier->isAlerted());
 }
+
+TEST_F(SequenceBarrierTestFixture, shouldReportAlertAndAvailableSequenceFromTryWaitFor) {
+  fillRingBuffer(*ringBuffer, 4);
+  auto sequenceBarrier = ringBuffer->newBarrier(nullptr, 0);
+
+  const disruptor::WaitResult available = sequenceBarrier->tryWaitFor(2);
+  ASSERT_TRUE(available.has_value());
+  EXPECT_EQ(3, *available);
+
+  std::thread t([&] { sequenceBarrier->alert(); });
+  const disruptor::WaitResult alerted = sequenceBarrier->tryWaitFor(10);
+  t.join();
+  ASSERT_FALSE(alerted.has_value());
+  EXPECT_EQ(disruptor::ErrorCode::Alerted, alerted.error());
+}
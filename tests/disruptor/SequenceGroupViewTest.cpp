@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <stdexcept>
+#include <type_traits>
+
+#include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/Sequence.h"
+#include "disruptor/SequenceGroupView.h"
+#include "tests/disruptor/support/StubEvent.h"
+
+TEST(SequenceGroupViewTest, shouldReturnMinimumOf2Sequences) {
+  disruptor::Sequence sequence1(34);
+  disruptor::Sequence sequence2(47);
+  std::array<disruptor::Sequence*, 2> sequences = {&sequence1, &sequence2};
+  disruptor::SequenceGroupView<2> group(sequences);
+
+  EXPECT_EQ(34, group.get());
+  sequence1.set(35);
+  EXPECT_EQ(35, group.get());
+  sequence1.set(48);
+  EXPECT_EQ(47, group.get());
+}
+
+TEST(SequenceGroupViewTest, shouldRejectMismatchedCount) {
+  disruptor::Sequence sequence1(1);
+  std::array<disruptor::Sequence*, 1> sequences = {&sequence1};
+  EXPECT_THROW((disruptor::SequenceGroupView<2>(sequences.data(), 1)), std::invalid_argument);
+}
+
+TEST(SequenceGroupViewTest, shouldSelectGroupTypeForBarrierAndPollerAtCompileTime) {
+  using Event = disruptor::support::StubEvent;
+  using WS = disruptor::BusySpinWaitStrategy;
+  using RB = disruptor::SingleProducerRingBuffer<Event, WS>;
+  WS ws;
+  auto ringBuffer = RB::createSingleProducer(disruptor::support::StubEvent::EVENT_FACTORY, 16, ws);
+
+  disruptor::Sequence dependent1(-1);
+  disruptor::Sequence dependent2(-1);
+  std::array<disruptor::Sequence*, 2> dependents = {&dependent1, &dependent2};
+  std::array<disruptor::Sequence*, 1> gating = {&dependent1};
+  auto barrier = ringBuffer->newBarrier(dependents);
+  auto cursorBarrier = ringBuffer->newBarrier(std::array<disruptor::Sequence*, 0>{});
+  auto poller = ringBuffer->newPoller(gating);
+
+  using BarrierT = typename decltype(barrier)::element_type;
+  using CursorBarrierT = typename decltype(cursorBarrier)::element_type;
+  using PollerT = typename decltype(poller)::element_type;
+  static_assert(
+    std::is_same_v<BarrierT::DependentSequenceType, disruptor::SequenceGroupView<2>>);
+  static_assert(
+    std::is_same_v<CursorBarrierT::DependentSequenceType, disruptor::SequenceGroupView<1>>);
+
+  for (int i = 0; i < 4; ++i) {
+    ringBuffer->publish(ringBuffer->next());
+  }
+  dependent1.set(3);
+  dependent2.set(2);
+
+  EXPECT_EQ(3, cursorBarrier->waitFor(0));
+  EXPECT_EQ(2, barrier->waitFor(0));
+  EXPECT_EQ(2, barrier->getCursor());
+
+  struct CountingHandler final : public PollerT::Handler {
+    int count = 0;
+    bool onEvent(Event& /*event*/, int64_t /*sequence*/, bool /*endOfBatch*/) override {
+      ++count;
+      return true;
+    }
+  } handler;
+  EXPECT_EQ(PollerT::PollState::PROCESSING, poller->poll(handler));
+  EXPECT_EQ(4, handler.count);
+}
@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/EventHandler.h"
+#include "disruptor/SharedMemoryEventProcessor.h"
+#include "disruptor/SharedMemoryRingBuffer.h"
+#include "disruptor/YieldingWaitStrategy.h"
+#include "disruptor/util/SharedMemorySegment.h"
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+
+// SharedMemorySegment is only implemented on Linux.
+#if defined(__linux__)
+#  include <sys/wait.h>
+#  include <unistd.h>
+
+namespace {
+struct Order {
+  int64_t id;
+  double price;
+};
+
+using WS = disruptor::YieldingWaitStrategy;
+using OrderRing = disruptor::SharedMemoryRingBuffer<Order, WS>;
+
+class SummingHandler final : public disruptor::EventHandler<Order> {
+public:
+  void onEvent(Order& event, int64_t, bool) override {
+    sum_ += event.id;
+  }
+
+  int64_t sum_{0};
+};
+
+disruptor::util::SharedMemorySegment duplicate(const disruptor::util::SharedMemorySegment& s) {
+  return disruptor::util::SharedMemorySegment::fromFd(::dup(s.fd()));
+}
+}  // namespace
+
+TEST(SharedMemoryRingBufferTest, shouldSeeEventsThroughAnotherMapping) {
+  WS ws;
+  auto producer = OrderRing::create(
+    disruptor::util::SharedMemorySegment::createAnonymous(OrderRing::requiredBytes(16, 2)), 16, 2,
+    ws);
+  auto consumer = OrderRing::attach(duplicate(producer->segment()), ws);
+  ASSERT_NE(producer->segment().data(), consumer->segment().data());
+  EXPECT_EQ(16, consumer->getBufferSize());
+  EXPECT_EQ(2, consumer->getMaxConsumers());
+
+  const int slot = consumer->addConsumer();
+  for (int64_t i = 0; i < 20; ++i) {
+    const int64_t sequence = producer->next();
+    producer->get(sequence) = Order{i, 1.5};
+    producer->publish(sequence);
+    EXPECT_EQ(i, consumer->get(sequence).id);
+    consumer->consumerSequence(slot).set(sequence);
+  }
+  EXPECT_EQ(19, consumer->getCursor());
+  EXPECT_TRUE(consumer->isAvailable(19));
+  EXPECT_FALSE(consumer->isAvailable(20));
+}
+
+TEST(SharedMemoryRingBufferTest, shouldAttachToNamedSegment) {
+  const std::string name = "disruptor-test-" + std::to_string(::getpid());
+  WS ws;
+  std::shared_ptr<OrderRing> producer;
+  try {
+    producer = OrderRing::create(
+      disruptor::util::SharedMemorySegment::create(name, OrderRing::requiredBytes(8, 1)), 8, 1, ws);
+  } catch (const std::system_error&) {
+    GTEST_SKIP() << "/dev/shm not available";
+  }
+  auto consumer = OrderRing::attach(disruptor::util::SharedMemorySegment::open(name), ws);
+  disruptor::util::SharedMemorySegment::unlink(name);
+
+  const int64_t sequence = producer->next();
+  producer->get(sequence) = Order{7, 2.0};
+  producer->publish(sequence);
+  EXPECT_EQ(7, consumer->get(0).id);
+  EXPECT_THROW(disruptor::util::SharedMemorySegment::open(name), std::system_error);
+}
+
+TEST(SharedMemoryRingBufferTest, shouldGateProducersOnConsumerSlots) {
+  WS ws;
+  auto ring = OrderRing::create(
+    disruptor::util::SharedMemorySegment::createAnonymous(OrderRing::requiredBytes(4, 1)),
+    4, 1, ws);
+  const int slot = ring->addConsumer();
+  EXPECT_THROW(ring->addConsumer(), std::runtime_error);
+
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_TRUE(ring->tryNext().has_value());
+  }
+  EXPECT_FALSE(ring->tryNext().has_value());
+
+  ring->consumerSequence(slot).set(1);
+  EXPECT_EQ(2, ring->remainingCapacity());
+  ring->removeConsumer(slot);
+  EXPECT_EQ(4, ring->remainingCapacity());
+}
+
+TEST(SharedMemoryRingBufferTest, shouldStartLateConsumerAfterEarlierEvents) {
+  WS ws;
+  auto producer = OrderRing::create(
+    disruptor::util::SharedMemorySegment::createAnonymous(OrderRing::requiredBytes(8, 1)), 8, 1,
+    ws);
+  auto consumer = OrderRing::attach(duplicate(producer->segment()), ws);
+  for (int64_t i = 0; i < 5; ++i) {
+    const int64_t sequence = producer->next();
+    producer->get(sequence) = Order{100, 0.0};
+    producer->publish(sequence);
+  }
+
+  const int slot = consumer->addConsumer();
+  auto barrier = consumer->newBarrier(nullptr, 0);
+  SummingHandler handler;
+  disruptor::SharedMemoryEventProcessor<Order, OrderRing::BarrierT> processor(
+    *consumer, *barrier, handler, consumer->consumerSequence(slot));
+  EXPECT_EQ(4, processor.getSequence().get());
+  std::thread consumerThread([&processor] { processor.run(); });
+  // Eight more: the producer's mapping gates on the slot the other one took.
+  for (int64_t i = 0; i < 8; ++i) {
+    const int64_t sequence = producer->next();
+    producer->get(sequence) = Order{i, 0.0};
+    producer->publish(sequence);
+  }
+  while (processor.getSequence().get() < 12) {
+    std::this_thread::yield();
+  }
+  processor.halt();
+  consumerThread.join();
+
+  EXPECT_EQ(28, handler.sum_);
+}
+
+TEST(SharedMemoryRingBufferTest, shouldRejectSegmentForAnotherEventType) {
+  WS ws;
+  auto ring = OrderRing::create(
+    disruptor::util::SharedMemorySegment::createAnonymous(OrderRing::requiredBytes(8, 1)),
+    8, 1, ws);
+  EXPECT_THROW((disruptor::SharedMemoryRingBuffer<int32_t, WS>::attach(
+                 duplicate(ring->segment()), ws)),
+               std::runtime_error);
+  EXPECT_THROW(OrderRing::attach(disruptor::util::SharedMemorySegment::createAnonymous(4096), ws),
+               std::runtime_error);
+}
+
+TEST(SharedMemoryRingBufferTest, shouldConsumeEventsPublishedByAnotherProcess) {
+  constexpr int kEvents = 1000;
+  WS ws;
+  auto ring = OrderRing::create(
+    disruptor::util::SharedMemorySegment::createAnonymous(OrderRing::requiredBytes(1024, 1)), 1024,
+    1, ws);
+  const int slot = ring->addConsumer();
+
+  const pid_t child = ::fork();
+  ASSERT_NE(-1, child);
+  if (child == 0) {
+    try {
+      WS childWs;
+      auto producer = OrderRing::attach(duplicate(ring->segment()), childWs);
+      for (int64_t i = 0; i < kEvents; ++i) {
+        const int64_t sequence = producer->next();
+        producer->get(sequence) = Order{i, 0.0};
+        producer->publish(sequence);
+      }
+    } catch (...) {
+      ::_exit(1);
+    }
+    ::_exit(0);
+  }
+
+  auto barrier = ring->newBarrier(nullptr, 0);
+  SummingHandler handler;
+  disruptor::SharedMemoryEventProcessor<Order, OrderRing::BarrierT> processor(
+    *ring, *barrier, handler, ring->consumerSequence(slot));
+  std::thread consumerThread([&processor] { processor.run(); });
+  while (processor.getSequence().get() < kEvents - 1) {
+    std::this_thread::yield();
+  }
+  processor.halt();
+  consumerThread.join();
+
+  int status = 0;
+  ASSERT_EQ(child, ::waitpid(child, &status, 0));
+  EXPECT_TRUE(WIFEXITED(status));
+  EXPECT_EQ(0, WEXITSTATUS(status));
+  EXPECT_EQ(int64_t{kEvents} * (kEvents - 1) / 2, handler.sum_);
+}
+#endif
@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/BatchEventProcessor.h"
+#include "disruptor/EventHandler.h"
+#include "disruptor/ExceptionHandler.h"
+#include "disruptor/RewindableEventHandler.h"
+#include "disruptor/RewindableException.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/SimpleBatchRewindStrategy.h"
+#include "disruptor/YieldingWaitStrategy.h"
+#include "disruptor/dsl/Disruptor.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+#include "tests/disruptor/support/LongEvent.h"
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace {
+using Event = disruptor::support::LongEvent;
+using WS = disruptor::YieldingWaitStrategy;
+using RB = disruptor::SingleProducerRingBuffer<Event, WS>;
+using Barrier = std::remove_reference_t<decltype(*std::declval<RB&>().newBarrier())>;
+using DisruptorT = disruptor::dsl::Disruptor<Event, disruptor::dsl::ProducerType::SINGLE, WS>;
+
+class RecordingHandler final : public disruptor::EventHandler<Event> {
+public:
+  void onEvent(Event& event, int64_t /*sequence*/, bool endOfBatch) override {
+    values_.push_back(event.get());
+    endOfBatch_.push_back(endOfBatch);
+  }
+
+  std::vector<int64_t> values_;
+  std::vector<bool> endOfBatch_;
+};
+
+class RewindOnceHandler final : public disruptor::RewindableEventHandler<Event> {
+public:
+  void onEvent(Event& event, int64_t sequence, bool /*endOfBatch*/) override {
+    if (sequence == 2 && !rewound_) {
+      rewound_ = true;
+      throw disruptor::RewindableException("retry");
+    }
+    values_.push_back(event.get());
+  }
+
+  std::vector<int64_t> values_;
+
+private:
+  bool rewound_{false};
+};
+
+class ThrowingHandler final : public disruptor::EventHandler<Event> {
+public:
+  void onEvent(Event& /*event*/, int64_t /*sequence*/, bool /*endOfBatch*/) override {
+    throw std::runtime_error("bad event");
+  }
+};
+
+class RecordingExceptionHandler final : public disruptor::ExceptionHandler<Event> {
+public:
+  void handleEventException(const std::exception&, int64_t sequence, Event*) override {
+    lastSequence_.store(sequence, std::memory_order_release);
+  }
+
+  void handleOnStartException(const std::exception&) override {}
+
+  void handleOnShutdownException(const std::exception&) override {}
+
+  std::atomic<int64_t> lastSequence_{-1};
+};
+
+static_assert(disruptor::StaticDispatchHandler<RecordingHandler, Event>);
+static_assert(!disruptor::StaticDispatchHandler<disruptor::EventHandler<Event>, Event>);
+
+void publishRange(RB& ringBuffer, int count) {
+  const int64_t hi = ringBuffer.next(count);
+  for (int64_t sequence = hi - count + 1; sequence <= hi; ++sequence) {
+    ringBuffer.get(sequence).set(sequence * 10);
+  }
+  ringBuffer.publish(hi - count + 1, hi);
+}
+
+template <typename Processor>
+void waitForSequence(Processor& processor, int64_t sequence) {
+  while (processor.getSequence().get() < sequence) {
+    std::this_thread::yield();
+  }
+}
+}  // namespace
+
+TEST(StaticBatchEventProcessorTest, shouldDeliverEventsToAConcreteHandler) {
+  WS ws;
+  auto ringBuffer = RB::createSingleProducer(Event::FACTORY, 16, ws);
+  auto barrier = ringBuffer->newBarrier();
+  RecordingHandler handler;
+  disruptor::StaticBatchEventProcessor<Event, RecordingHandler, Barrier, RB> processor(
+    *ringBuffer, *barrier, handler, 3, nullptr);
+  ringBuffer->addGatingSequences(processor.getSequence());
+
+  publishRange(*ringBuffer, 5);
+  std::thread thread([&] { processor.run(); });
+  waitForSequence(processor, 4);
+  processor.halt();
+  thread.join();
+
+  EXPECT_EQ((std::vector<int64_t>{0, 10, 20, 30, 40}), handler.values_);
+  EXPECT_EQ((std::vector<bool>{false, false, true, false, true}), handler.endOfBatch_);
+}
+
+TEST(StaticBatchEventProcessorTest, shouldRewindForARewindableHandlerType) {
+  WS ws;
+  auto ringBuffer = RB::createSingleProducer(Event::FACTORY, 16, ws);
+  auto barrier = ringBuffer->newBarrier();
+  RewindOnceHandler handler;
+  disruptor::SimpleBatchRewindStrategy strategy;
+  disruptor::StaticBatchEventProcessor<Event, RewindOnceHandler, Barrier, RB> processor(
+    *ringBuffer, *barrier, handler, std::numeric_limits<int>::max(), &strategy);
+  ringBuffer->addGatingSequences(processor.getSequence());
+
+  publishRange(*ringBuffer, 4);
+  std::thread thread([&] { processor.run(); });
+  waitForSequence(processor, 3);
+  processor.halt();
+  thread.join();
+
+  EXPECT_EQ((std::vector<int64_t>{0, 10, 0, 10, 20, 30}), handler.values_);
+}
+
+TEST(StaticBatchEventProcessorTest, shouldBeCreatedByTheDslForFinalHandlers) {
+  WS ws;
+  DisruptorT d(Event::FACTORY, 64, disruptor::util::DaemonThreadFactory::INSTANCE(), ws);
+  RecordingHandler recording;
+  ThrowingHandler throwing;
+  RecordingExceptionHandler exceptionHandler;
+  d.handleEventsWith(recording, throwing);
+  // Only a StaticBatchEventProcessor for ThrowingHandler accepts this.
+  d.handleExceptionsFor(throwing).with(exceptionHandler);
+  d.start();
+
+  auto& ringBuffer = d.getRingBuffer();
+  for (int i = 0; i < 100; ++i) {
+    const int64_t sequence = ringBuffer.next();
+    ringBuffer.get(sequence).set(sequence * 10);
+    ringBuffer.publish(sequence);
+  }
+  while (d.getSequenceValueFor(recording) < 99 || d.getSequenceValueFor(throwing) < 99) {
+    std::this_thread::yield();
+  }
+  d.halt();
+  d.join();
+
+  ASSERT_EQ(100U, recording.values_.size());
+  for (std::size_t i = 0; i < recording.values_.size(); ++i) {
+    ASSERT_EQ(static_cast<int64_t>(i) * 10, recording.values_[i]);
+  }
+  EXPECT_EQ(99, exceptionHandler.lastSequence_.load(std::memory_order_acquire));
+}
+
+TEST(StaticBatchEventProcessorTest, shouldTakeExceptionHandlerForFinalHandlerPassedThroughItsBase) {
+  WS ws;
+  DisruptorT d(Event::FACTORY, 64, disruptor::util::DaemonThreadFactory::INSTANCE(), ws);
+  ThrowingHandler throwing;
+  RecordingExceptionHandler exceptionHandler;
+  d.handleEventsWith(throwing);
+  disruptor::EventHandler<Event>& base = throwing;
+  d.handleExceptionsFor(base).with(exceptionHandler);
+  d.start();
+
+  auto& ringBuffer = d.getRingBuffer();
+  const int64_t sequence = ringBuffer.next();
+  ringBuffer.publish(sequence);
+  while (d.getSequenceValueFor(throwing) < sequence) {
+    std::this_thread::yield();
+  }
+  d.halt();
+  d.join();
+
+  EXPECT_EQ(sequence, exceptionHandler.lastSequence_.load(std::memory_order_acquire));
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include "disruptor/Error.h"
 #include "disruptor/Sequence.h"
 #include "disruptor/TimeoutBlockingWaitStrategy.h"
 #include "disruptor/TimeoutException.h"
@@ -25,3 +26,14 @@ TEST(TimeoutBlockingWaitStrategyTest, shouldTimeoutWaitFor) {
   const auto waited = std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count();
   EXPECT_GE(waited, theTimeoutMillis);
 }
+
+TEST(TimeoutBlockingWaitStrategyTest, shouldReturnTimeoutFromTryWaitFor) {
+  disruptor::support::DummySequenceBarrier sequenceBarrier;
+  disruptor::TimeoutBlockingWaitStrategy waitStrategy(1'000'000);
+  disruptor::Sequence cursor(5);
+
+  const disruptor::WaitResult result = waitStrategy.tryWaitFor(6, cursor, cursor, sequenceBarrier);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(disruptor::ErrorCode::Timeout, result.error());
+}
@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/BlockingWaitStrategy.h"
+#include "disruptor/EventHandler.h"
+#include "disruptor/FatalExceptionHandler.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/WorkHandler.h"
+#include "disruptor/WorkerPool.h"
+#include "disruptor/YieldingWaitStrategy.h"
+#include "disruptor/dsl/Disruptor.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Java 3.x WorkerPoolTest, plus batched claims and the DSL wiring.
+
+namespace {
+struct CountedEvent {
+  int64_t handled{0};
+};
+
+struct CountedEventFactory final : public disruptor::EventFactory<CountedEvent> {
+  CountedEvent newInstance() override {
+    return CountedEvent();
+  }
+};
+
+class CountingWorkHandler final : public disruptor::WorkHandler<CountedEvent> {
+public:
+  void onEvent(CountedEvent& event) override {
+    ++event.handled;
+    ++count_;
+  }
+
+  int64_t count_{0};
+};
+
+class HandledOnceChecker final : public disruptor::EventHandler<CountedEvent> {
+public:
+  void onEvent(CountedEvent& event, int64_t, bool) override {
+    wrongCounts_ += event.handled == 1 ? 0 : 1;
+    event.handled = 0;
+    ++count_;
+  }
+
+  int64_t count_{0};
+  int64_t wrongCounts_{0};
+};
+
+using WS = disruptor::BlockingWaitStrategy;
+using RingBufferT = disruptor::MultiProducerRingBuffer<CountedEvent, WS>;
+using BarrierT = decltype(std::declval<RingBufferT&>().newBarrier())::element_type;
+using WorkerPoolT = disruptor::WorkerPool<CountedEvent, BarrierT>;
+
+auto factory() {
+  return std::make_shared<CountedEventFactory>();
+}
+}  // namespace
+
+TEST(WorkerPoolTest, shouldProcessEachMessageByOnlyOneWorker) {
+  WS ws;
+  auto ringBuffer = RingBufferT::createMultiProducer(factory(), 1024, ws);
+  auto barrier = ringBuffer->newBarrier();
+  disruptor::FatalExceptionHandler<CountedEvent> exceptionHandler;
+  CountingWorkHandler first;
+  CountingWorkHandler second;
+  std::array<disruptor::WorkHandler<CountedEvent>*, 2> handlers = {&first, &second};
+  WorkerPoolT pool(*ringBuffer, *barrier, exceptionHandler, handlers.data(), 2);
+  auto sequences = pool.getWorkerSequences();
+  ringBuffer->addGatingSequences(sequences.data(), static_cast<int>(sequences.size()));
+  pool.start(disruptor::util::DaemonThreadFactory::INSTANCE());
+
+  ringBuffer->publish(ringBuffer->next());
+  ringBuffer->publish(ringBuffer->next());
+  pool.drainAndHalt();
+  pool.join();
+
+  EXPECT_EQ(1, ringBuffer->get(0).handled);
+  EXPECT_EQ(1, ringBuffer->get(1).handled);
+  EXPECT_EQ(2, first.count_ + second.count_);
+}
+
+TEST(WorkerPoolTest, shouldProcessOnlyOnceItHasBeenPublished) {
+  WS ws;
+  auto ringBuffer = RingBufferT::createMultiProducer(factory(), 1024, ws);
+  auto barrier = ringBuffer->newBarrier();
+  disruptor::FatalExceptionHandler<CountedEvent> exceptionHandler;
+  CountingWorkHandler first;
+  CountingWorkHandler second;
+  std::array<disruptor::WorkHandler<CountedEvent>*, 2> handlers = {&first, &second};
+  WorkerPoolT pool(*ringBuffer, *barrier, exceptionHandler, handlers.data(), 2);
+  auto sequences = pool.getWorkerSequences();
+  ringBuffer->addGatingSequences(sequences.data(), static_cast<int>(sequences.size()));
+  pool.start(disruptor::util::DaemonThreadFactory::INSTANCE());
+
+  ringBuffer->next();
+  ringBuffer->next();
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  pool.halt();
+  pool.join();
+
+  EXPECT_EQ(0, ringBuffer->get(0).handled);
+  EXPECT_EQ(0, ringBuffer->get(1).handled);
+}
+
+TEST(WorkerPoolTest, shouldNotHandleSequencesAClaimChunkSkipped) {
+  WS ws;
+  auto ringBuffer = RingBufferT::createMultiProducer(factory(), 1024, ws);
+  auto barrier = ringBuffer->newBarrier();
+  disruptor::FatalExceptionHandler<CountedEvent> exceptionHandler;
+  CountingWorkHandler first;
+  CountingWorkHandler second;
+  std::array<disruptor::WorkHandler<CountedEvent>*, 2> handlers = {&first, &second};
+  WorkerPoolT pool(*ringBuffer, *barrier, exceptionHandler, handlers.data(), 2);
+  auto sequences = pool.getWorkerSequences();
+  ringBuffer->addGatingSequences(sequences.data(), static_cast<int>(sequences.size()));
+  pool.start(disruptor::util::DaemonThreadFactory::INSTANCE());
+
+  {
+    auto chunk = ringBuffer->newClaimChunk(4);
+    chunk.publish(chunk.next());
+    chunk.publish(chunk.next());
+  }
+  ringBuffer->publish(ringBuffer->next());
+  pool.drainAndHalt();
+  pool.join();
+
+  EXPECT_EQ(3, first.count_ + second.count_);
+  EXPECT_EQ(1, ringBuffer->get(1).handled);
+  EXPECT_EQ(0, ringBuffer->get(2).handled);
+  EXPECT_EQ(0, ringBuffer->get(3).handled);
+  EXPECT_EQ(1, ringBuffer->get(4).handled);
+}
+
+TEST(WorkerPoolTest, shouldHandleEveryEventOnceWithBatchedClaims) {
+  constexpr int kEvents = 20000;
+  using YWS = disruptor::YieldingWaitStrategy;
+  using YRingBufferT = disruptor::SingleProducerRingBuffer<CountedEvent, YWS>;
+  using YBarrierT = decltype(std::declval<YRingBufferT&>().newBarrier())::element_type;
+  YWS ws;
+  auto ringBuffer = YRingBufferT::createSingleProducer(factory(), 64, ws);
+  auto barrier = ringBuffer->newBarrier();
+  disruptor::FatalExceptionHandler<CountedEvent> exceptionHandler;
+  std::array<CountingWorkHandler, 3> workers;
+  std::array<disruptor::WorkHandler<CountedEvent>*, 3> handlers = {&workers[0], &workers[1],
+                                                                   &workers[2]};
+  disruptor::WorkerPool<CountedEvent, YBarrierT> pool(*ringBuffer, *barrier, exceptionHandler,
+                                                      handlers.data(), 3, 8);
+  auto sequences = pool.getWorkerSequences();
+  ringBuffer->addGatingSequences(sequences.data(), static_cast<int>(sequences.size()));
+  pool.start(disruptor::util::DaemonThreadFactory::INSTANCE());
+
+  for (int i = 0; i < kEvents; ++i) {
+    ringBuffer->publish(ringBuffer->next());
+  }
+  pool.drainAndHalt();
+  pool.join();
+
+  int64_t handled = 0;
+  for (const auto& worker : workers) {
+    handled += worker.count_;
+  }
+  EXPECT_EQ(kEvents, handled);
+  // Summed over every lap of the small ring.
+  int64_t total = 0;
+  for (int64_t s = 0; s < 64; ++s) {
+    total += ringBuffer->get(s).handled;
+  }
+  EXPECT_EQ(kEvents, total);
+}
+
+TEST(WorkerPoolTest, shouldGateALaterStageOnTheWorkerPool) {
+  constexpr int kEvents = 10000;
+  using YWS = disruptor::YieldingWaitStrategy;
+  using DisruptorT =
+    disruptor::dsl::Disruptor<CountedEvent, disruptor::dsl::ProducerType::SINGLE, YWS>;
+  YWS ws;
+  DisruptorT d(factory(), 64, disruptor::util::DaemonThreadFactory::INSTANCE(), ws);
+  d.setWorkClaimBatchSize(4);
+  CountingWorkHandler first;
+  CountingWorkHandler second;
+  CountingWorkHandler third;
+  HandledOnceChecker checker;
+  d.handleEventsWithWorkerPool(first, second, third).then(checker);
+  d.start();
+
+  auto& ringBuffer = d.getRingBuffer();
+  for (int i = 0; i < kEvents; ++i) {
+    ringBuffer.publish(ringBuffer.next());
+  }
+  while (d.getSequenceValueFor(checker) < ringBuffer.getCursor()) {
+    std::this_thread::yield();
+  }
+  d.halt();
+  d.join();
+
+  EXPECT_EQ(kEvents, first.count_ + second.count_ + third.count_);
+  EXPECT_EQ(kEvents, checker.count_);
+  EXPECT_EQ(0, checker.wrongCounts_);
+}
@@ -6,6 +6,7 @@
 #include "disruptor/EventHandler.h"
 #include "disruptor/EventTranslatorOneArg.h"
 #include "disruptor/FatalExceptionHandler.h"
+#include "disruptor/NoOpEventProcessor.h"
 #include "disruptor/RewindableEventHandler.h"
 #include "disruptor/TimeoutException.h"
 #include "disruptor/dsl/Disruptor.h"
@@ -1283,3 +1284,39 @@ TEST(DisruptorTest, shouldAllowChainingEventHandlersWithSuperType) {
   d.halt();
   d.join();  // Wait for consumer threads to finish before handlers are destroyed
 }
+
+TEST(DisruptorTest, shouldShutDownWithANoOpProcessorAsAConsumer) {
+  using Event = disruptor::support::TestEvent;
+  using WS = disruptor::BlockingWaitStrategy;
+  using DisruptorT = disruptor::dsl::Disruptor<Event, disruptor::dsl::ProducerType::SINGLE, WS>;
+  auto& tf = disruptor::util::DaemonThreadFactory::INSTANCE();
+  WS ws;
+  disruptor::test_support::CountDownLatch latch(5);
+  LatchHandler handler(latch);
+  auto d = std::make_unique<DisruptorT>(disruptor::support::TestEvent::EVENT_FACTORY, 8, tf, ws);
+
+  disruptor::NoOpEventProcessor<Event, DisruptorT::RingBufferT> noop(d->getRingBuffer());
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+  disruptor::EventProcessor* processors[] = {&noop};
+  d->handleEventsWith(processors, 1);
+  d->after(processors, 1).handleEventsWith(handler);
+  d->start();
+
+  NoOpTranslator translator;
+  for (int i = 0; i < 5; ++i) {
+    d->publishEvent(translator);
+  }
+
+  // The no-op consumer is always caught up with the cursor, so the handler
+  // behind it drains and shutdown finds no backlog.
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (d->getSequenceValueFor(handler) < 4 && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::yield();
+  }
+  EXPECT_EQ(4, d->getSequenceValueFor(handler));
+  EXPECT_FALSE(d->hasBacklog());
+  EXPECT_NO_THROW(d->shutdown(500));
+  d->halt();
+  d->join();
+  d.reset();
+}
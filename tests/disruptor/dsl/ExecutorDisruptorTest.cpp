@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/AsyncWaitStrategy.h"
+#include "disruptor/BatchEventProcessor.h"
+#include "disruptor/EventHandler.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/WorkStealingExecutor.h"
+#include "disruptor/dsl/Disruptor.h"
+#include "disruptor/dsl/ProducerType.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+#include "tests/disruptor/support/LongEvent.h"
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+using Event = disruptor::support::LongEvent;
+using WS = disruptor::AsyncWaitStrategy;
+using RB = disruptor::SingleProducerRingBuffer<Event, WS>;
+using Barrier = std::remove_reference_t<decltype(*std::declval<RB&>().newBarrier())>;
+using DisruptorT = disruptor::dsl::Disruptor<Event, disruptor::dsl::ProducerType::SINGLE, WS>;
+
+class RecordingHandler final : public disruptor::EventHandler<Event> {
+public:
+  void onEvent(Event& event, int64_t /*sequence*/, bool /*endOfBatch*/) override {
+    values_.push_back(event.get());
+  }
+
+  void onStart() override {
+    started_.store(true, std::memory_order_release);
+  }
+
+  void onShutdown() override {
+    shutdown_.store(true, std::memory_order_release);
+  }
+
+  std::vector<int64_t> values_;
+  std::atomic<bool> started_{false};
+  std::atomic<bool> shutdown_{false};
+};
+
+void publishRange(RB& ringBuffer, int count) {
+  for (int i = 0; i < count; ++i) {
+    const int64_t sequence = ringBuffer.next();
+    ringBuffer.get(sequence).set(sequence * 10);
+    ringBuffer.publish(sequence);
+  }
+}
+}  // namespace
+
+TEST(ExecutorDisruptorTest, shouldRunProcessorInSlices) {
+  WS ws;
+  auto ringBuffer = RB::createSingleProducer(Event::FACTORY, 16, ws);
+  auto barrier = ringBuffer->newBarrier();
+  RecordingHandler handler;
+  disruptor::BatchEventProcessor<Event, Barrier> processor(
+    *ringBuffer, *barrier, handler, std::numeric_limits<int>::max(), nullptr);
+  ringBuffer->addGatingSequences(processor.getSequence());
+
+  publishRange(*ringBuffer, 10);
+  ASSERT_TRUE(processor.startSlices());
+  EXPECT_TRUE(handler.started_.load());
+
+  EXPECT_EQ(disruptor::SliceResult::MoreAvailable, processor.runSlice(4));
+  EXPECT_EQ(3, processor.getSequence().get());
+  EXPECT_EQ(disruptor::SliceResult::Idle, processor.runSlice(100));
+  EXPECT_EQ(9, processor.getSequence().get());
+
+  processor.halt();
+  EXPECT_EQ(disruptor::SliceResult::Halted, processor.runSlice(100));
+  processor.endSlices();
+  EXPECT_TRUE(handler.shutdown_.load());
+  EXPECT_FALSE(processor.isRunning());
+  EXPECT_EQ(10U, handler.values_.size());
+}
+
+TEST(ExecutorDisruptorTest, shouldRunManyDisruptorsOnASharedExecutor) {
+  constexpr int kDisruptors = 8;
+  constexpr int kEvents = 500;
+
+  disruptor::WorkStealingExecutor executor(2);
+  WS ws[kDisruptors];
+  std::vector<std::unique_ptr<DisruptorT>> disruptors;
+  std::vector<std::unique_ptr<RecordingHandler>> first;
+  std::vector<std::unique_ptr<RecordingHandler>> second;
+  for (int i = 0; i < kDisruptors; ++i) {
+    disruptors.push_back(std::make_unique<DisruptorT>(
+      Event::FACTORY, 64, disruptor::util::DaemonThreadFactory::INSTANCE(), ws[i]));
+    first.push_back(std::make_unique<RecordingHandler>());
+    second.push_back(std::make_unique<RecordingHandler>());
+    disruptors[i]->runConsumersOn(executor, 16);
+    disruptors[i]->handleEventsWith(*first[i]).then(*second[i]);
+    disruptors[i]->start();
+  }
+
+  for (int n = 0; n < kEvents; ++n) {
+    for (auto& d : disruptors) {
+      auto& ringBuffer = d->getRingBuffer();
+      const int64_t sequence = ringBuffer.next();
+      ringBuffer.get(sequence).set(sequence * 10);
+      ringBuffer.publish(sequence);
+    }
+  }
+  for (int i = 0; i < kDisruptors; ++i) {
+    while (disruptors[i]->getSequenceValueFor(*second[i]) < kEvents - 1) {
+      std::this_thread::yield();
+    }
+    disruptors[i]->halt();
+    disruptors[i]->join();
+  }
+
+  for (int i = 0; i < kDisruptors; ++i) {
+    ASSERT_EQ(static_cast<std::size_t>(kEvents), second[i]->values_.size());
+    EXPECT_EQ(first[i]->values_, second[i]->values_);
+    for (int n = 0; n < kEvents; ++n) {
+      ASSERT_EQ(n * 10, second[i]->values_[static_cast<std::size_t>(n)]);
+    }
+    EXPECT_TRUE(first[i]->shutdown_.load());
+    EXPECT_TRUE(second[i]->shutdown_.load());
+  }
+}
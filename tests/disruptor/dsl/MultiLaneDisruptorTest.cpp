@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/BlockingWaitStrategy.h"
+#include "disruptor/EventHandler.h"
+#include "disruptor/YieldingWaitStrategy.h"
+#include "disruptor/dsl/MultiLaneDisruptor.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+#include "tests/disruptor/support/StubEvent.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+using Event = disruptor::support::StubEvent;
+
+template <typename LaneT>
+void publishFrom(LaneT& lane, int count) {
+  for (int i = 0; i < count; ++i) {
+    const int64_t sequence = lane.next();
+    lane.get(sequence).value = i;
+    lane.publish(sequence);
+  }
+}
+
+class Doubler final : public disruptor::EventHandler<Event> {
+public:
+  void onEvent(Event& event, int64_t, bool) override {
+    event.value *= 2;
+  }
+};
+
+// Records per-lane values; lane() names the lane of the event being handled.
+template <typename DisruptorT>
+class LaneRecordingHandler final : public disruptor::EventHandler<Event> {
+public:
+  LaneRecordingHandler(DisruptorT& disruptor, int laneCount)
+    : disruptor_(&disruptor), values_(static_cast<std::size_t>(laneCount)) {}
+
+  void onEvent(Event& event, int64_t, bool) override {
+    const int lane = disruptor_->getProcessorFor(*this).currentLane();
+    values_[static_cast<std::size_t>(lane)].push_back(event.value);
+  }
+
+  const std::vector<int>& values(int lane) const {
+    return values_[static_cast<std::size_t>(lane)];
+  }
+
+private:
+  DisruptorT* disruptor_;
+  std::vector<std::vector<int>> values_;
+};
+
+// shutdown() only waits for running handlers.
+template <typename DisruptorT, typename... Handlers>
+void awaitRunning(DisruptorT& disruptor, Handlers&... handlers) {
+  while (!(disruptor.getProcessorFor(handlers).isRunning() && ...)) {
+    std::this_thread::yield();
+  }
+}
+}  // namespace
+
+TEST(MultiLaneDisruptorTest, shouldRunAPipelineOverEveryLane) {
+  using DisruptorT = disruptor::dsl::MultiLaneDisruptor<Event, disruptor::BlockingWaitStrategy>;
+  constexpr int kLanes = 3;
+  constexpr int kEventsPerProducer = 1000;
+  DisruptorT d(Event::EVENT_FACTORY, kLanes, 64, disruptor::util::DaemonThreadFactory::INSTANCE());
+  Doubler doubler;
+  LaneRecordingHandler<DisruptorT> recorder(d, kLanes);
+  d.handleEventsWith(doubler).then(recorder);
+  EXPECT_EQ(2, d.getProcessorCount());
+
+  d.start();
+  awaitRunning(d, doubler, recorder);
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kLanes; ++p) {
+    producers.emplace_back([&d] { publishFrom(d.registerProducer(), kEventsPerProducer); });
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  d.shutdown(5000);
+  d.join();
+
+  for (int lane = 0; lane < kLanes; ++lane) {
+    const auto& values = recorder.values(lane);
+    ASSERT_EQ(static_cast<std::size_t>(kEventsPerProducer), values.size());
+    for (int i = 0; i < kEventsPerProducer; ++i) {
+      ASSERT_EQ(2 * i, values[static_cast<std::size_t>(i)]);
+    }
+  }
+}
+
+TEST(MultiLaneDisruptorTest, shouldWaitForEveryHandlerOfAJoinedStage) {
+  using DisruptorT = disruptor::dsl::MultiLaneDisruptor<Event, disruptor::YieldingWaitStrategy>;
+  DisruptorT d(Event::EVENT_FACTORY, 2, 16, disruptor::util::DaemonThreadFactory::INSTANCE());
+
+  // Single lane in use, so sequences are in publish order.
+  class TrackingHandler final : public disruptor::EventHandler<Event> {
+  public:
+    explicit TrackingHandler(bool slow) : slow_(slow) {}
+
+    void onEvent(Event&, int64_t sequence, bool) override {
+      if (slow_) {
+        std::this_thread::yield();
+      }
+      last.store(sequence, std::memory_order_release);
+    }
+
+    std::atomic<int64_t> last{-1};
+
+  private:
+    bool slow_;
+  } slow(true), fast(false);
+
+  class JoinCheckingHandler final : public disruptor::EventHandler<Event> {
+  public:
+    JoinCheckingHandler(TrackingHandler& first, TrackingHandler& second)
+      : first_(&first), second_(&second) {}
+
+    void onEvent(Event&, int64_t sequence, bool) override {
+      ++count;
+      early += first_->last.load(std::memory_order_acquire) < sequence
+                   || second_->last.load(std::memory_order_acquire) < sequence
+                 ? 1
+                 : 0;
+    }
+
+    int count{0};
+    int early{0};
+
+  private:
+    TrackingHandler* first_;
+    TrackingHandler* second_;
+  } joined(slow, fast);
+
+  d.handleEventsWith(slow);
+  d.handleEventsWith(fast);
+  d.after(slow, fast).handleEventsWith(joined);
+
+  d.start();
+  awaitRunning(d, slow, fast, joined);
+  EXPECT_THROW(d.start(), std::runtime_error);
+  EXPECT_THROW(d.handleEventsWith(joined), std::runtime_error);
+  publishFrom(d.registerProducer(), 200);
+  d.shutdown(5000);
+  d.join();
+
+  EXPECT_FALSE(d.hasBacklog());
+  EXPECT_EQ(199, d.getSequencesFor(joined)[0].get());
+  EXPECT_EQ(200, joined.count);
+  EXPECT_EQ(0, joined.early);
+}
+
+TEST(MultiLaneDisruptorTest, shouldRejectAHandlerThatIsNotProcessingEvents) {
+  using DisruptorT = disruptor::dsl::MultiLaneDisruptor<Event, disruptor::YieldingWaitStrategy>;
+  DisruptorT d(Event::EVENT_FACTORY, 2, 16, disruptor::util::DaemonThreadFactory::INSTANCE());
+  Doubler doubler;
+
+  EXPECT_THROW(d.after(doubler), std::invalid_argument);
+}
@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/EventHandler.h"
+#include "disruptor/EventTranslatorOneArg.h"
+#include "disruptor/TimeoutException.h"
+#include "disruptor/YieldingWaitStrategy.h"
+#include "disruptor/dsl/ShardedDisruptor.h"
+#include "disruptor/util/DaemonThreadFactory.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <latch>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+struct KeyedEvent {
+  int64_t key{0};
+  int64_t value{0};
+};
+
+struct KeyedEventFactory final : public disruptor::EventFactory<KeyedEvent> {
+  KeyedEvent newInstance() override {
+    return KeyedEvent();
+  }
+};
+
+struct Order {
+  int64_t key;
+  int64_t value;
+};
+
+struct OrderKey {
+  std::uint64_t operator()(const Order& order) const {
+    return static_cast<std::uint64_t>(order.key);
+  }
+};
+
+struct OrderTranslator final : public disruptor::EventTranslatorOneArg<KeyedEvent, Order> {
+  void translateTo(KeyedEvent& event, int64_t, Order order) override {
+    event.key = order.key;
+    event.value = order.value;
+  }
+};
+
+class RecordingHandler final : public disruptor::EventHandler<KeyedEvent> {
+public:
+  void onEvent(KeyedEvent& event, int64_t, bool) override {
+    seen_.push_back(Order{event.key, event.value});
+  }
+
+  std::vector<Order> seen_;
+};
+
+class GatedHandler final : public disruptor::EventHandler<KeyedEvent> {
+public:
+  void onEvent(KeyedEvent&, int64_t, bool) override {
+    while (!released_.load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+  }
+
+  std::atomic<bool> released_{false};
+};
+
+using WS = disruptor::YieldingWaitStrategy;
+using ShardedT =
+  disruptor::dsl::ShardedDisruptor<KeyedEvent, disruptor::dsl::ProducerType::MULTI, WS, OrderKey>;
+constexpr int kShards = 3;
+
+void expectRoutedInOrder(ShardedT& sharded,
+                         std::array<RecordingHandler, kShards>& handlers,
+                         int64_t expected) {
+  int64_t total = 0;
+  for (int s = 0; s < kShards; ++s) {
+    std::vector<int64_t> lastValue(8, -1);
+    for (const Order& order : handlers[static_cast<std::size_t>(s)].seen_) {
+      ASSERT_EQ(s, sharded.shardFor(static_cast<std::uint64_t>(order.key)));
+      ASSERT_LT(lastValue[static_cast<std::size_t>(order.key)], order.value);
+      lastValue[static_cast<std::size_t>(order.key)] = order.value;
+    }
+    total += static_cast<int64_t>(handlers[static_cast<std::size_t>(s)].seen_.size());
+  }
+  EXPECT_EQ(expected, total);
+}
+}  // namespace
+
+TEST(ShardedDisruptorTest, shouldRouteEachKeyToOneShardInOrder) {
+  ShardedT sharded(std::make_shared<KeyedEventFactory>(), kShards, 64,
+                   disruptor::util::DaemonThreadFactory::INSTANCE());
+  std::array<RecordingHandler, kShards> handlers;
+  for (int s = 0; s < kShards; ++s) {
+    sharded.shard(s).handleEventsWith(handlers[static_cast<std::size_t>(s)]);
+  }
+  std::latch started(sharded.getProcessorCount());
+  sharded.start(&started);
+  started.wait();
+
+  OrderTranslator translator;
+  constexpr int kEvents = 3000;
+  for (int i = 0; i < kEvents; ++i) {
+    sharded.publishEvent(translator, Order{i % 8, i});
+  }
+  sharded.shutdown();
+
+  EXPECT_FALSE(sharded.hasBacklog());
+  expectRoutedInOrder(sharded, handlers, kEvents);
+  for (int s = 0; s < kShards; ++s) {
+    const disruptor::dsl::ShardMetrics metrics = sharded.metrics(s);
+    EXPECT_EQ(static_cast<int64_t>(handlers[static_cast<std::size_t>(s)].seen_.size()) - 1,
+              metrics.cursor);
+    EXPECT_EQ(0, metrics.backlog);
+    EXPECT_EQ(64, metrics.remainingCapacity);
+  }
+}
+
+TEST(ShardedDisruptorTest, shouldSplitABatchAcrossShardsInOneCall) {
+  ShardedT sharded(std::make_shared<KeyedEventFactory>(), kShards, 1024,
+                   disruptor::util::DaemonThreadFactory::INSTANCE());
+  std::array<RecordingHandler, kShards> handlers;
+  for (int s = 0; s < kShards; ++s) {
+    sharded.shard(s).handleEventsWith(handlers[static_cast<std::size_t>(s)]);
+  }
+  std::latch started(sharded.getProcessorCount());
+  sharded.start(&started);
+  started.wait();
+
+  // Longer than one routing chunk, so the split spans several claims per shard.
+  std::vector<Order> orders;
+  for (int i = 0; i < 700; ++i) {
+    orders.push_back(Order{(i * 5) % 8, i});
+  }
+  OrderTranslator translator;
+  sharded.publishEvents(translator, std::span<const Order>(orders));
+  sharded.shutdown();
+
+  expectRoutedInOrder(sharded, handlers, 700);
+}
+
+TEST(ShardedDisruptorTest, shouldReportBacklogPerShardAndTimeOutShutdown) {
+  ShardedT sharded(std::make_shared<KeyedEventFactory>(), kShards, 64,
+                   disruptor::util::DaemonThreadFactory::INSTANCE());
+  std::array<GatedHandler, kShards> handlers;
+  for (int s = 0; s < kShards; ++s) {
+    sharded.shard(s).handleEventsWith(handlers[static_cast<std::size_t>(s)]);
+  }
+  std::latch started(sharded.getProcessorCount());
+  sharded.start(&started);
+  started.wait();
+
+  OrderTranslator translator;
+  sharded.publishEvent(translator, Order{2, 0});
+  sharded.publishEvent(translator, Order{2, 1});
+  EXPECT_TRUE(sharded.hasBacklog());
+  EXPECT_EQ(0, sharded.metrics(0).backlog);
+  EXPECT_EQ(2, sharded.metrics(2).backlog);
+  EXPECT_EQ(62, sharded.metrics(2).remainingCapacity);
+  EXPECT_THROW(sharded.shutdown(10), disruptor::TimeoutException);
+
+  handlers[2].released_.store(true, std::memory_order_release);
+  sharded.shutdown();
+  EXPECT_FALSE(sharded.hasBacklog());
+  EXPECT_EQ(0, sharded.metrics(2).backlog);
+
+  EXPECT_THROW(ShardedT(std::make_shared<KeyedEventFactory>(), 0, 64,
+                        disruptor::util::DaemonThreadFactory::INSTANCE()),
+               std::invalid_argument);
+}
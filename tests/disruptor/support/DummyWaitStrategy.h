@@ -16,10 +16,10 @@ public:
 
   int signalAllWhenBlockingCalls = 0;
 
-  template <typename BarrierT>
+  template <typename DependentSequenceT, typename BarrierT>
   int64_t waitFor(int64_t /*sequence*/,
                   const ::disruptor::Sequence& /*cursor*/,
-                  const ::disruptor::Sequence& /*dependentSequence*/,
+                  const DependentSequenceT& /*dependentSequence*/,
                   BarrierT& /*barrier*/) {
     return 0;
   }
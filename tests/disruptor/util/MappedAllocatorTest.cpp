@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/RingBuffer.h"
+#include "disruptor/util/MappedAllocator.h"
+#include "tests/disruptor/support/StubEvent.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <vector>
+
+TEST(MappedAllocatorTest, shouldBehaveAsStdAllocatorWithDefaultPolicy) {
+  std::vector<int64_t, disruptor::util::MappedAllocator<int64_t>> values(1000, 7);
+  EXPECT_FALSE(values.get_allocator().policy().usesMapping());
+  EXPECT_EQ(7, values[999]);
+}
+
+TEST(MappedAllocatorTest, shouldAllocatePrefaultedHugePageBackedMemory) {
+  disruptor::util::MemoryPolicy policy;
+  policy.pageSize = disruptor::util::PageSize::HUGE_2MB;
+  policy.prefault = true;
+  disruptor::util::MappedAllocator<int64_t> allocator(policy);
+
+  // Falls back to transparent huge pages when no hugetlb pages are reserved.
+  int64_t* p = allocator.allocate(1 << 18);
+  ASSERT_NE(nullptr, p);
+#if defined(__linux__)
+  EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(p) % (2u << 20));
+#endif
+  EXPECT_EQ(0, p[0]);
+  p[(1 << 18) - 1] = 42;
+  EXPECT_EQ(42, p[(1 << 18) - 1]);
+  allocator.deallocate(p, 1 << 18);
+}
+
+TEST(MappedAllocatorTest, shouldSizeOneGigabyteFallbackToTransparentHugePages) {
+  disruptor::util::MemoryPolicy policy;
+  policy.pageSize = disruptor::util::PageSize::HUGE_1GB;
+  policy.prefault = true;
+  disruptor::util::MappedAllocator<int64_t> allocator(policy);
+
+  int64_t* p = allocator.allocate(1 << 17);
+  ASSERT_NE(nullptr, p);
+#if defined(__linux__)
+  const std::size_t bytes = disruptor::util::detail::MappingSizes::find(p);
+  if (bytes == std::size_t{1} << 30) {
+    allocator.deallocate(p, 1 << 17);
+    GTEST_SKIP() << "1 GB hugetlb pages are reserved; no fallback to check";
+  }
+  // Rounded to the 2 MB transparent huge page, not the 1 GB that was asked
+  // for, so pre-faulting touches 2 MB.
+  EXPECT_EQ(std::size_t{2} << 20, bytes);
+#endif
+  p[(1 << 17) - 1] = 42;
+  EXPECT_EQ(42, p[(1 << 17) - 1]);
+  allocator.deallocate(p, 1 << 17);
+#if defined(__linux__)
+  EXPECT_EQ(0u, disruptor::util::detail::MappingSizes::find(p));
+#endif
+}
+
+TEST(MappedAllocatorTest, shouldBackRingBufferAndAvailabilityBufferWithPolicy) {
+  using Event = disruptor::support::StubEvent;
+  using WS = disruptor::BusySpinWaitStrategy;
+  WS ws;
+  disruptor::util::MemoryPolicy policy;
+  policy.prefault = true;
+  policy.lock = true;
+
+  std::shared_ptr<disruptor::MultiProducerRingBuffer<Event, WS>> ringBuffer;
+  try {
+    ringBuffer = disruptor::MultiProducerRingBuffer<Event, WS>::createMultiProducer(
+      disruptor::support::StubEvent::EVENT_FACTORY, 1024, ws, policy);
+  } catch (const std::system_error&) {
+    GTEST_SKIP() << "mlock not permitted (RLIMIT_MEMLOCK)";
+  }
+
+  ringBuffer->publishEvent(disruptor::support::StubEvent::TRANSLATOR, 29, std::string{});
+  EXPECT_EQ(29, ringBuffer->get(0).getValue());
+  EXPECT_TRUE(ringBuffer->getSequencer().isAvailable(0));
+  EXPECT_FALSE(ringBuffer->getSequencer().isAvailable(1));
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include "disruptor/BusySpinWaitStrategy.h"
+#include "disruptor/EventHandler.h"
+#include "disruptor/EventTranslator.h"
+#include "disruptor/dsl/Disruptor.h"
+#include "disruptor/dsl/ProducerType.h"
+#include "disruptor/util/MappedAllocator.h"
+#include "disruptor/util/Numa.h"
+#include "disruptor/util/NumaThreadFactory.h"
+#include "tests/disruptor/support/LongEvent.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#  include <sched.h>
+#endif
+
+namespace {
+class CountingHandler final : public disruptor::EventHandler<disruptor::support::LongEvent> {
+public:
+  void onEvent(disruptor::support::LongEvent& event, int64_t, bool) override {
+    sum_ += event.get();
+    ++count_;
+  }
+
+  int64_t sum_{0};
+  int count_{0};
+};
+
+class ValueTranslator final : public disruptor::EventTranslator<disruptor::support::LongEvent> {
+public:
+  void translateTo(disruptor::support::LongEvent& event, int64_t sequence) override {
+    event.set(sequence);
+  }
+};
+}  // namespace
+
+TEST(NumaTest, shouldRunThreadsOnTheCpusOfTheirNode) {
+  ASSERT_GE(disruptor::util::Numa::nodeCount(), 1);
+  const std::vector<int> cpus = disruptor::util::Numa::cpusOfNode(0);
+  if (cpus.empty()) {
+    GTEST_SKIP() << "NUMA topology not visible";
+  }
+  EXPECT_TRUE(disruptor::util::Numa::cpusOfNode(disruptor::util::Numa::nodeCount()).empty());
+
+  std::vector<int> allowed;
+  disruptor::util::NumaThreadFactory threadFactory(0);
+  std::thread t = threadFactory.newThread([&allowed] {
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    ::sched_getaffinity(0, sizeof(set), &set);
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      if (CPU_ISSET(cpu, &set)) {
+        allowed.push_back(cpu);
+      }
+    }
+#endif
+  });
+  t.join();
+
+  for (int cpu : allowed) {
+    EXPECT_NE(cpus.end(), std::find(cpus.begin(), cpus.end(), cpu)) << cpu;
+  }
+}
+
+TEST(NumaTest, shouldBindMappedMemoryToNode) {
+  disruptor::util::MemoryPolicy policy;
+  policy.numaNode = 0;
+  policy.prefault = true;
+  disruptor::util::MappedAllocator<int64_t> allocator(policy);
+
+  int64_t* p = nullptr;
+  try {
+    p = allocator.allocate(1 << 16);
+  } catch (const std::system_error&) {
+    GTEST_SKIP() << "mbind not permitted";
+  }
+  p[(1 << 16) - 1] = 42;
+  EXPECT_EQ(42, p[(1 << 16) - 1]);
+  allocator.deallocate(p, 1 << 16);
+}
+
+TEST(NumaTest, shouldPlaceDisruptorOnNode) {
+  using Event = disruptor::support::LongEvent;
+  using WS = disruptor::BusySpinWaitStrategy;
+  using DisruptorT = disruptor::dsl::Disruptor<Event, disruptor::dsl::ProducerType::MULTI, WS>;
+  WS ws;
+  disruptor::util::NumaThreadFactory threadFactory(0);
+  disruptor::util::MemoryPolicy policy;
+  policy.numaNode = 0;
+
+  std::optional<DisruptorT> d;
+  try {
+    d.emplace(Event::FACTORY, 1024, threadFactory, ws, policy);
+  } catch (const std::system_error&) {
+    GTEST_SKIP() << "mbind not permitted";
+  }
+  CountingHandler handler;
+  d->handleEventsWith(handler);
+  d->start();
+
+  ValueTranslator translator;
+  for (int i = 0; i < 100; ++i) {
+    d->publishEvent(translator);
+  }
+  while (d->getSequenceValueFor(handler) < 99) {
+    std::this_thread::yield();
+  }
+  d->halt();
+  d->join();  // Wait for consumer threads to finish before handlers are destroyed
+
+  EXPECT_EQ(100, handler.count_);
+  EXPECT_EQ(99 * 100 / 2, handler.sum_);
+}